@@ -10,6 +10,7 @@
 
 #pragma once // Diretiva moderna para include guard
 #include <IPAddress.h>
+#include <cstddef> // Para size_t
 #include <cstdint> // Para tipos integrais de largura específica
 
 /**
@@ -76,8 +77,8 @@ namespace Config
     /// @details Velocidade de comunicação para depuração e monitoramento
     constexpr uint32_t BAUD_RATE = 115200U;
 
-    constexpr uint32_t ADC_PIN = 32;      // Pino ADC para leitura de tensão
-    constexpr float ADC_MULTIPLIER = 2.0; // Porque estamos usando 10k e 10k
+    constexpr uint32_t ADC_PIN = 32;      // Pino ADC para leitura de tensão (ADC1)
+    constexpr float ADC_MULTIPLIER = 2.0f; // Porque estamos usando 10k e 10k
 
     constexpr uint32_t SERVO_PIN = 35;       // Pino do Servo
     constexpr uint32_t SERVO_FREQUENCY = 50; // Frequência do PWM para o servo (50Hz)
@@ -100,6 +101,153 @@ namespace Config
     constexpr uint16_t WEB_REFRESH_INTERVAL = 2000U;
   }
 
+  /**
+   * @namespace Adc
+   * @brief Configurações da amostragem contínua do ADC (tensão da bateria)
+   *
+   * O ADC1 converte em segundo plano por DMA; a tarefa do ADC faz a média
+   * de OVERSAMPLING leituras e aplica um filtro exponencial.
+   */
+  namespace Adc
+  {
+    /// @brief Taxa de conversão do ADC (Hz); 20 kHz é o mínimo no ESP32
+    constexpr uint32_t SAMPLE_RATE_HZ = 20000U;
+
+    /// @brief Leituras por valor publicado (20 Hz a 20 kHz)
+    constexpr uint32_t OVERSAMPLING = 1000U;
+
+    /// @brief Coeficiente do filtro exponencial aplicado às médias
+    constexpr float SMOOTHING = 0.2f;
+
+    /// @brief Bytes entregues pelo DMA a cada interrupção e lidos por chamada
+    constexpr uint32_t READ_BYTES = 256U;
+
+    /// @brief Buffer do driver entre o DMA e a tarefa (bytes)
+    /// @details 100 ms de leituras a 20 kHz
+    constexpr uint32_t DMA_BUFFER_BYTES = 4096U;
+
+    /// @brief Referência padrão para a calibração quando o eFuse não tem Vref (mV)
+    constexpr uint32_t DEFAULT_VREF_MV = 1100U;
+
+    /// @brief Tarefa do ADC
+    constexpr uint32_t TASK_PRIORITY = 1U;
+    constexpr uint32_t TASK_STACK = 3072U;
+    constexpr int TASK_CORE = 1; // Núcleo do loop(), longe do WiFi
+  }
+
+  /**
+   * @namespace Log
+   * @brief Configurações do registro assíncrono (Log.h)
+   *
+   * Quem registra grava em um buffer circular e segue; uma tarefa de baixa
+   * prioridade esvazia o buffer na serial.
+   */
+  namespace Log
+  {
+    /// @brief Maior nível compilado: 0 nada, 1 erro, 2 aviso, 3 info, 4 depuração
+    /// @details Mensagens acima deste nível não geram código
+    constexpr uint8_t LEVEL = 3U;
+
+    /// @brief Envia registros binários, formatados no host por tools/LogDecode.cpp
+    constexpr bool BINARY = false;
+
+    /// @brief Mensagens no buffer circular (potência de 2)
+    constexpr size_t SLOTS = 64U;
+
+    /// @brief Maior mensagem, em bytes; as maiores são cortadas
+    constexpr size_t RECORD_BYTES = 120U;
+
+    /// @brief Formatos lembrados pelo modo binário antes de reenviá-los
+    constexpr size_t FORMAT_CACHE = 32U;
+
+    /// @brief Espera da tarefa quando o buffer esvazia (ms)
+    constexpr uint32_t DRAIN_INTERVAL = 10U;
+
+    /// @brief Tarefa de esvaziamento
+    constexpr uint32_t TASK_PRIORITY = 1U;
+    constexpr uint32_t TASK_STACK = 3072U;
+    constexpr int TASK_CORE = 1; // Núcleo do loop(), longe do WiFi
+  }
+
+  /**
+   * @namespace Link
+   * @brief Configurações da contabilidade de perdas do enlace
+   */
+  namespace Link
+  {
+    /// @brief Salto de sequência (em quadros) tratado como reinício do foguete
+    /// @details 1000 quadros são mais de 8 minutos a 2 Hz; lacunas menores contam como perda
+    constexpr uint16_t RESYNC_GAP = 1000U;
+
+    /// @brief Período do relatório de enlace devolvido ao foguete (ms)
+    /// @details O foguete ajusta a taxa de envio pela entrega que a Base mede
+    constexpr uint32_t REPORT_INTERVAL = 1000U;
+  }
+
+  /**
+   * @namespace History
+   * @brief Configurações do histórico de amostras recebidas
+   */
+  namespace History
+  {
+    /// @brief Amostras guardadas (potência de 2)
+    /// @details 256 amostras a ~33 Hz (Config::Timing::TELEMETRY_SAMPLE_INTERVAL
+    /// do foguete, 30 ms) cobrem cerca de 7,7 s de voo (~31 KB)
+    constexpr size_t DEPTH = 256U;
+
+    /// @brief Amostras por resposta de /json/history
+    /// @details O cliente continua do campo "next"; limita o tempo em que
+    /// uma resposta segura o servidor (~600 bytes por amostra)
+    constexpr size_t MAX_PAGE = 64U;
+  }
+
+  /**
+   * @namespace Download
+   * @brief Recepção do arquivo de voo enviado pelo foguete (Transfer.h)
+   */
+  namespace Download
+  {
+    /// @brief Espera pelo INFO antes de repetir o pedido, e sem pedaços antes de repetir o ACK (ms)
+    constexpr uint32_t RETRY_TIMEOUT = 200U;
+
+    /// @brief Tempo sem resposta do foguete até desistir (ms)
+    constexpr uint32_t IDLE_TIMEOUT = 5000U;
+
+    /// @brief Intervalo entre verificações sem mensagens novas (ms)
+    constexpr uint32_t POLL_INTERVAL = 5U;
+
+    /// @brief Posições da fila callback do ESP-NOW -> tarefa (potência de 2)
+    /// @details 64 mensagens (~16 kB) cobrem ~150 ms de pedaços enquanto a
+    /// flash apaga um setor; o que transbordar o foguete reenvia
+    constexpr size_t QUEUE_DEPTH = 64U;
+
+    /// @brief Arquivo recebido, servido em /log/file
+    constexpr const char *FILE_NAME = "/download.bin";
+
+    /// @brief Tarefa da transferência
+    constexpr uint32_t TASK_PRIORITY = 2U;
+    constexpr uint32_t TASK_STACK = 4096U;
+    constexpr int TASK_CORE = 1; // Núcleo do loop(), longe do WiFi
+  }
+
+  /**
+   * @namespace Events
+   * @brief Fluxo de eventos do painel (/events, Server-Sent Events)
+   */
+  namespace Events
+  {
+    /// @brief Navegadores conectados ao mesmo tempo
+    /// @details Cada um prende um socket do lwIP enquanto a página está aberta
+    constexpr size_t MAX_CLIENTS = 4U;
+
+    /// @brief Intervalo do comentário que mantém a conexão viva sem quadros (ms)
+    constexpr uint32_t KEEPALIVE_INTERVAL = 15000U;
+
+    /// @brief Espera máxima do loop() por um quadro novo (ms)
+    /// @details Mesmo ritmo em que o loop() atendia as páginas antes
+    constexpr uint32_t LOOP_WAIT = 100U;
+  }
+
   /**
    * @namespace EspNow
    * @brief Configurações específicas para protocolo ESP-NOW
@@ -0,0 +1,98 @@
+/**
+ * @file Download.h
+ * @brief Recepção do arquivo de voo do foguete pelo ESP-NOW
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Depois do pouso, a página pede o arquivo do gravador (POST /log/start); uma
+ * tarefa própria conduz a transferência (Transfer.h) e grava o arquivo
+ * no LittleFS, de onde ele é servido inteiro em /log/file.
+ *
+ * O endereço do foguete é aprendido dos quadros de telemetria: sem
+ * nenhum quadro recebido desde o boot, não há a quem pedir.
+ *
+ * O callback do ESP-NOW apenas copia as mensagens da transferência para
+ * uma fila; a escrita na flash fica na tarefa, fora da tarefa do WiFi.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Transfer.h"
+
+/**
+ * @namespace Download
+ * @brief Tarefa que pede e recebe o arquivo de voo
+ */
+namespace Download
+{
+    /**
+     * @brief Situação da transferência, copiada pela tarefa para as páginas
+     */
+    struct Status {
+        /// @brief Etapa da recepção
+        Transfer::Receiver::State state;
+
+        /// @brief Resposta do foguete ao último pedido
+        Transfer::Status answer;
+
+        /// @brief Nome do arquivo no foguete
+        char name[Transfer::MAX_NAME + 1];
+
+        /// @brief Tamanho do arquivo (bytes)
+        uint32_t size;
+
+        /// @brief Bytes já gravados em ordem
+        uint32_t written;
+
+        /// @brief Duração da transferência, do INFO ao último pedaço ou até agora (ms)
+        uint32_t elapsedMs;
+
+        /// @brief Contadores da recepção
+        Transfer::Receiver::Stats stats;
+
+        /// @brief Mensagens descartadas com a fila cheia
+        uint32_t queueDrops;
+    };
+
+    /**
+     * @brief Monta o LittleFS e cria a fila e a tarefa da transferência
+     * @retval true Pronto para receber
+     * @retval false Sem sistema de arquivos ou sem tarefa
+     */
+    bool start();
+
+    /**
+     * @brief Entrega uma mensagem recebida pelo ESP-NOW
+     *
+     * @details Chamada pelo callback de recepção, antes da telemetria.
+     * @retval true A mensagem era da transferência e foi consumida
+     */
+    bool receive(const uint8_t *mac, const uint8_t *data, int len);
+
+    /// @brief Anota o endereço do foguete (quadro de telemetria válido)
+    void rocketSeen(const uint8_t *mac);
+
+    /**
+     * @brief Envia uma mensagem avulsa ao foguete (relatório de enlace)
+     * @retval false Foguete ainda não visto ou rádio recusou
+     */
+    bool sendToRocket(const uint8_t *message, size_t len);
+
+    /**
+     * @brief Pede o arquivo de voo ao foguete
+     * @retval false Foguete ainda não visto ou transferência em andamento
+     */
+    bool request();
+
+    /// @brief Copia a situação da transferência
+    void status(Status &out);
+
+    /// @brief Nome legível de uma etapa
+    const char *stateName(Transfer::Receiver::State state);
+
+    /// @brief Nome legível de uma resposta do foguete
+    const char *answerName(Transfer::Status answer);
+}
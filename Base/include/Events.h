@@ -0,0 +1,51 @@
+/**
+ * @file Events.h
+ * @brief Fluxo de eventos do painel (Server-Sent Events em /events)
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * A página abre um EventSource em /events e recebe um evento por quadro
+ * decodificado, atualizando a tabela no lugar em vez de recarregar.
+ *
+ * O WebServer do Arduino atende uma requisição por vez e fecha a conexão
+ * no fim; aqui o handler guarda uma cópia do WiFiClient, que mantém o
+ * socket aberto, e o loop() escreve os eventos nela. Todas as funções
+ * são chamadas do loop() (os handlers também rodam nele).
+ *
+ * @note Com a conexão ainda aberta, o WebServer espera até 2 s antes de
+ * aceitar a próxima requisição; isso acontece só quando a página abre ou
+ * reconecta o fluxo.
+ */
+
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+/**
+ * @namespace Events
+ * @brief Conexões abertas em /events
+ */
+namespace Events
+{
+    /**
+     * @brief Assume a conexão da requisição atual e envia o cabeçalho
+     * @retval false Já há Config::Events::MAX_CLIENTS conexões
+     */
+    bool attach(WiFiClient client);
+
+    /**
+     * @brief Envia um evento a todas as conexões
+     * @param data Conteúdo do evento, numa linha só (JSON)
+     * @details Não bloqueia: conexões fechadas ou cujo buffer de envio não
+     * aceita o evento inteiro na hora são descartadas; o navegador
+     * reconecta sozinho.
+     */
+    void broadcast(const String &data);
+
+    /// @brief Envia o comentário de manutenção se não houve evento recente
+    void keepAlive(uint32_t nowMs);
+
+    /// @brief Conexões abertas
+    size_t clients();
+}
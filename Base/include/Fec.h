@@ -0,0 +1,155 @@
+/**
+ * @file Fec.h
+ * @brief Correção de erros entre quadros (paridade XOR) para o fluxo de telemetria
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Retransmitir não faz sentido em um voo de poucos segundos, então o
+ * foguete envia, a cada grupo de K quadros de fluxo, um quadro de
+ * paridade com o XOR dos K quadros. Se exatamente um quadro do grupo se
+ * perder, a Base o reconstrói a partir dos outros e da paridade.
+ *
+ * Os grupos são alinhados pelo número de sequência (o primeiro quadro do
+ * grupo tem sequência múltipla de K) e K vai nos bits altos de
+ * StreamHeader::flags, portanto a Base conhece o grupo de cada quadro
+ * sem esperar a paridade.
+ *
+ * Quadro de paridade:
+ *
+ * | Campo          | Tipo      | Conteúdo                                 |
+ * |----------------|-----------|------------------------------------------|
+ * | version        | uint8     | PARITY_VERSION                           |
+ * | group          | uint8     | K                                        |
+ * | firstSequence  | uint16    | Sequência do primeiro quadro do grupo    |
+ * | lengths[K]     | uint8     | Tamanho de cada quadro do grupo          |
+ * | payload        | bytes     | XOR dos K quadros, completados com zeros |
+ *
+ * Este arquivo e Fec.cpp devem ser idênticos nos dois projetos.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Telemetry.h"
+
+namespace Telemetry
+{
+    /**
+     * @brief Gera os quadros de paridade (lado do foguete)
+     */
+    class FecEncoder
+    {
+    public:
+        /// @param group Quadros por grupo (potência de 2 até MAX_FEC_GROUP; 0 desativa)
+        explicit FecEncoder(uint8_t group);
+
+        /**
+         * @brief Acumula um quadro de fluxo já enviado
+         *
+         * @details Deve receber todos os quadros, inclusive os que
+         * falharam no envio, na ordem em que foram gerados.
+         * @param frame Quadro de fluxo
+         * @param len Tamanho do quadro
+         * @param parity Destino da paridade, com ao menos MAX_FRAME_BYTES bytes
+         * @param parityLen Tamanho da paridade gerada
+         * @retval true O quadro fechou um grupo completo e @p parity deve ser enviada
+         */
+        bool add(const uint8_t *frame, size_t len, uint8_t *parity, size_t &parityLen);
+
+    private:
+        const uint8_t group_;
+        uint16_t firstSequence_ = 0;
+        uint8_t seen_ = 0;
+        uint8_t maxLength_ = 0;
+        uint8_t lengths_[MAX_FEC_GROUP] = {};
+        uint8_t accumulator_[MAX_FRAME_BYTES] = {};
+    };
+
+    /**
+     * @brief Reordena, recupera e entrega os quadros (lado da Base)
+     *
+     * @details Sem perdas, cada quadro é entregue assim que chega. Quando
+     * falta um quadro, os seguintes do mesmo grupo ficam retidos até a
+     * paridade chegar (e o perdido ser reconstruído) ou até chegar um
+     * quadro de um grupo posterior; então são entregues em ordem.
+     * Quadros sem FEC e de outros formatos passam direto.
+     */
+    class FecDecoder
+    {
+    public:
+        /// @brief Recebe cada quadro liberado, em ordem de sequência
+        typedef void (*Sink)(const uint8_t *frame, size_t len, void *context);
+
+        /**
+         * @brief Contadores da recuperação
+         */
+        struct Stats {
+            /// @brief Quadros de paridade recebidos
+            uint32_t parity;
+
+            /// @brief Quadros reconstruídos pela paridade
+            uint32_t recovered;
+
+            /// @brief Quadros que faltaram e não puderam ser reconstruídos
+            uint32_t unrecoverable;
+
+            /// @brief Quadros entregues depois de esperar pela paridade
+            uint32_t delayed;
+        };
+
+        /**
+         * @param sink Destino dos quadros liberados
+         * @param context Repassado a @p sink
+         */
+        FecDecoder(Sink sink, void *context);
+
+        /// @brief Processa um quadro recebido (dados ou paridade)
+        void push(const uint8_t *frame, size_t len);
+
+        /// @brief Entrega o que estiver retido, sem esperar a paridade
+        void flush();
+
+        /**
+         * @brief Recomeça o fluxo (reboot do foguete)
+         *
+         * @details Entrega o que estiver retido e esquece o grupo atual:
+         * sem isso, a sequência recomeçada parece mais antiga que o grupo
+         * e os quadros passam direto, sem correção, até ultrapassá-lo.
+         */
+        void reset();
+
+        /// @brief Contadores acumulados
+        const Stats &stats() const { return stats_; }
+
+    private:
+        /// @brief Começa a acompanhar o grupo de @p firstSequence
+        void begin(uint16_t firstSequence, uint8_t group);
+
+        /**
+         * @brief Entrega, em ordem, os quadros presentes a partir de next_
+         * @param arrived Índice do quadro que acabou de chegar (não conta como atrasado)
+         */
+        void release(uint8_t arrived);
+
+        /// @brief Reconstrói o único quadro faltante a partir da paridade
+        void recover(const uint8_t *parity, size_t len);
+
+        /// @brief Posição de @p firstSequence relativa ao grupo atual (<0: mais antigo)
+        int32_t compare(uint16_t firstSequence) const;
+
+        Sink sink_;
+        void *context_;
+
+        bool active_ = false;
+        uint16_t firstSequence_ = 0;
+        uint8_t group_ = 0;
+        uint8_t present_ = 0;  ///< Bit i: quadro i do grupo guardado
+        uint8_t next_ = 0;     ///< Próximo quadro do grupo a entregar
+        uint8_t lengths_[MAX_FEC_GROUP] = {};
+        uint8_t frames_[MAX_FEC_GROUP][MAX_FRAME_BYTES];
+
+        Stats stats_ = {};
+    };
+}
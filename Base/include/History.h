@@ -0,0 +1,76 @@
+/**
+ * @file History.h
+ * @brief Histórico circular das amostras recebidas do foguete
+ * @version 1.1
+ * @date Outubro/2026
+ *
+ * Cada quadro em lote traz várias amostras; todas são guardadas aqui, em
+ * ordem de chegada, e não apenas a mais recente. Quando o histórico enche,
+ * as amostras mais antigas são sobrescritas.
+ *
+ * Cada amostra recebe um número de sequência, contado desde o boot da
+ * Base: a página guarda o próximo número e pede só o que perdeu. A busca
+ * por tempo é binária, pois as amostras chegam em ordem de timestampUs:
+ * os quadros que a correção de erros libera atrasados são descartados
+ * antes de push() (processarQuadro() em main.cpp).
+ *
+ * O callback do ESP-NOW escreve sem trava; cada posição é um SeqLock e
+ * guarda o número da amostra, então um leitor nunca copia uma amostra
+ * pela metade nem confunde uma sobrescrita com a que pediu.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Structs.h"
+
+/**
+ * @namespace History
+ * @brief Armazenamento das últimas Config::History::DEPTH amostras
+ */
+namespace History
+{
+    /**
+     * @brief Acrescenta uma amostra
+     * @note Chamada apenas pelo callback de recepção do ESP-NOW
+     */
+    void push(const SensorData &sample);
+
+    /// @brief Amostras disponíveis (no máximo Config::History::DEPTH)
+    size_t size();
+
+    /// @brief Amostras recebidas desde o início; é também a sequência da próxima
+    uint32_t total();
+
+    /// @brief Sequência da amostra mais antiga ainda guardada
+    uint32_t oldest();
+
+    /**
+     * @brief Lê uma amostra pela sequência
+     * @param sequence Entre oldest() e total() - 1
+     * @param out Amostra lida
+     * @retval false Ainda não recebida ou já sobrescrita
+     */
+    bool get(uint32_t sequence, SensorData &out);
+
+    /**
+     * @brief Lê uma amostra guardada
+     * @param index 0 é a mais antiga disponível; size() - 1 a mais recente
+     * @param out Amostra lida
+     * @retval false Índice fora do histórico
+     */
+    bool at(size_t index, SensorData &out);
+
+    /**
+     * @brief Primeira amostra guardada com timestampUs >= @p timestampUs
+     *
+     * @details Busca binária, O(log DEPTH). Os tempos do foguete são
+     * comparados pela diferença, então a volta do micros() não atrapalha;
+     * depois de um reboot do foguete, porém, a ordem se quebra e o
+     * resultado vale só para as amostras do boot atual.
+     * @return Sequência encontrada, ou total() se todas forem anteriores
+     */
+    uint32_t find(uint32_t timestampUs);
+}
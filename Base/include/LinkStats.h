@@ -0,0 +1,113 @@
+/**
+ * @file LinkStats.h
+ * @brief Contabilidade de perdas do enlace de telemetria por número de sequência
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Cada quadro de fluxo traz um número de sequência de 16 bits. A partir
+ * dele o LinkMonitor conta quadros recebidos, perdidos, repetidos e fora
+ * de ordem, além do tamanho das rajadas de perda. Uma janela de 64 bits
+ * lembra quais dos últimos quadros já chegaram, o que separa um quadro
+ * atrasado (conta como reordenado e deixa de ser perda) de uma repetição.
+ *
+ * O foguete recomeça a sequência em 0 quando reinicia. Um salto grande
+ * em qualquer sentido, ou a volta para perto de 0, recomeça a janela e
+ * conta um reinício em vez de perdas ou repetições.
+ *
+ * Não depende do Arduino.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/// @brief Faixas do histograma de rajadas: 1, 2, 3-4, 5-8, 9-16, 17 ou mais quadros
+constexpr size_t LINK_BURST_BUCKETS = 6U;
+
+/**
+ * @brief Contadores do enlace
+ */
+struct LinkStats {
+    /// @brief Quadros distintos recebidos
+    uint32_t received;
+
+    /// @brief Quadros que faltaram na sequência e não chegaram depois
+    uint32_t lost;
+
+    /// @brief Quadros recebidos mais de uma vez
+    uint32_t duplicates;
+
+    /// @brief Quadros que chegaram depois de um posterior
+    uint32_t reordered;
+
+    /// @brief Lacunas na sequência (rajadas de perda)
+    uint32_t bursts;
+
+    /// @brief Maior rajada de quadros perdidos
+    uint32_t maxBurst;
+
+    /// @brief Rajada de perda mais recente
+    uint32_t lastBurst;
+
+    /// @brief Saltos grandes de sequência, tratados como reinício do foguete
+    uint32_t resets;
+
+    /// @brief Último número de sequência recebido
+    uint16_t lastSequence;
+
+    /// @brief Rajadas por faixa de tamanho (ver LINK_BURST_BUCKETS)
+    uint32_t burstHistogram[LINK_BURST_BUCKETS];
+};
+
+/**
+ * @brief Acompanha os números de sequência recebidos
+ */
+class LinkMonitor
+{
+public:
+    /// @brief Janela de quadros lembrados atrás do mais recente
+    static constexpr uint16_t WINDOW = 64U;
+
+    /// @brief Quadros iniciais que podem se perder logo após um reinício
+    /// @details Voltar a uma sequência até REWIND_SLACK vindo de pelo menos
+    /// 2 * REWIND_SLACK adiante é reinício, não quadro atrasado
+    static constexpr uint16_t REWIND_SLACK = 4U;
+
+    /**
+     * @param resyncGap Salto mínimo (em quadros) tratado como reinício
+     * do transmissor em vez de perda
+     */
+    explicit LinkMonitor(uint16_t resyncGap);
+
+    /// @brief Registra a chegada de um quadro
+    void record(uint16_t sequence);
+
+    /// @brief Zera contadores e janela
+    void reset();
+
+    /// @brief Contadores acumulados
+    const LinkStats &stats() const { return stats_; }
+
+    /// @brief Fração de quadros perdidos, entre 0 e 1
+    float lossRatio() const;
+
+    /// @brief Limite superior de cada faixa do histograma (0 = sem limite)
+    static uint32_t burstBucketLimit(size_t bucket);
+
+private:
+    /// @brief Reinicia a janela a partir de @p sequence
+    void restart(uint16_t sequence);
+
+    /// @brief Registra uma rajada de @p length quadros perdidos
+    void burst(uint32_t length);
+
+    const uint16_t resyncGap_;
+    bool started_ = false;
+    uint16_t highest_ = 0;
+
+    /// @brief Bit i: o quadro highest_ - i chegou
+    uint64_t window_ = 0;
+
+    LinkStats stats_ = {};
+};
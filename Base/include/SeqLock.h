@@ -0,0 +1,102 @@
+/**
+ * @file SeqLock.h
+ * @brief Publicação de um valor por um escritor para vários leitores, sem trava
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Seqlock: o escritor incrementa o número de sequência antes e depois de
+ * copiar o valor, de modo que ele fica ímpar durante a escrita. O leitor
+ * copia o valor entre duas leituras da sequência e só aceita a cópia se
+ * as duas forem iguais e pares; senão, tenta de novo.
+ *
+ * O escritor nunca espera (serve ao callback de recepção do WiFi) e os
+ * leitores nunca veem metade de um valor e metade de outro. O valor é
+ * guardado em palavras atômicas de 32 bits, lidas e escritas sem ordem
+ * entre si; as barreiras ficam só na sequência.
+ *
+ * @note Não depende de FreeRTOS nem do Arduino, podendo ser compilada
+ * no host.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @brief Valor publicado sob seqlock
+ * @tparam T Tipo copiável byte a byte
+ *
+ * @details store() deve ser chamado por um único escritor; load() e
+ * tryLoad() podem ser chamados de qualquer tarefa.
+ */
+template <typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "T deve ser copiavel byte a byte");
+
+public:
+    /// @brief Publica um valor novo (chamado apenas pelo escritor)
+    void store(const T &value)
+    {
+        uint32_t buffer[WORDS] = {};
+        memcpy(buffer, &value, sizeof(T));
+
+        const uint32_t sequence = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(sequence + 1U, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (size_t i = 0; i < WORDS; i++) words_[i].store(buffer[i], std::memory_order_relaxed);
+
+        sequence_.store(sequence + 2U, std::memory_order_release);
+    }
+
+    /**
+     * @brief Tenta copiar o valor publicado uma vez
+     * @retval true @p out recebeu um valor inteiro
+     * @retval false Uma escrita estava em andamento; @p out intocado
+     */
+    bool tryLoad(T &out) const
+    {
+        const uint32_t before = sequence_.load(std::memory_order_acquire);
+        if ((before & 1U) != 0) return false;
+
+        uint32_t buffer[WORDS];
+        for (size_t i = 0; i < WORDS; i++) buffer[i] = words_[i].load(std::memory_order_relaxed);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence_.load(std::memory_order_relaxed) != before) return false;
+
+        memcpy(&out, buffer, sizeof(T));
+        return true;
+    }
+
+    /**
+     * @brief Copia o valor publicado
+     *
+     * @details Repete enquanto colidir com uma escrita; a escrita é uma
+     * cópia curta, então a espera é de poucos microssegundos.
+     */
+    T load() const
+    {
+        T out;
+        while (!tryLoad(out)) {
+        }
+        return out;
+    }
+
+    /// @brief Valores publicados desde o início (muda a cada store())
+    uint32_t version() const
+    {
+        return sequence_.load(std::memory_order_acquire) >> 1;
+    }
+
+private:
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    std::atomic<uint32_t> sequence_{0};
+    std::atomic<uint32_t> words_[WORDS] = {};
+};
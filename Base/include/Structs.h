@@ -1,7 +1,7 @@
 /**
  * @file SensorStructs.h
  * @brief Definições de estruturas de dados para sensores
- * @version 1.3
+ * @version 1.6
  * @date Julho/2025
  * 
  * Este arquivo define as estruturas de dados utilizadas para 
@@ -139,6 +139,38 @@
      /// @details Representa o segundo do dia da leitura GPS horario de Greenwich
      int second;
 
+     /// @brief Idade da posição em milissegundos
+     /// @details Tempo entre a decodificação da posição e a montagem do pacote;
+     /// 0xFFFFFFFF enquanto o GPS não tiver nenhuma posição
+     uint32_t fixAge;
+
+     /// @brief Diluição horizontal da precisão (HDOP)
+     /// @details 0 quando o receptor não informa
+     float hdop;
+
+     /// @brief Número de satélites usados na solução
+     uint8_t satellites;
+
+ };
+ #pragma pack(pop)
+ /**
+  * @brief Estado do controle de taxa do rádio no foguete
+  * 
+  * Mostra na Base como o foguete está adaptando o envio às condições
+  * do enlace (ver RateController no foguete).
+  * 
+  * @note Uso de #pragma pack para garantir alinhamento de bytes 
+  * consistente entre diferentes plataformas
+  */
+ #pragma pack(push, 1)
+ struct RadioData {
+     /// @brief Período atual entre quadros em milissegundos
+     uint16_t frameIntervalMs;
+     /// @brief Amostras que cada quadro leva no período atual
+     uint8_t batchSize;
+     /// @brief Quadros confirmados na última janela de envio, em %
+     /// @details Calculado a partir do callback de envio do ESP-NOW
+     uint8_t deliveryPct;
  };
  #pragma pack(pop)
  /**
@@ -168,9 +200,21 @@
     /// @details Contém informações de posicionamento geográfico
     GPSData gps;
 
-     /// @brief Carimbo de tempo da leitura
-     /// @details Marca temporal da coleta dos dados dos sensores
-     float timestamp;                
+     /// @brief Carimbo de tempo da leitura em microssegundos
+     /// @details Instante da amostra do IMU, desde o boot do foguete
+     uint32_t timestampUs;
+
+     /// @brief Fase de voo (valor de FlightPhase no foguete)
+     /// @details Ver Telemetry::phaseName()
+     uint8_t phase;
+
+     /// @brief Estado do controle de taxa do rádio
+     /// @details Só trafega no quadro de fluxo; zerado nos demais formatos
+     RadioData radio;
+
+     /// @brief Alertas do foguete (bits Telemetry::STATUS_*)
+     /// @details Só trafega no quadro de fluxo; zerado nos demais formatos
+     uint8_t status;
  };
  #pragma pack(pop)
  
@@ -0,0 +1,422 @@
+/**
+ * @file Telemetry.h
+ * @brief Formato de pacote de telemetria v2, compartilhado por Foguete e Base
+ * @version 2.0
+ * @date Outubro/2026
+ *
+ * SensorData continua sendo a representação em memória nas duas placas;
+ * no rádio trafega apenas o PacketV2, com campos quantizados em inteiros.
+ * Este arquivo e Telemetry.cpp devem ser idênticos nos dois projetos.
+ *
+ * | Campo          | Tipo     | Unidade / escala                       |
+ * |----------------|----------|----------------------------------------|
+ * | version        | uint8    | PACKET_VERSION                         |
+ * | flags          | uint8    | bits 0-2: fase de voo                  |
+ * | timestampUs    | uint32   | µs desde o boot do foguete             |
+ * | acc[3]         | int16    | ACC_SCALE m/s² (±163 m/s²)             |
+ * | gyro[3]        | int16    | GYRO_SCALE rad/s (±32 rad/s)           |
+ * | temp           | int16    | 0,01 °C                                |
+ * | pitch, roll    | int16    | 0,01°                                  |
+ * | pressure       | uint16   | Pa acima de PRESSURE_OFFSET_PA         |
+ * | voltage        | uint16   | mV                                     |
+ * | lat, lon       | int32    | 1e-7°                                  |
+ * | gpsAltitude    | int16    | 0,1 m                                  |
+ * | utc            | uint32   | data/hora compactada (packUtc)         |
+ * | fixAge         | uint16   | ms; 0xFFFF sem posição                 |
+ * | hdop           | uint8    | 0,1                                    |
+ * | satellites     | uint8    | contagem                               |
+ *
+ * A altitude barométrica não é transmitida: o decodificador a recalcula
+ * a partir da pressão com a mesma fórmula do foguete.
+ *
+ * O foguete envia quadros em lote (versão BATCH_VERSION): um BatchHeader
+ * com os campos lentos (temperatura, tensão, GPS) seguido de até
+ * MAX_BATCH_SAMPLES registros BatchSample com os campos rápidos. Cada
+ * registro guarda apenas o intervalo até o anterior, em µs. O PacketV2
+ * avulso continua aceito pelo decodificador.
+ *
+ * O quadro de fluxo (STREAM_VERSION) leva as mesmas amostras comprimidas
+ * no estilo Gorilla: cada campo quantizado vira a diferença para a amostra
+ * anterior em zigzag + varint, o timestamp vira a diferença de segunda
+ * ordem e a fase vai como XOR da anterior. O estado atravessa os quadros;
+ * a cada keyframe ele recomeça do zero, então um quadro perdido só
+ * inutiliza o fluxo até o próximo keyframe.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Structs.h"
+
+/**
+ * @namespace Telemetry
+ * @brief Codificação e decodificação do pacote de rádio
+ */
+namespace Telemetry
+{
+    /// @brief Versão do formato; o primeiro byte de todo pacote
+    constexpr uint8_t PACKET_VERSION = 2;
+
+    /// @brief Versão do quadro em lote
+    constexpr uint8_t BATCH_VERSION = 3;
+
+    /// @brief Versão do quadro de fluxo comprimido
+    constexpr uint8_t STREAM_VERSION = 4;
+
+    /// @brief Bit de StreamHeader::flags que marca um keyframe
+    constexpr uint8_t STREAM_KEYFRAME = 0x01;
+
+    /// @brief Bits 1-3 de StreamHeader::flags: SensorData::status
+    constexpr uint8_t STREAM_STATUS_SHIFT = 1;
+
+    /// @brief Bits 4-7 de StreamHeader::flags: tamanho do grupo de FEC (0 = sem FEC)
+    constexpr uint8_t STREAM_FEC_SHIFT = 4;
+
+    /// @brief Bits de SensorData::status que cabem no quadro de fluxo
+    constexpr uint8_t STATUS_MASK = 0x07;
+
+    /// @brief Bit de SensorData::status: o voo não será gravado por inteiro no foguete
+    /// @details Gravador sem espaço (voo anterior ainda não baixado) ou com erro de escrita
+    constexpr uint8_t STATUS_RECORDER_FAULT = 0x01;
+
+    /// @brief Versão do quadro de paridade (ver Fec.h)
+    constexpr uint8_t PARITY_VERSION = 5;
+
+    /// @brief Versão do relatório de enlace que a Base devolve ao foguete
+    constexpr uint8_t LINK_REPORT_VERSION = 6;
+
+    /// @brief Maior grupo de FEC; o tamanho deve ser potência de 2
+    constexpr uint8_t MAX_FEC_GROUP = 8;
+
+    /// @brief Bytes fixos do quadro de paridade: versão, grupo e sequência inicial
+    constexpr size_t PARITY_HEADER_BYTES = 4U;
+
+    /// @brief Resolução do período entre quadros em StreamHeader (ms)
+    constexpr uint16_t RADIO_INTERVAL_SCALE = 10U;
+
+    /// @brief Maior carga útil de um quadro ESP-NOW (ESP_NOW_MAX_DATA_LEN)
+    constexpr size_t MAX_FRAME_BYTES = 250U;
+
+    /// @name Escalas de quantização (valor físico por LSB)
+    /// @{
+    constexpr float ACC_SCALE = 0.005f;
+    constexpr float GYRO_SCALE = 0.001f;
+    constexpr float TEMP_SCALE = 0.01f;
+    constexpr float ANGLE_SCALE = 0.01f;
+    constexpr float VOLTAGE_SCALE = 0.001f;
+    constexpr float GPS_ALTITUDE_SCALE = 0.1f;
+    constexpr double COORDINATE_SCALE = 1e-7;
+    /// @}
+
+    /// @brief Pressão representada pelo valor 0 (Pa); cobre até ~5 km de altitude
+    constexpr uint32_t PRESSURE_OFFSET_PA = 50000U;
+
+    /// @brief Pressão ao nível do mar usada para recalcular a altitude (hPa)
+    /// @note Deve ser igual a Config::Sensors::SEA_LEVEL_PRESSURE do foguete
+    constexpr float SEA_LEVEL_PRESSURE = 1013.25f;
+
+    /// @brief Valor de fixAge no pacote quando não há posição
+    constexpr uint16_t NO_FIX = 0xFFFF;
+
+    /// @brief Máscara da fase de voo em PacketV2::flags
+    constexpr uint8_t FLAG_PHASE_MASK = 0x07;
+
+    /**
+     * @brief Pacote de telemetria v2 (46 bytes)
+     *
+     * @note Uso de #pragma pack para garantir o mesmo layout nas duas placas
+     */
+    #pragma pack(push, 1)
+    struct PacketV2 {
+        uint8_t version;
+        uint8_t flags;
+        uint32_t timestampUs;
+        int16_t acc[3];
+        int16_t gyro[3];
+        int16_t temp;
+        int16_t pitch;
+        int16_t roll;
+        uint16_t pressure;
+        uint16_t voltage;
+        int32_t latitude;
+        int32_t longitude;
+        int16_t gpsAltitude;
+        uint32_t utc;
+        uint16_t fixAge;
+        uint8_t hdop;
+        uint8_t satellites;
+    };
+    #pragma pack(pop)
+
+    static_assert(sizeof(PacketV2) == 46, "PacketV2 deve ter 46 bytes");
+
+    /**
+     * @brief Cabeçalho do quadro em lote (28 bytes)
+     *
+     * @details Os campos lentos são os da amostra mais recente do lote e
+     * valem para todas as amostras na decodificação.
+     */
+    #pragma pack(push, 1)
+    struct BatchHeader {
+        uint8_t version;
+        uint8_t count;
+        uint32_t timestampUs;  ///< Instante da primeira amostra do lote
+        int16_t temp;
+        uint16_t voltage;
+        int32_t latitude;
+        int32_t longitude;
+        int16_t gpsAltitude;
+        uint32_t utc;
+        uint16_t fixAge;
+        uint8_t hdop;
+        uint8_t satellites;
+    };
+    #pragma pack(pop)
+
+    /// @brief Amostra dentro do quadro em lote (21 bytes)
+    #pragma pack(push, 1)
+    struct BatchSample {
+        uint16_t deltaUs;  ///< Intervalo desde a amostra anterior; 0 na primeira
+        uint8_t flags;
+        int16_t acc[3];
+        int16_t gyro[3];
+        int16_t pitch;
+        int16_t roll;
+        uint16_t pressure;
+    };
+    #pragma pack(pop)
+
+    static_assert(sizeof(BatchHeader) == 28, "BatchHeader deve ter 28 bytes");
+    static_assert(sizeof(BatchSample) == 21, "BatchSample deve ter 21 bytes");
+
+    /// @brief Amostras que cabem em um quadro ESP-NOW
+    constexpr size_t MAX_BATCH_SAMPLES =
+        (MAX_FRAME_BYTES - sizeof(BatchHeader)) / sizeof(BatchSample);
+
+    /**
+     * @brief Cabeçalho do quadro de fluxo (30 bytes)
+     *
+     * @details Seguido de @c count registros de tamanho variável. Os campos
+     * lentos são os da amostra mais recente do quadro, como no lote, e os
+     * três últimos levam o estado do controle de taxa (SensorData::radio).
+     */
+    #pragma pack(push, 1)
+    struct StreamHeader {
+        uint8_t version;
+        uint8_t flags;      ///< STREAM_KEYFRAME, status (STREAM_STATUS_SHIFT) e grupo de FEC (STREAM_FEC_SHIFT)
+        uint16_t sequence;  ///< Número de sequência do quadro; detecta perdas e repetições
+        uint8_t count;
+        int16_t temp;
+        uint16_t voltage;
+        int32_t latitude;
+        int32_t longitude;
+        int16_t gpsAltitude;
+        uint32_t utc;
+        uint16_t fixAge;
+        uint8_t hdop;
+        uint8_t satellites;
+        uint8_t frameInterval;  ///< Período entre quadros, em RADIO_INTERVAL_SCALE ms
+        uint8_t batchSize;
+        uint8_t deliveryPct;
+    };
+    #pragma pack(pop)
+
+    static_assert(sizeof(StreamHeader) == 30, "StreamHeader deve ter 30 bytes");
+
+    /**
+     * @brief Relatório de enlace da Base ao foguete (12 bytes)
+     *
+     * @details Contadores acumulados do LinkMonitor da Base. Os quadros de
+     * fluxo vão a um endereço de grupo, sem ACK do rádio, então só a Base
+     * sabe quantos chegaram; o foguete ajusta a taxa pela diferença entre
+     * dois relatórios.
+     */
+    #pragma pack(push, 1)
+    struct LinkReport {
+        uint8_t version;
+        uint8_t reserved;
+        uint16_t lastSequence;  ///< Último quadro de fluxo recebido
+        uint32_t received;      ///< Quadros de fluxo distintos recebidos
+        uint32_t lost;          ///< Quadros de fluxo perdidos
+    };
+    #pragma pack(pop)
+
+    static_assert(sizeof(LinkReport) == 12, "LinkReport deve ter 12 bytes");
+
+    /// @brief Campos quantizados de um registro: acc[3], gyro[3], pitch, roll, pressure
+    constexpr size_t STREAM_FIELDS = 9U;
+
+    /// @brief Menor registro do fluxo: um byte por campo, timestamp e fase
+    constexpr size_t MIN_STREAM_RECORD = STREAM_FIELDS + 2U;
+
+    /// @brief Maior número de amostras em qualquer quadro (fluxo ou lote)
+    constexpr size_t MAX_FRAME_SAMPLES =
+        (MAX_FRAME_BYTES - sizeof(StreamHeader)) / MIN_STREAM_RECORD;
+
+    static_assert(MAX_FRAME_SAMPLES >= MAX_BATCH_SAMPLES, "MAX_FRAME_SAMPLES cobre o lote");
+
+    /**
+     * @brief Maior quadro de fluxo com FEC em grupos de @p fecGroup
+     *
+     * @details A paridade carrega o tamanho de cada quadro do grupo e o
+     * XOR do maior deles, e também precisa caber em MAX_FRAME_BYTES.
+     */
+    constexpr size_t maxStreamBytes(uint8_t fecGroup)
+    {
+        return fecGroup ? MAX_FRAME_BYTES - PARITY_HEADER_BYTES - fecGroup : MAX_FRAME_BYTES;
+    }
+
+    /// @brief Estado compartilhado por codificador e decodificador
+    struct StreamState {
+        bool valid;         ///< false até a primeira amostra depois de um keyframe
+        uint32_t timestampUs;
+        int32_t deltaUs;
+        uint8_t flags;
+        int32_t fields[STREAM_FIELDS];
+    };
+
+    /**
+     * @brief Compressor do fluxo de telemetria (lado do foguete)
+     */
+    class StreamEncoder
+    {
+    public:
+        /**
+         * @param keyframeInterval Quadros entre keyframes (1 = todos são keyframes)
+         * @param fecGroup Quadros por grupo de paridade (0 = sem FEC; senão
+         * potência de 2 até MAX_FEC_GROUP); limita o tamanho do quadro
+         */
+        explicit StreamEncoder(uint16_t keyframeInterval, uint8_t fecGroup = 0);
+
+        /**
+         * @brief Comprime amostras em um quadro, da mais antiga para a mais nova
+         *
+         * @details Para quando o próximo registro não cabe em maxStreamBytes();
+         * as amostras restantes devem ir no quadro seguinte, em ordem.
+         * @param samples Amostras em ordem cronológica
+         * @param count Número de amostras
+         * @param frame Destino, com ao menos MAX_FRAME_BYTES bytes
+         * @param packed Quantas das amostras (as primeiras) entraram no quadro
+         * @return Tamanho do quadro em bytes; 0 se @p count for 0
+         */
+        size_t encode(const SensorData *samples, size_t count, uint8_t *frame, size_t &packed);
+
+        /// @brief Faz o próximo quadro ser um keyframe (ex.: após falha de envio)
+        void forceKeyframe() { forceKeyframe_ = true; }
+
+    private:
+        const uint16_t keyframeInterval_;
+        const uint8_t fecGroup_;
+        uint16_t sequence_ = 0;
+        uint16_t sinceKeyframe_ = 0;
+        bool forceKeyframe_ = true;
+        StreamState state_ = {};
+    };
+
+    /**
+     * @brief Descompressor do fluxo de telemetria (lado da Base)
+     *
+     * @details Também aceita quadros em lote e pacotes avulsos, que não
+     * alteram o estado do fluxo.
+     */
+    class StreamDecoder
+    {
+    public:
+        /**
+         * @brief Decodifica um quadro recebido
+         *
+         * @param bytes Dados recebidos
+         * @param len Tamanho recebido
+         * @param out Amostras reconstruídas, em ordem cronológica
+         * @param max Capacidade de @p out
+         * @return Número de amostras; 0 se o quadro for inválido, repetido
+         * ou não puder ser decodificado antes do próximo keyframe
+         */
+        size_t decode(const uint8_t *bytes, size_t len, SensorData *out, size_t max);
+
+        /// @brief Quadros descartados por falta de sincronismo (perda anterior)
+        uint32_t skipped() const { return skipped_; }
+
+    private:
+        bool synced_ = false;
+        uint16_t nextSequence_ = 0;
+        uint32_t skipped_ = 0;
+        StreamState state_ = {};
+    };
+
+    /**
+     * @brief Quantiza e empacota uma leitura
+     *
+     * @details Valores fora da faixa de cada campo são saturados.
+     * @param data Leitura completa
+     * @param out Pacote pronto para envio
+     */
+    void encode(const SensorData &data, PacketV2 &out);
+
+    /**
+     * @brief Desempacota um pacote recebido
+     *
+     * @param bytes Dados recebidos
+     * @param len Tamanho recebido
+     * @param out Leitura reconstruída; intocada em caso de erro
+     * @retval true Pacote v2 válido
+     * @retval false Tamanho ou versão incompatíveis
+     */
+    bool decode(const uint8_t *bytes, size_t len, SensorData &out);
+
+    /**
+     * @brief Empacota as amostras mais recentes em um quadro em lote
+     *
+     * @details Percorre @p samples da mais nova para a mais antiga e para
+     * ao atingir MAX_BATCH_SAMPLES ou um intervalo maior que 65535 µs.
+     * @param samples Amostras em ordem cronológica
+     * @param count Número de amostras
+     * @param frame Destino, com ao menos MAX_FRAME_BYTES bytes
+     * @param packed Quantas das amostras (as últimas) entraram no quadro
+     * @return Tamanho do quadro em bytes; 0 se @p count for 0
+     */
+    size_t encodeBatch(const SensorData *samples, size_t count, uint8_t *frame, size_t &packed);
+
+    /**
+     * @brief Desempacota um quadro em lote ou um PacketV2
+     *
+     * @param bytes Dados recebidos
+     * @param len Tamanho recebido
+     * @param out Amostras reconstruídas, em ordem cronológica
+     * @param max Capacidade de @p out
+     * @return Número de amostras; 0 se o quadro for inválido
+     */
+    size_t decodeBatch(const uint8_t *bytes, size_t len, SensorData *out, size_t max);
+
+    /**
+     * @brief Lê o número de sequência de um quadro sem decodificá-lo
+     * @retval false Quadro sem número de sequência (v2, v3) ou truncado
+     */
+    bool sequenceOf(const uint8_t *bytes, size_t len, uint16_t &sequence);
+
+    /**
+     * @brief Lê um relatório de enlace
+     * @retval false Outra mensagem, versão ou tamanho incompatíveis
+     */
+    bool decodeLinkReport(const uint8_t *bytes, size_t len, LinkReport &out);
+
+    /**
+     * @brief Compacta data e hora UTC em 32 bits
+     *
+     * @details Do bit mais significativo ao menos: ano - 2000 (6 bits),
+     * mês (4), dia (5), hora (5), minuto (6), segundo (6). Zero indica
+     * data desconhecida.
+     */
+    uint32_t packUtc(const GPSData &gps);
+
+    /// @brief Operação inversa de packUtc()
+    void unpackUtc(uint32_t utc, GPSData &gps);
+
+    /**
+     * @brief Nome legível de uma fase de voo
+     * @param phase Valor de SensorData::phase (ordem de FlightPhase)
+     */
+    const char *phaseName(uint8_t phase);
+}
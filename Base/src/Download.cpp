@@ -0,0 +1,265 @@
+/**
+ * @file Download.cpp
+ * @brief Implementação da recepção do arquivo de voo
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * O Transfer::Receiver e o arquivo pertencem à tarefa da transferência.
+ * O callback do ESP-NOW produz na fila e anota o endereço do foguete;
+ * as páginas só leem a cópia da situação, protegida por um mutex. O
+ * registro do foguete como peer é disputado pela tarefa e pelo loop()
+ * (sendToRocket()) e tem um mutex próprio.
+ */
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <esp_now.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <string.h>
+
+#include "Config.h"
+#include "Download.h"
+#include "Log.h"
+#include "SpscQueue.h"
+
+namespace Download
+{
+    namespace
+    {
+        /// @brief INFO ou DATA recebido do foguete
+        struct Message {
+            uint8_t length;
+            uint8_t data[Transfer::MAX_MESSAGE_BYTES];
+        };
+
+        SpscQueue<Message, Config::Download::QUEUE_DEPTH> inbox;
+        TaskHandle_t taskHandle = nullptr;
+
+        /// @brief Endereço do foguete; escrito uma vez pelo callback antes de rocketKnown
+        uint8_t rocketMac[6];
+        std::atomic<bool> rocketKnown{false};
+
+        /// @brief Pedido das páginas, atendido pela tarefa
+        std::atomic<bool> requested{false};
+
+        /// @brief Arquivo recebido; usado apenas pela tarefa
+        File file;
+        uint32_t startUs = 0;
+        uint32_t endUs = 0;
+
+        SemaphoreHandle_t statusLock = nullptr;
+        Status published = {};
+
+        /// @brief Protege peerAdded e o registro no ESP-NOW
+        SemaphoreHandle_t peerLock = nullptr;
+        bool peerAdded = false;
+
+        bool sendMessage(const uint8_t *message, size_t len, void *)
+        {
+            return esp_now_send(rocketMac, message, len) == ESP_OK;
+        }
+
+        bool openFile(const char *name, uint32_t size, void *)
+        {
+            if (file) file.close();
+            LittleFS.remove(Config::Download::FILE_NAME);
+            if (size > LittleFS.totalBytes() - LittleFS.usedBytes()) {
+                LOG_WARN("Download: sem espaco para %s (%lu bytes)", name, (unsigned long)size);
+                return false;
+            }
+            file = LittleFS.open(Config::Download::FILE_NAME, FILE_WRITE);
+            startUs = micros();
+            LOG_INFO("Download: recebendo %s (%lu bytes)", name, (unsigned long)size);
+            return static_cast<bool>(file);
+        }
+
+        bool writeFile(const uint8_t *data, size_t len, void *)
+        {
+            return file.write(data, len) == len;
+        }
+
+        Transfer::Receiver transfer(sendMessage, openFile, writeFile, nullptr,
+                                    Config::Download::RETRY_TIMEOUT * 1000UL,
+                                    Config::Download::IDLE_TIMEOUT * 1000UL);
+
+        bool busy()
+        {
+            return transfer.state() == Transfer::Receiver::REQUESTING ||
+                   transfer.state() == Transfer::Receiver::RECEIVING;
+        }
+
+        /**
+         * @brief Registra o foguete como peer, na interface STA (a que ele endereça)
+         *
+         * @details Uma vez só, sob peerLock: sem ele a tarefa e o loop()
+         * podem ver ambos o peer ausente e o segundo esp_now_add_peer()
+         * falharia com ESP_ERR_ESPNOW_EXIST, tratado aqui como sucesso.
+         */
+        bool addPeer()
+        {
+            if (peerLock == nullptr) return false;
+            xSemaphoreTake(peerLock, portMAX_DELAY);
+            if (!peerAdded) {
+                esp_now_peer_info_t peer = {};
+                memcpy(peer.peer_addr, rocketMac, 6);
+                peer.channel = Config::EspNow::CHANNEL;
+                peer.ifidx = WIFI_IF_STA;
+                peer.encrypt = false;
+                const esp_err_t result = esp_now_add_peer(&peer);
+                peerAdded = result == ESP_OK || result == ESP_ERR_ESPNOW_EXIST;
+            }
+            const bool added = peerAdded;
+            xSemaphoreGive(peerLock);
+            return added;
+        }
+
+        void publish(uint32_t nowUs)
+        {
+            Status s;
+            s.state = transfer.state();
+            s.answer = transfer.status();
+            strncpy(s.name, transfer.name(), sizeof(s.name));
+            s.name[sizeof(s.name) - 1] = '\0';
+            s.size = transfer.size();
+            s.written = transfer.written();
+            s.elapsedMs = startUs == 0 ? 0 : ((endUs != 0 ? endUs : nowUs) - startUs) / 1000U;
+            s.stats = transfer.stats();
+            s.queueDrops = inbox.dropped();
+
+            xSemaphoreTake(statusLock, portMAX_DELAY);
+            published = s;
+            xSemaphoreGive(statusLock);
+        }
+
+        /**
+         * @brief Tarefa da transferência
+         *
+         * @details Sem transferência, dorme até um pedido; com ela, acorda
+         * a cada mensagem ou a cada Config::Download::POLL_INTERVAL.
+         */
+        void downloadTask(void *)
+        {
+            for (;;) {
+                ulTaskNotifyTake(pdTRUE, busy() ? pdMS_TO_TICKS(Config::Download::POLL_INTERVAL)
+                                                : portMAX_DELAY);
+                const uint32_t nowUs = micros();
+                const Transfer::Receiver::State before = transfer.state();
+
+                if (requested.exchange(false)) {
+                    if (addPeer()) {
+                        startUs = 0;
+                        endUs = 0;
+                        transfer.request(nowUs);
+                    } else {
+                        LOG_ERROR("Download: falha ao adicionar o foguete como peer");
+                    }
+                }
+
+                Message message;
+                while (inbox.pop(message)) transfer.receive(message.data, message.length, nowUs);
+                transfer.poll(nowUs);
+
+                const Transfer::Receiver::State after = transfer.state();
+                if (after != before && (after == Transfer::Receiver::DONE || after == Transfer::Receiver::FAILED)) {
+                    if (file) file.close();
+                    endUs = nowUs;
+                    if (after == Transfer::Receiver::DONE) {
+                        LOG_INFO("Download: %s completo, %lu bytes", transfer.name(),
+                                 (unsigned long)transfer.written());
+                    } else {
+                        LOG_WARN("Download: falhou em %lu/%lu bytes (resposta %u)",
+                                 (unsigned long)transfer.written(), (unsigned long)transfer.size(),
+                                 (unsigned)transfer.status());
+                    }
+                }
+                publish(nowUs);
+            }
+        }
+    }
+
+    bool start()
+    {
+        if (!LittleFS.begin(true)) return false;
+        statusLock = xSemaphoreCreateMutex();
+        peerLock = xSemaphoreCreateMutex();
+        if (statusLock == nullptr || peerLock == nullptr) return false;
+        return xTaskCreatePinnedToCore(downloadTask, "download", Config::Download::TASK_STACK, nullptr,
+                                       Config::Download::TASK_PRIORITY, &taskHandle,
+                                       Config::Download::TASK_CORE) == pdPASS;
+    }
+
+    bool receive(const uint8_t *mac, const uint8_t *data, int len)
+    {
+        if (len <= 0 || !Transfer::isTransfer(data, static_cast<size_t>(len))) return false;
+        if (taskHandle == nullptr || len > static_cast<int>(Transfer::MAX_MESSAGE_BYTES)) return true;
+        if (!rocketKnown.load(std::memory_order_acquire) || memcmp(mac, rocketMac, 6) != 0) return true;
+
+        Message message;
+        message.length = static_cast<uint8_t>(len);
+        memcpy(message.data, data, static_cast<size_t>(len));
+        if (inbox.push(message)) xTaskNotifyGive(taskHandle);
+        return true;
+    }
+
+    void rocketSeen(const uint8_t *mac)
+    {
+        if (rocketKnown.load(std::memory_order_relaxed)) return;
+        memcpy(rocketMac, mac, 6);
+        rocketKnown.store(true, std::memory_order_release);
+    }
+
+    bool sendToRocket(const uint8_t *message, size_t len)
+    {
+        if (!rocketKnown.load(std::memory_order_acquire) || !addPeer()) return false;
+        return esp_now_send(rocketMac, message, len) == ESP_OK;
+    }
+
+    bool request()
+    {
+        if (taskHandle == nullptr || !rocketKnown.load(std::memory_order_acquire)) return false;
+        Status s;
+        status(s);
+        if (s.state == Transfer::Receiver::REQUESTING || s.state == Transfer::Receiver::RECEIVING) return false;
+
+        requested.store(true);
+        xTaskNotifyGive(taskHandle);
+        return true;
+    }
+
+    void status(Status &out)
+    {
+        if (statusLock == nullptr) {
+            out = Status();
+            return;
+        }
+        xSemaphoreTake(statusLock, portMAX_DELAY);
+        out = published;
+        xSemaphoreGive(statusLock);
+    }
+
+    const char *stateName(Transfer::Receiver::State state)
+    {
+        switch (state) {
+            case Transfer::Receiver::IDLE:       return "parado";
+            case Transfer::Receiver::REQUESTING: return "pedindo";
+            case Transfer::Receiver::RECEIVING:  return "recebendo";
+            case Transfer::Receiver::DONE:       return "completo";
+            case Transfer::Receiver::FAILED:     return "falhou";
+            default:                             return "?";
+        }
+    }
+
+    const char *answerName(Transfer::Status answer)
+    {
+        switch (answer) {
+            case Transfer::OK:      return "ok";
+            case Transfer::BUSY:    return "gravando";
+            case Transfer::NO_FILE: return "sem arquivo";
+            default:                return "?";
+        }
+    }
+}
@@ -0,0 +1,98 @@
+/**
+ * @file Events.cpp
+ * @brief Implementação do fluxo de eventos do painel
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * WiFiClient::write() insiste enquanto o socket não aceita os bytes, com
+ * esperas de select() de até 1 s a cada tentativa; um navegador parado
+ * travaria o loop(), o servidor HTTP e os eventos dos outros. Os eventos
+ * vão direto ao socket, sem esperar: o que não couber no buffer de envio
+ * do lwIP de uma vez derruba a conexão, e o navegador reconecta.
+ */
+
+#include <lwip/sockets.h>
+
+#include "Events.h"
+#include "Config.h"
+
+namespace Events
+{
+    namespace
+    {
+        /// @brief Conexões abertas; posição vazia ou fechada fica livre
+        WiFiClient connections[Config::Events::MAX_CLIENTS];
+
+        /// @brief Último envio a qualquer conexão (ms)
+        uint32_t lastSendMs = 0;
+
+        /// @retval false A conexão não aceitou o texto inteiro sem esperar
+        bool write(WiFiClient &client, const char *text, size_t len)
+        {
+            const int fd = client.fd();
+            if (fd < 0) return false;
+            // Parte de um evento já foi ao socket: a conexão não se recupera
+            return send(fd, text, len, MSG_DONTWAIT) == static_cast<ssize_t>(len);
+        }
+
+        /// @brief Escreve em todas as conexões, fechando as que falharem
+        void writeAll(const char *text, size_t len)
+        {
+            for (WiFiClient &client : connections) {
+                if (!client) continue;
+                if (!write(client, text, len)) client.stop();
+            }
+            lastSendMs = millis();
+        }
+    }
+
+    bool attach(WiFiClient client)
+    {
+        static const char HEADER[] =
+            "HTTP/1.1 200 OK\r\n"
+            "Content-Type: text/event-stream\r\n"
+            "Cache-Control: no-cache\r\n"
+            "Connection: keep-alive\r\n"
+            "\r\n"
+            "retry: 2000\n\n";  // Espera do navegador antes de reconectar (ms)
+
+        for (WiFiClient &slot : connections) {
+            if (slot) continue;
+            slot.stop();
+            slot = client;
+            // Eventos pequenos saem na hora, sem esperar completar um segmento
+            slot.setNoDelay(true);
+            if (!write(slot, HEADER, sizeof(HEADER) - 1)) {
+                slot.stop();
+                return false;
+            }
+            return true;
+        }
+        return false;
+    }
+
+    void broadcast(const String &data)
+    {
+        String event = "data: ";
+        event.reserve(data.length() + 8U);
+        event += data;
+        event += "\n\n";
+        writeAll(event.c_str(), event.length());
+    }
+
+    void keepAlive(uint32_t nowMs)
+    {
+        if (nowMs - lastSendMs < Config::Events::KEEPALIVE_INTERVAL) return;
+        static const char COMMENT[] = ":\n\n";
+        writeAll(COMMENT, sizeof(COMMENT) - 1);
+    }
+
+    size_t clients()
+    {
+        size_t count = 0;
+        for (WiFiClient &client : connections) {
+            if (client) count++;
+        }
+        return count;
+    }
+}
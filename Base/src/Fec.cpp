@@ -0,0 +1,208 @@
+/**
+ * @file Fec.cpp
+ * @brief Implementação da paridade XOR entre quadros de telemetria
+ * @version 1.0
+ * @date Outubro/2026
+ */
+
+#include <string.h>
+
+#include "Fec.h"
+
+namespace Telemetry
+{
+    namespace
+    {
+        /// @brief Tamanhos de grupo aceitos: potência de 2 entre 2 e MAX_FEC_GROUP
+        inline bool validGroup(uint8_t group)
+        {
+            return group >= 2 && group <= MAX_FEC_GROUP && (group & (group - 1)) == 0;
+        }
+
+        inline uint8_t fullMask(uint8_t group)
+        {
+            return static_cast<uint8_t>((1U << group) - 1U);
+        }
+    }
+
+    FecEncoder::FecEncoder(uint8_t group)
+        : group_(validGroup(group) ? group : 0)
+    {
+    }
+
+    bool FecEncoder::add(const uint8_t *frame, size_t len, uint8_t *parity, size_t &parityLen)
+    {
+        parityLen = 0;
+        uint16_t sequence;
+        if (group_ == 0 || len > maxStreamBytes(group_) || !sequenceOf(frame, len, sequence))
+            return false;
+
+        const uint8_t index = static_cast<uint8_t>(sequence & (group_ - 1));
+        const uint16_t first = static_cast<uint16_t>(sequence - index);
+        if (index == 0 || first != firstSequence_) {
+            firstSequence_ = first;
+            seen_ = 0;
+            maxLength_ = 0;
+            memset(lengths_, 0, sizeof(lengths_));
+            memset(accumulator_, 0, sizeof(accumulator_));
+        }
+
+        for (size_t i = 0; i < len; i++)
+            accumulator_[i] ^= frame[i];
+        lengths_[index] = static_cast<uint8_t>(len);
+        if (len > maxLength_) maxLength_ = static_cast<uint8_t>(len);
+        seen_ |= static_cast<uint8_t>(1U << index);
+
+        if (seen_ != fullMask(group_)) return false;
+        seen_ = 0;
+
+        parity[0] = PARITY_VERSION;
+        parity[1] = group_;
+        memcpy(parity + 2, &firstSequence_, sizeof(firstSequence_));
+        memcpy(parity + PARITY_HEADER_BYTES, lengths_, group_);
+        memcpy(parity + PARITY_HEADER_BYTES + group_, accumulator_, maxLength_);
+        parityLen = PARITY_HEADER_BYTES + group_ + maxLength_;
+        return true;
+    }
+
+    FecDecoder::FecDecoder(Sink sink, void *context)
+        : sink_(sink), context_(context)
+    {
+    }
+
+    void FecDecoder::push(const uint8_t *frame, size_t len)
+    {
+        if (len == 0) return;
+
+        if (frame[0] == PARITY_VERSION) {
+            if (len < PARITY_HEADER_BYTES) return;
+            const uint8_t group = frame[1];
+            uint16_t first;
+            memcpy(&first, frame + 2, sizeof(first));
+            if (!validGroup(group) || len < PARITY_HEADER_BYTES + group) return;
+            stats_.parity++;
+
+            if (!active_ || compare(first) > 0) {
+                flush();
+                begin(first, group);
+            } else if (compare(first) < 0 || group != group_) {
+                return;  // Paridade de um grupo já encerrado
+            }
+
+            recover(frame, len);
+            flush();  // A paridade fecha o grupo
+            return;
+        }
+
+        StreamHeader header;
+        if (frame[0] != STREAM_VERSION || len < sizeof(header) || len > MAX_FRAME_BYTES) {
+            sink_(frame, len, context_);
+            return;
+        }
+        memcpy(&header, frame, sizeof(header));
+        const uint8_t group = static_cast<uint8_t>(header.flags >> STREAM_FEC_SHIFT);
+        if (!validGroup(group)) {
+            sink_(frame, len, context_);
+            return;
+        }
+
+        const uint8_t index = static_cast<uint8_t>(header.sequence & (group - 1));
+        const uint16_t first = static_cast<uint16_t>(header.sequence - index);
+        if (!active_ || group != group_ || compare(first) > 0) {
+            flush();
+            begin(first, group);
+        } else if (compare(first) < 0) {
+            sink_(frame, len, context_);  // Atrasado demais para reter
+            return;
+        }
+
+        const uint8_t bit = static_cast<uint8_t>(1U << index);
+        if (present_ & bit) return;  // Repetido
+        if (index < next_) {
+            sink_(frame, len, context_);  // Já dado como perdido
+            return;
+        }
+
+        memcpy(frames_[index], frame, len);
+        lengths_[index] = static_cast<uint8_t>(len);
+        present_ |= bit;
+        release(index);
+    }
+
+    void FecDecoder::flush()
+    {
+        if (!active_) return;
+        while (next_ < group_) {
+            if (present_ & (1U << next_)) {
+                stats_.delayed++;
+                sink_(frames_[next_], lengths_[next_], context_);
+            } else {
+                stats_.unrecoverable++;
+            }
+            next_++;
+        }
+    }
+
+    void FecDecoder::reset()
+    {
+        flush();
+        active_ = false;
+    }
+
+    void FecDecoder::begin(uint16_t firstSequence, uint8_t group)
+    {
+        active_ = true;
+        firstSequence_ = firstSequence;
+        group_ = group;
+        present_ = 0;
+        next_ = 0;
+    }
+
+    void FecDecoder::release(uint8_t arrived)
+    {
+        while (next_ < group_ && (present_ & (1U << next_))) {
+            if (next_ != arrived) stats_.delayed++;
+            sink_(frames_[next_], lengths_[next_], context_);
+            next_++;
+        }
+    }
+
+    void FecDecoder::recover(const uint8_t *parity, size_t len)
+    {
+        if (next_ >= group_) return;
+
+        const uint8_t missing = static_cast<uint8_t>(~present_ & fullMask(group_));
+        if (missing == 0 || (missing & (missing - 1)) != 0) return;  // Nenhum ou mais de um
+
+        uint8_t index = 0;
+        while (!(missing & (1U << index))) index++;
+
+        const uint8_t *lengths = parity + PARITY_HEADER_BYTES;
+        const uint8_t *payload = lengths + group_;
+        const size_t payloadLen = len - PARITY_HEADER_BYTES - group_;
+        const uint8_t length = lengths[index];
+        if (length < sizeof(StreamHeader) || length > payloadLen) return;
+        for (uint8_t j = 0; j < group_; j++) {
+            if (j != index && lengths[j] != lengths_[j]) return;  // Paridade de outro grupo
+        }
+
+        uint8_t *out = frames_[index];
+        memcpy(out, payload, length);
+        for (uint8_t j = 0; j < group_; j++) {
+            if (j == index) continue;
+            const uint8_t n = lengths_[j] < length ? lengths_[j] : length;
+            for (uint8_t b = 0; b < n; b++)
+                out[b] ^= frames_[j][b];
+        }
+
+        lengths_[index] = length;
+        present_ |= missing;
+        stats_.recovered++;
+        release(index);
+    }
+
+    int32_t FecDecoder::compare(uint16_t firstSequence) const
+    {
+        return static_cast<int16_t>(firstSequence - firstSequence_);
+    }
+}
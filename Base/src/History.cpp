@@ -0,0 +1,109 @@
+/**
+ * @file History.cpp
+ * @brief Implementação do histórico circular de amostras
+ * @version 1.1
+ * @date Outubro/2026
+ */
+
+#include <atomic>
+
+#include "History.h"
+#include "Config.h"
+#include "SeqLock.h"
+
+namespace History
+{
+    namespace
+    {
+        constexpr size_t DEPTH = Config::History::DEPTH;
+        constexpr size_t MASK = DEPTH - 1;
+        static_assert(DEPTH >= 2 && (DEPTH & MASK) == 0, "DEPTH deve ser potencia de 2");
+
+        /// @brief Amostra com o número que a identifica
+        struct Entry {
+            uint32_t sequence;
+            SensorData sample;
+        };
+
+        /// @brief Posições do anel; a amostra n vai em n & MASK
+        SeqLock<Entry> entries[DEPTH];
+
+        /// @brief Amostras escritas desde o início; a próxima recebe este número
+        std::atomic<uint32_t> written{0};
+
+        /// @retval true @p a é posterior ou igual a @p b, mesmo com a volta do contador
+        bool notBefore(uint32_t a, uint32_t b)
+        {
+            return static_cast<int32_t>(a - b) >= 0;
+        }
+    }
+
+    void push(const SensorData &sample)
+    {
+        const uint32_t sequence = written.load(std::memory_order_relaxed);
+        Entry entry;
+        entry.sequence = sequence;
+        entry.sample = sample;
+        entries[sequence & MASK].store(entry);
+        written.store(sequence + 1U, std::memory_order_release);
+    }
+
+    size_t size()
+    {
+        const uint32_t count = total();
+        return count < DEPTH ? count : DEPTH;
+    }
+
+    uint32_t total()
+    {
+        return written.load(std::memory_order_acquire);
+    }
+
+    uint32_t oldest()
+    {
+        const uint32_t count = total();
+        return count < DEPTH ? 0U : count - static_cast<uint32_t>(DEPTH);
+    }
+
+    bool get(uint32_t sequence, SensorData &out)
+    {
+        if (sequence >= total()) return false;
+
+        // Uma sobrescrita em andamento é esperada; a seguinte muda o número
+        const Entry entry = entries[sequence & MASK].load();
+        if (entry.sequence != sequence) return false;
+
+        out = entry.sample;
+        return true;
+    }
+
+    bool at(size_t index, SensorData &out)
+    {
+        if (index >= size()) return false;
+        return get(oldest() + static_cast<uint32_t>(index), out);
+    }
+
+    uint32_t find(uint32_t timestampUs)
+    {
+        uint32_t low = oldest();
+        uint32_t high = total();
+
+        while (low < high) {
+            const uint32_t middle = low + (high - low) / 2U;
+            SensorData sample;
+            if (!get(middle, sample)) {
+                // Sobrescrita durante a busca: tudo até ela já saiu do anel
+                const uint32_t first = oldest();
+                low = first > middle ? first : middle + 1U;
+                if (high < low) high = low;
+                continue;
+            }
+            if (notBefore(sample.timestampUs, timestampUs)) {
+                high = middle;
+            } else {
+                low = middle + 1U;
+            }
+        }
+        return low;
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file LinkStats.cpp
+ * @brief Implementação da contabilidade de perdas do enlace
+ * @version 1.0
+ * @date Outubro/2026
+ */
+
+#include "LinkStats.h"
+
+LinkMonitor::LinkMonitor(uint16_t resyncGap)
+    : resyncGap_(resyncGap > WINDOW ? resyncGap : WINDOW)
+{
+}
+
+void LinkMonitor::record(uint16_t sequence)
+{
+    stats_.lastSequence = sequence;
+    if (!started_) {
+        started_ = true;
+        restart(sequence);
+        return;
+    }
+
+    // Diferença com sinal: trata a volta de 65535 para 0
+    const int16_t diff = static_cast<int16_t>(sequence - highest_);
+
+    if (diff == 0) {
+        stats_.duplicates++;
+        return;
+    }
+
+    const uint16_t distance = static_cast<uint16_t>(diff > 0 ? diff : -diff);
+    if (distance >= resyncGap_) {
+        stats_.resets++;
+        restart(sequence);
+        return;
+    }
+
+    if (diff > 0) {
+        burst(distance - 1U);
+        window_ = distance >= WINDOW ? 0 : window_ << distance;
+        window_ |= 1U;
+        highest_ = sequence;
+        stats_.received++;
+        return;
+    }
+
+    // Para trás além da janela, ou de volta ao começo: o foguete reiniciou
+    if (distance >= WINDOW || (sequence <= REWIND_SLACK && distance >= 2U * REWIND_SLACK)) {
+        stats_.resets++;
+        restart(sequence);
+        return;
+    }
+
+    // Quadro atrasado dentro da janela
+    const uint64_t bit = static_cast<uint64_t>(1) << distance;
+    if (window_ & bit) {
+        stats_.duplicates++;
+        return;
+    }
+    window_ |= bit;
+    stats_.reordered++;
+    stats_.received++;
+    if (stats_.lost > 0) stats_.lost--;
+}
+
+void LinkMonitor::reset()
+{
+    started_ = false;
+    window_ = 0;
+    stats_ = LinkStats();
+}
+
+float LinkMonitor::lossRatio() const
+{
+    const uint32_t expected = stats_.received + stats_.lost;
+    return expected ? static_cast<float>(stats_.lost) / static_cast<float>(expected) : 0.0f;
+}
+
+uint32_t LinkMonitor::burstBucketLimit(size_t bucket)
+{
+    return bucket + 1 < LINK_BURST_BUCKETS ? 1UL << bucket : 0;
+}
+
+void LinkMonitor::restart(uint16_t sequence)
+{
+    highest_ = sequence;
+    window_ = 1U;
+    stats_.received++;
+}
+
+void LinkMonitor::burst(uint32_t length)
+{
+    if (length == 0) return;
+
+    stats_.lost += length;
+    stats_.bursts++;
+    stats_.lastBurst = length;
+    if (length > stats_.maxBurst) stats_.maxBurst = length;
+
+    size_t bucket = 0;
+    while (bucket + 1 < LINK_BURST_BUCKETS && length > burstBucketLimit(bucket)) bucket++;
+    stats_.burstHistogram[bucket]++;
+}
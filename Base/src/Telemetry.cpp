@@ -0,0 +1,485 @@
+/**
+ * @file Telemetry.cpp
+ * @brief Implementação dos pacotes de telemetria (avulso v2, lote v3 e fluxo v4)
+ * @version 2.0
+ * @date Outubro/2026
+ */
+
+#include <math.h>
+#include <string.h>
+
+#include "Telemetry.h"
+
+namespace Telemetry
+{
+    namespace
+    {
+        /// @brief Arredonda e satura em [minimum, maximum]
+        int32_t quantize(float value, float scale, int32_t minimum, int32_t maximum)
+        {
+            float scaled = value / scale;
+            if (!(scaled > static_cast<float>(minimum))) return minimum;  // Inclui NaN
+            if (scaled >= static_cast<float>(maximum)) return maximum;
+            return static_cast<int32_t>(lroundf(scaled));
+        }
+
+        inline int16_t toInt16(float value, float scale)
+        {
+            return static_cast<int16_t>(quantize(value, scale, INT16_MIN, INT16_MAX));
+        }
+
+        inline uint16_t toUint16(float value, float scale)
+        {
+            return static_cast<uint16_t>(quantize(value, scale, 0, UINT16_MAX));
+        }
+
+        inline int32_t toCoordinate(double degrees)
+        {
+            return static_cast<int32_t>(llround(degrees / COORDINATE_SCALE));
+        }
+
+        inline uint16_t toPressure(float hPa)
+        {
+            // hPa -> Pa, deslocado para caber em 16 bits
+            return static_cast<uint16_t>(
+                quantize(hPa * 100.0f - static_cast<float>(PRESSURE_OFFSET_PA), 1.0f, 0, UINT16_MAX));
+        }
+
+        /**
+         * @name Campos comuns
+         * PacketV2, BatchHeader e BatchSample usam os mesmos nomes de
+         * campo; os modelos abaixo servem aos três.
+         * @{
+         */
+
+        /// @brief Campos rápidos: IMU, orientação e pressão
+        template <typename P>
+        void encodeMotion(const SensorData &data, P &out)
+        {
+            const AcelerometerData &imu = data.acelerometro;
+            out.acc[0] = toInt16(imu.accX, ACC_SCALE);
+            out.acc[1] = toInt16(imu.accY, ACC_SCALE);
+            out.acc[2] = toInt16(imu.accZ, ACC_SCALE);
+            out.gyro[0] = toInt16(imu.gyroX, GYRO_SCALE);
+            out.gyro[1] = toInt16(imu.gyroY, GYRO_SCALE);
+            out.gyro[2] = toInt16(imu.gyroZ, GYRO_SCALE);
+            out.pitch = toInt16(imu.pitch, ANGLE_SCALE);
+            out.roll = toInt16(imu.roll, ANGLE_SCALE);
+            out.pressure = toPressure(data.altimetro.pressure);
+        }
+
+        /// @brief Campos lentos: temperatura, tensão e GPS
+        template <typename P>
+        void encodeSlow(const SensorData &data, P &out)
+        {
+            out.temp = toInt16(data.acelerometro.temp, TEMP_SCALE);
+            out.voltage = toUint16(data.tensao.voltage_rocket, VOLTAGE_SCALE);
+
+            const GPSData &gps = data.gps;
+            out.latitude = toCoordinate(gps.latitude);
+            out.longitude = toCoordinate(gps.longitude);
+            out.gpsAltitude = toInt16(static_cast<float>(gps.altitude), GPS_ALTITUDE_SCALE);
+            out.utc = packUtc(gps);
+            out.fixAge = gps.fixAge >= NO_FIX ? NO_FIX : static_cast<uint16_t>(gps.fixAge);
+            out.hdop = static_cast<uint8_t>(quantize(gps.hdop, 0.1f, 0, UINT8_MAX));
+            out.satellites = gps.satellites;
+        }
+
+        template <typename P>
+        void decodeMotion(const P &packet, SensorData &out)
+        {
+            AcelerometerData &imu = out.acelerometro;
+            imu.accX = packet.acc[0] * ACC_SCALE;
+            imu.accY = packet.acc[1] * ACC_SCALE;
+            imu.accZ = packet.acc[2] * ACC_SCALE;
+            imu.gyroX = packet.gyro[0] * GYRO_SCALE;
+            imu.gyroY = packet.gyro[1] * GYRO_SCALE;
+            imu.gyroZ = packet.gyro[2] * GYRO_SCALE;
+            imu.pitch = packet.pitch * ANGLE_SCALE;
+            imu.roll = packet.roll * ANGLE_SCALE;
+
+            const float pressure = static_cast<float>(packet.pressure + PRESSURE_OFFSET_PA) * 0.01f;
+            out.altimetro.pressure = pressure;
+            out.altimetro.altitude = 44330.0f * (1.0f - powf(pressure / SEA_LEVEL_PRESSURE, 0.1903f));
+        }
+
+        template <typename P>
+        void decodeSlow(const P &packet, SensorData &out)
+        {
+            out.acelerometro.temp = packet.temp * TEMP_SCALE;
+            out.tensao.voltage_rocket = packet.voltage * VOLTAGE_SCALE;
+
+            GPSData &gps = out.gps;
+            gps.latitude = packet.latitude * COORDINATE_SCALE;
+            gps.longitude = packet.longitude * COORDINATE_SCALE;
+            gps.altitude = packet.gpsAltitude * GPS_ALTITUDE_SCALE;
+            unpackUtc(packet.utc, gps);
+            gps.fixAge = packet.fixAge == NO_FIX ? 0xFFFFFFFFUL : packet.fixAge;
+            gps.hdop = packet.hdop * 0.1f;
+            gps.satellites = packet.satellites;
+        }
+
+        /** @} */
+
+        /// @name Compressão do fluxo
+        /// @{
+
+        /// @brief Maior registro: timestamp e campos com varint de 5 bytes, mais a fase
+        constexpr size_t MAX_STREAM_RECORD = 5U * (STREAM_FIELDS + 1U) + 1U;
+
+        inline uint32_t zigzag(int32_t value)
+        {
+            return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+        }
+
+        inline int32_t unzigzag(uint32_t value)
+        {
+            return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1U);
+        }
+
+        /// @brief Grava 7 bits por byte, bit 7 indica continuação
+        inline uint8_t *putVarint(uint8_t *out, uint32_t value)
+        {
+            while (value >= 0x80U) {
+                *out++ = static_cast<uint8_t>(value | 0x80U);
+                value >>= 7;
+            }
+            *out++ = static_cast<uint8_t>(value);
+            return out;
+        }
+
+        inline bool getVarint(const uint8_t *&in, const uint8_t *end, uint32_t &value)
+        {
+            value = 0;
+            for (uint8_t shift = 0; shift < 35 && in < end; shift += 7) {
+                const uint8_t byte = *in++;
+                value |= static_cast<uint32_t>(byte & 0x7FU) << shift;
+                if ((byte & 0x80U) == 0) return true;
+            }
+            return false;
+        }
+
+        /// @brief Campos de um registro na ordem do fluxo
+        void toFields(const BatchSample &record, int32_t fields[STREAM_FIELDS])
+        {
+            fields[0] = record.acc[0];
+            fields[1] = record.acc[1];
+            fields[2] = record.acc[2];
+            fields[3] = record.gyro[0];
+            fields[4] = record.gyro[1];
+            fields[5] = record.gyro[2];
+            fields[6] = record.pitch;
+            fields[7] = record.roll;
+            fields[8] = record.pressure;
+        }
+
+        void fromFields(const int32_t fields[STREAM_FIELDS], BatchSample &record)
+        {
+            record.acc[0] = static_cast<int16_t>(fields[0]);
+            record.acc[1] = static_cast<int16_t>(fields[1]);
+            record.acc[2] = static_cast<int16_t>(fields[2]);
+            record.gyro[0] = static_cast<int16_t>(fields[3]);
+            record.gyro[1] = static_cast<int16_t>(fields[4]);
+            record.gyro[2] = static_cast<int16_t>(fields[5]);
+            record.pitch = static_cast<int16_t>(fields[6]);
+            record.roll = static_cast<int16_t>(fields[7]);
+            record.pressure = static_cast<uint16_t>(fields[8]);
+        }
+
+        /**
+         * @brief Comprime uma amostra em relação ao estado e o avança
+         * @return Fim do registro gravado em @p out
+         */
+        uint8_t *encodeRecord(const SensorData &sample, StreamState &state, uint8_t *out)
+        {
+            BatchSample record;
+            encodeMotion(sample, record);
+            int32_t fields[STREAM_FIELDS];
+            toFields(record, fields);
+            const uint8_t flags = sample.phase & FLAG_PHASE_MASK;
+
+            // Primeira amostra após keyframe: timestamp absoluto; depois,
+            // diferença de segunda ordem (zero enquanto o período for constante)
+            if (!state.valid) {
+                out = putVarint(out, sample.timestampUs);
+                state.deltaUs = 0;
+            } else {
+                const int32_t delta = static_cast<int32_t>(sample.timestampUs - state.timestampUs);
+                out = putVarint(out, zigzag(delta - state.deltaUs));
+                state.deltaUs = delta;
+            }
+            *out++ = flags ^ state.flags;
+            for (size_t i = 0; i < STREAM_FIELDS; i++) {
+                out = putVarint(out, zigzag(fields[i] - state.fields[i]));
+                state.fields[i] = fields[i];
+            }
+
+            state.timestampUs = sample.timestampUs;
+            state.flags = flags;
+            state.valid = true;
+            return out;
+        }
+
+        /// @brief Operação inversa de encodeRecord(); false se o registro estiver truncado
+        bool decodeRecord(const uint8_t *&in, const uint8_t *end, StreamState &state, SensorData &out)
+        {
+            uint32_t value;
+            if (!getVarint(in, end, value)) return false;
+            if (!state.valid) {
+                state.timestampUs = value;
+                state.deltaUs = 0;
+            } else {
+                state.deltaUs += unzigzag(value);
+                state.timestampUs += static_cast<uint32_t>(state.deltaUs);
+            }
+
+            if (in >= end) return false;
+            state.flags ^= *in++;
+            for (size_t i = 0; i < STREAM_FIELDS; i++) {
+                if (!getVarint(in, end, value)) return false;
+                state.fields[i] += unzigzag(value);
+            }
+            state.valid = true;
+
+            BatchSample record;
+            fromFields(state.fields, record);
+            decodeMotion(record, out);
+            out.timestampUs = state.timestampUs;
+            out.phase = state.flags & FLAG_PHASE_MASK;
+            return true;
+        }
+
+        /// @}
+    }
+
+    void encode(const SensorData &data, PacketV2 &out)
+    {
+        out.version = PACKET_VERSION;
+        out.flags = data.phase & FLAG_PHASE_MASK;
+        out.timestampUs = data.timestampUs;
+        encodeMotion(data, out);
+        encodeSlow(data, out);
+    }
+
+    bool decode(const uint8_t *bytes, size_t len, SensorData &out)
+    {
+        if (len != sizeof(PacketV2) || bytes[0] != PACKET_VERSION) return false;
+
+        PacketV2 packet;
+        memcpy(&packet, bytes, sizeof(packet));
+
+        decodeMotion(packet, out);
+        decodeSlow(packet, out);
+        out.timestampUs = packet.timestampUs;
+        out.phase = packet.flags & FLAG_PHASE_MASK;
+        return true;
+    }
+
+    size_t encodeBatch(const SensorData *samples, size_t count, uint8_t *frame, size_t &packed)
+    {
+        packed = 0;
+        if (count == 0) return 0;
+
+        // Da mais nova para trás, enquanto couber e o intervalo for representável
+        size_t first = count - 1;
+        while (count - first < MAX_BATCH_SAMPLES && first > 0 &&
+               samples[first].timestampUs - samples[first - 1].timestampUs <= UINT16_MAX) {
+            first--;
+        }
+        packed = count - first;
+
+        BatchHeader header;
+        header.version = BATCH_VERSION;
+        header.count = static_cast<uint8_t>(packed);
+        header.timestampUs = samples[first].timestampUs;
+        encodeSlow(samples[count - 1], header);
+        memcpy(frame, &header, sizeof(header));
+
+        uint8_t *cursor = frame + sizeof(header);
+        for (size_t i = first; i < count; i++) {
+            BatchSample record;
+            record.deltaUs = i == first ? 0
+                : static_cast<uint16_t>(samples[i].timestampUs - samples[i - 1].timestampUs);
+            record.flags = samples[i].phase & FLAG_PHASE_MASK;
+            encodeMotion(samples[i], record);
+            memcpy(cursor, &record, sizeof(record));
+            cursor += sizeof(record);
+        }
+        return static_cast<size_t>(cursor - frame);
+    }
+
+    size_t decodeBatch(const uint8_t *bytes, size_t len, SensorData *out, size_t max)
+    {
+        if (len == 0 || max == 0) return 0;
+        if (bytes[0] == PACKET_VERSION) return decode(bytes, len, out[0]) ? 1 : 0;
+        if (bytes[0] != BATCH_VERSION || len < sizeof(BatchHeader)) return 0;
+
+        BatchHeader header;
+        memcpy(&header, bytes, sizeof(header));
+        if (header.count == 0 || header.count > max ||
+            len != sizeof(BatchHeader) + header.count * sizeof(BatchSample)) {
+            return 0;
+        }
+
+        const uint8_t *cursor = bytes + sizeof(header);
+        uint32_t timestampUs = header.timestampUs;
+        for (size_t i = 0; i < header.count; i++) {
+            BatchSample record;
+            memcpy(&record, cursor, sizeof(record));
+            cursor += sizeof(record);
+
+            timestampUs += record.deltaUs;
+            out[i].timestampUs = timestampUs;
+            out[i].phase = record.flags & FLAG_PHASE_MASK;
+            decodeMotion(record, out[i]);
+            decodeSlow(header, out[i]);
+        }
+        return header.count;
+    }
+
+    bool sequenceOf(const uint8_t *bytes, size_t len, uint16_t &sequence)
+    {
+        if (len < sizeof(StreamHeader) || bytes[0] != STREAM_VERSION) return false;
+
+        StreamHeader header;
+        memcpy(&header, bytes, sizeof(header));
+        sequence = header.sequence;
+        return true;
+    }
+
+    bool decodeLinkReport(const uint8_t *bytes, size_t len, LinkReport &out)
+    {
+        if (len != sizeof(LinkReport) || bytes[0] != LINK_REPORT_VERSION) return false;
+        memcpy(&out, bytes, sizeof(out));
+        return true;
+    }
+
+    StreamEncoder::StreamEncoder(uint16_t keyframeInterval, uint8_t fecGroup)
+        : keyframeInterval_(keyframeInterval > 0 ? keyframeInterval : 1),
+          fecGroup_(fecGroup >= 2 && fecGroup <= MAX_FEC_GROUP && (fecGroup & (fecGroup - 1)) == 0 ? fecGroup : 0)
+    {
+    }
+
+    size_t StreamEncoder::encode(const SensorData *samples, size_t count, uint8_t *frame, size_t &packed)
+    {
+        packed = 0;
+        if (count == 0) return 0;
+
+        const bool keyframe = forceKeyframe_ || sinceKeyframe_ >= keyframeInterval_;
+        if (keyframe) {
+            state_ = StreamState();
+            sinceKeyframe_ = 0;
+            forceKeyframe_ = false;
+        }
+
+        uint8_t *cursor = frame + sizeof(StreamHeader);
+        const uint8_t *end = frame + maxStreamBytes(fecGroup_);
+        while (packed < count && packed < MAX_FRAME_SAMPLES) {
+            // Só confirma o estado se o registro couber inteiro
+            uint8_t record[MAX_STREAM_RECORD];
+            StreamState next = state_;
+            const size_t length = static_cast<size_t>(encodeRecord(samples[packed], next, record) - record);
+            if (cursor + length > end) break;
+
+            memcpy(cursor, record, length);
+            cursor += length;
+            state_ = next;
+            packed++;
+        }
+
+        StreamHeader header;
+        header.version = STREAM_VERSION;
+        header.flags = static_cast<uint8_t>((keyframe ? STREAM_KEYFRAME : 0) |
+                                            ((samples[packed - 1].status & STATUS_MASK) << STREAM_STATUS_SHIFT) |
+                                            (fecGroup_ << STREAM_FEC_SHIFT));
+        header.sequence = sequence_++;
+        header.count = static_cast<uint8_t>(packed);
+        encodeSlow(samples[packed - 1], header);
+        const RadioData &radio = samples[packed - 1].radio;
+        const uint32_t interval = (radio.frameIntervalMs + RADIO_INTERVAL_SCALE / 2U) / RADIO_INTERVAL_SCALE;
+        header.frameInterval = static_cast<uint8_t>(interval > UINT8_MAX ? UINT8_MAX : interval);
+        header.batchSize = radio.batchSize;
+        header.deliveryPct = radio.deliveryPct;
+        memcpy(frame, &header, sizeof(header));
+
+        sinceKeyframe_++;
+        return static_cast<size_t>(cursor - frame);
+    }
+
+    size_t StreamDecoder::decode(const uint8_t *bytes, size_t len, SensorData *out, size_t max)
+    {
+        if (len == 0 || max == 0) return 0;
+        if (bytes[0] != STREAM_VERSION) return decodeBatch(bytes, len, out, max);
+        if (len < sizeof(StreamHeader)) return 0;
+
+        StreamHeader header;
+        memcpy(&header, bytes, sizeof(header));
+        if (header.count == 0 || header.count > max) return 0;
+
+        if (header.flags & STREAM_KEYFRAME) {
+            state_ = StreamState();
+            synced_ = true;
+        } else if (synced_ && header.sequence == static_cast<uint16_t>(nextSequence_ - 1)) {
+            return 0;  // Repetido: já decodificado, o estado segue válido
+        } else if (!synced_ || header.sequence != nextSequence_) {
+            synced_ = false;
+            skipped_++;
+            return 0;
+        }
+
+        const uint8_t *cursor = bytes + sizeof(header);
+        const uint8_t *end = bytes + len;
+        for (size_t i = 0; i < header.count; i++) {
+            if (!decodeRecord(cursor, end, state_, out[i])) {
+                synced_ = false;
+                return 0;
+            }
+            decodeSlow(header, out[i]);
+            out[i].radio.frameIntervalMs = static_cast<uint16_t>(header.frameInterval * RADIO_INTERVAL_SCALE);
+            out[i].radio.batchSize = header.batchSize;
+            out[i].radio.deliveryPct = header.deliveryPct;
+            out[i].status = (header.flags >> STREAM_STATUS_SHIFT) & STATUS_MASK;
+        }
+        if (cursor != end) {
+            synced_ = false;
+            return 0;
+        }
+
+        nextSequence_ = static_cast<uint16_t>(header.sequence + 1);
+        return header.count;
+    }
+
+    uint32_t packUtc(const GPSData &gps)
+    {
+        if (gps.year < 2000 || gps.year > 2063 || gps.month < 1 || gps.month > 12) return 0;
+        return (static_cast<uint32_t>(gps.year - 2000) << 26) |
+               (static_cast<uint32_t>(gps.month & 0x0F) << 22) |
+               (static_cast<uint32_t>(gps.day & 0x1F) << 17) |
+               (static_cast<uint32_t>(gps.hour & 0x1F) << 12) |
+               (static_cast<uint32_t>(gps.minute & 0x3F) << 6) |
+               static_cast<uint32_t>(gps.second & 0x3F);
+    }
+
+    void unpackUtc(uint32_t utc, GPSData &gps)
+    {
+        if (utc == 0) {
+            gps.year = gps.month = gps.day = 0;
+            gps.hour = gps.minute = gps.second = 0;
+            return;
+        }
+        gps.year = 2000 + static_cast<int>(utc >> 26);
+        gps.month = static_cast<int>((utc >> 22) & 0x0F);
+        gps.day = static_cast<int>((utc >> 17) & 0x1F);
+        gps.hour = static_cast<int>((utc >> 12) & 0x1F);
+        gps.minute = static_cast<int>((utc >> 6) & 0x3F);
+        gps.second = static_cast<int>(utc & 0x3F);
+    }
+
+    const char *phaseName(uint8_t phase)
+    {
+        static const char *const NAMES[] = {
+            "rampa", "propulsao", "voo livre", "apogeu", "descida", "pouso"
+        };
+        return phase < sizeof(NAMES) / sizeof(NAMES[0]) ? NAMES[phase] : "?";
+    }
+}
@@ -0,0 +1,368 @@
+/**
+ * @file Transfer.cpp
+ * @brief Implementação da transferência do arquivo de voo
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * O pedaço c ocupa a posição c % MAX_WINDOW tanto na janela do foguete
+ * quanto no buffer de reordenação da Base; como a janela nunca passa de
+ * MAX_WINDOW pedaços, duas posições nunca se sobrepõem.
+ */
+
+#include <string.h>
+
+#include "Transfer.h"
+
+namespace Transfer
+{
+    namespace
+    {
+        /// @brief Tamanho fixo de INFO, sem o nome
+        constexpr size_t INFO_BYTES = 8U;
+
+        /// @brief Tamanho de ACK
+        constexpr size_t ACK_BYTES = MAX_CONTROL_BYTES;
+
+        void put32(uint8_t *out, uint32_t value)
+        {
+            out[0] = static_cast<uint8_t>(value);
+            out[1] = static_cast<uint8_t>(value >> 8);
+            out[2] = static_cast<uint8_t>(value >> 16);
+            out[3] = static_cast<uint8_t>(value >> 24);
+        }
+
+        uint32_t get32(const uint8_t *in)
+        {
+            return static_cast<uint32_t>(in[0]) | static_cast<uint32_t>(in[1]) << 8 |
+                   static_cast<uint32_t>(in[2]) << 16 | static_cast<uint32_t>(in[3]) << 24;
+        }
+
+        /// @brief Diferença de tempo sem problemas na volta do contador
+        bool elapsed(uint32_t nowUs, uint32_t sinceUs, uint32_t intervalUs)
+        {
+            return nowUs - sinceUs >= intervalUs;
+        }
+    }
+
+    bool isTransfer(const uint8_t *message, size_t len)
+    {
+        return len >= 2 && message[0] >= REQUEST && message[0] <= ACK;
+    }
+
+    bool parseRequest(const uint8_t *message, size_t len, uint8_t &session)
+    {
+        if (len < 2 || message[0] != REQUEST) return false;
+        session = message[1];
+        return true;
+    }
+
+    // --- Sender ---
+
+    Sender::Sender(Send send, Read read, void *context, size_t window, uint32_t timeoutUs, uint32_t idleUs)
+        : send_(send), read_(read), context_(context),
+          window_(window < 1 ? 1 : window > MAX_WINDOW ? MAX_WINDOW : window),
+          timeoutUs_(timeoutUs), idleUs_(idleUs)
+    {
+    }
+
+    void Sender::begin(uint8_t session, Status status, uint32_t size, const char *name, uint32_t nowUs)
+    {
+        infoPending_ = true;
+        if (chunks_ > 0 && session == session_) return;  // INFO perdido: só responde de novo
+
+        session_ = session;
+        status_ = size > 0 ? status : NO_FILE;
+        size_ = status_ == OK ? size : 0;
+        strncpy(name_, name != nullptr ? name : "", MAX_NAME);
+        name_[MAX_NAME] = '\0';
+
+        chunks_ = chunkCount(size_);
+        base_ = 0;
+        next_ = 0;
+        order_ = 0;
+        lastAckUs_ = nowUs;
+        memset(slots_, 0, sizeof(slots_));
+        active_ = chunks_ > 0;
+    }
+
+    void Sender::receive(const uint8_t *message, size_t len, uint32_t nowUs)
+    {
+        if (len < ACK_BYTES || message[0] != ACK || message[1] != session_ || !active_) return;
+
+        const uint32_t next = get32(message + 2);
+        const uint32_t bitmap = get32(message + 6);
+        if (next < base_ || next > next_) return;  // ACK velho ou inválido
+
+        stats_.acks++;
+        lastAckUs_ = nowUs;
+
+        // Maior ordem de envio entre os confirmados: o que foi enviado antes e falta, se perdeu
+        uint32_t newest = 0;
+        bool any = false;
+        for (uint32_t chunk = base_; chunk < next; chunk++) {
+            const Slot &slot = slots_[chunk % MAX_WINDOW];
+            if (!any || static_cast<int32_t>(slot.order - newest) > 0) newest = slot.order;
+            any = true;
+        }
+        base_ = next;
+
+        for (uint32_t i = 0; i < MAX_WINDOW; i++) {
+            const uint32_t chunk = next + 1U + i;
+            if (chunk >= next_) break;
+            if ((bitmap & (1UL << i)) == 0) continue;
+            Slot &slot = slots_[chunk % MAX_WINDOW];
+            slot.acked = true;
+            if (!any || static_cast<int32_t>(slot.order - newest) > 0) newest = slot.order;
+            any = true;
+        }
+
+        if (any) {
+            for (uint32_t chunk = base_; chunk < next_; chunk++) {
+                Slot &slot = slots_[chunk % MAX_WINDOW];
+                if (!slot.acked && static_cast<int32_t>(newest - slot.order) > 0) slot.lost = true;
+            }
+        }
+
+        if (base_ == chunks_) active_ = false;
+    }
+
+    void Sender::poll(uint32_t nowUs, size_t budget)
+    {
+        if (infoPending_) {
+            if (budget == 0) return;
+            if (!sendInfo()) {
+                stats_.refused++;
+                return;
+            }
+            infoPending_ = false;
+            budget--;
+        }
+        if (!active_) return;
+
+        if (elapsed(nowUs, lastAckUs_, idleUs_)) {
+            active_ = false;  // A Base sumiu; um novo pedido recomeça
+            return;
+        }
+
+        // Reenvios primeiro, do mais antigo para o mais novo
+        for (uint32_t chunk = base_; chunk < next_ && budget > 0; chunk++) {
+            const Slot &slot = slots_[chunk % MAX_WINDOW];
+            if (slot.acked) continue;
+            const bool lost = slot.lost;
+            if (!lost && !elapsed(nowUs, slot.sentUs, timeoutUs_)) continue;
+            if (!transmit(chunk, nowUs)) return;
+            stats_.retransmitted++;
+            if (!lost) stats_.timeouts++;
+            budget--;
+        }
+
+        while (budget > 0 && next_ < chunks_ && next_ - base_ < window_) {
+            if (!transmit(next_, nowUs)) return;
+            stats_.sent++;
+            next_++;
+            budget--;
+        }
+    }
+
+    bool Sender::sendInfo()
+    {
+        uint8_t message[INFO_BYTES + MAX_NAME];
+        const size_t nameLength = strlen(name_);
+        message[0] = INFO;
+        message[1] = session_;
+        message[2] = status_;
+        put32(message + 3, size_);
+        message[7] = static_cast<uint8_t>(nameLength);
+        memcpy(message + INFO_BYTES, name_, nameLength);
+        return send_(message, INFO_BYTES + nameLength, context_);
+    }
+
+    bool Sender::transmit(uint32_t chunk, uint32_t nowUs)
+    {
+        uint8_t message[DATA_HEADER_BYTES + CHUNK_BYTES];
+        const uint32_t offset = chunk * CHUNK_BYTES;
+        const size_t length = size_ - offset < CHUNK_BYTES ? size_ - offset : CHUNK_BYTES;
+
+        message[0] = DATA;
+        message[1] = session_;
+        put32(message + 2, chunk);
+        if (read_(offset, message + DATA_HEADER_BYTES, length, context_) != length) {
+            active_ = false;  // Arquivo ilegível: a Base desiste por tempo
+            return false;
+        }
+        if (!send_(message, DATA_HEADER_BYTES + length, context_)) {
+            stats_.refused++;
+            return false;
+        }
+
+        Slot &slot = slots_[chunk % MAX_WINDOW];
+        slot.sentUs = nowUs;
+        slot.order = ++order_;
+        slot.acked = false;
+        slot.lost = false;
+        return true;
+    }
+
+    // --- Receiver ---
+
+    Receiver::Receiver(Send send, Open open, Write write, void *context, uint32_t timeoutUs, uint32_t idleUs)
+        : send_(send), open_(open), write_(write), context_(context), timeoutUs_(timeoutUs), idleUs_(idleUs)
+    {
+    }
+
+    void Receiver::request(uint32_t nowUs)
+    {
+        session_ = static_cast<uint8_t>(session_ + 1U);
+        if (session_ == 0) session_ = 1;
+
+        state_ = REQUESTING;
+        status_ = OK;
+        size_ = 0;
+        chunks_ = 0;
+        name_[0] = '\0';
+        next_ = 0;
+        present_ = 0;
+        unacked_ = 0;
+        lastHeardUs_ = nowUs;
+        sendRequest();
+        lastSendUs_ = nowUs;
+    }
+
+    void Receiver::receive(const uint8_t *message, size_t len, uint32_t nowUs)
+    {
+        if (len < 2 || message[1] != session_) return;
+
+        if (message[0] == INFO) {
+            if (state_ != REQUESTING || len < INFO_BYTES) return;
+            lastHeardUs_ = nowUs;
+
+            size_t nameLength = message[7];
+            if (nameLength > MAX_NAME) nameLength = MAX_NAME;
+            if (nameLength > len - INFO_BYTES) nameLength = len - INFO_BYTES;
+            memcpy(name_, message + INFO_BYTES, nameLength);
+            name_[nameLength] = '\0';
+
+            status_ = static_cast<Status>(message[2]);
+            size_ = get32(message + 3);
+            chunks_ = chunkCount(size_);
+            if (status_ != OK || chunks_ == 0 || !open_(name_, size_, context_)) {
+                state_ = FAILED;
+                return;
+            }
+            state_ = RECEIVING;
+            return;
+        }
+
+        if (message[0] != DATA || len < DATA_HEADER_BYTES) return;
+        if (state_ != RECEIVING && state_ != DONE) return;
+
+        const uint32_t chunk = get32(message + 2);
+        const uint8_t *data = message + DATA_HEADER_BYTES;
+        const size_t length = len - DATA_HEADER_BYTES;
+        if (chunk >= chunks_ || length != chunkLength(chunk)) return;
+
+        lastHeardUs_ = nowUs;
+        stats_.received++;
+
+        if (chunk < next_) {
+            // Repetição: o ACK anterior se perdeu
+            stats_.duplicates++;
+            sendAck(nowUs);
+            return;
+        }
+
+        if (chunk > next_) {
+            const uint32_t offset = chunk - next_ - 1U;
+            if (offset >= MAX_WINDOW) return;
+            const uint32_t bit = 1UL << offset;
+            if ((present_ & bit) != 0) {
+                stats_.duplicates++;
+            } else {
+                memcpy(buffer_[chunk % MAX_WINDOW], data, length);
+                present_ |= bit;
+                stats_.outOfOrder++;
+            }
+            sendAck(nowUs);  // Lacuna: o foguete reenvia o que falta
+            return;
+        }
+
+        if (!deliver(data, length)) {
+            state_ = FAILED;
+            return;
+        }
+        if (next_ == chunks_) {
+            state_ = DONE;
+            sendAck(nowUs);
+        } else if (++unacked_ >= ACK_EVERY) {
+            sendAck(nowUs);
+        }
+    }
+
+    void Receiver::poll(uint32_t nowUs)
+    {
+        switch (state_) {
+            case REQUESTING:
+                if (elapsed(nowUs, lastHeardUs_, idleUs_)) {
+                    state_ = FAILED;
+                } else if (elapsed(nowUs, lastSendUs_, timeoutUs_)) {
+                    sendRequest();
+                    lastSendUs_ = nowUs;
+                }
+                break;
+
+            case RECEIVING:
+                if (elapsed(nowUs, lastHeardUs_, idleUs_)) {
+                    state_ = FAILED;
+                } else if (unacked_ > 0 && elapsed(nowUs, lastSendUs_, ACK_DELAY_US)) {
+                    sendAck(nowUs);
+                } else if (elapsed(nowUs, lastHeardUs_, timeoutUs_) && elapsed(nowUs, lastSendUs_, timeoutUs_)) {
+                    sendAck(nowUs);  // Nada chegando: o último ACK pode ter se perdido
+                }
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    void Receiver::sendRequest()
+    {
+        const uint8_t message[2] = {REQUEST, session_};
+        send_(message, sizeof(message), context_);
+    }
+
+    void Receiver::sendAck(uint32_t nowUs)
+    {
+        uint8_t message[ACK_BYTES];
+        message[0] = ACK;
+        message[1] = session_;
+        put32(message + 2, next_);
+        put32(message + 6, present_);
+        send_(message, sizeof(message), context_);
+
+        unacked_ = 0;
+        lastSendUs_ = nowUs;
+        stats_.acks++;
+    }
+
+    bool Receiver::deliver(const uint8_t *data, size_t len)
+    {
+        if (!write_(data, len, context_)) return false;
+        next_++;
+
+        // Os pedaços guardados que agora estão em ordem
+        while ((present_ & 1U) != 0) {
+            present_ >>= 1;
+            if (!write_(buffer_[next_ % MAX_WINDOW], chunkLength(next_), context_)) return false;
+            next_++;
+        }
+        present_ >>= 1;
+        return true;
+    }
+
+    size_t Receiver::chunkLength(uint32_t chunk) const
+    {
+        const uint32_t offset = chunk * CHUNK_BYTES;
+        return size_ - offset < CHUNK_BYTES ? size_ - offset : CHUNK_BYTES;
+    }
+}
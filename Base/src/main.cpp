@@ -12,37 +12,55 @@
  #include <Arduino.h>
  #include <esp_now.h>
  #include <WiFi.h>
+ #include <LittleFS.h>
+ #include <vector>
 
  #include "Config.h"
+ #include "Battery.h"
  #include "Structs.h"
+ #include "Telemetry.h"
+ #include "Fec.h"
+ #include "History.h"
+ #include "LinkStats.h"
+ #include "Log.h"
+ #include "Download.h"
+ #include "SeqLock.h"
+#include "Events.h"
 
- /// @brief Dados globais recebidos via ESP-NOW
- SensorData dadosRecebidos = {0};
+ /// @brief Amostra mais recente recebida via ESP-NOW
+ /// @details Escrita pela tarefa do WiFi e lida pelas páginas: cada
+ /// página copia uma vez com load() e monta a resposta com a cópia
+ SeqLock<SensorData> ultimaAmostra;
 
 esp_now_peer_info_t peerInfo = {};
 
-struct {             // Structure declaration
-  int leituraADC;
-  float tensaoPino;
-  float tensaoReal;
-} tensaoBase;  
-
 /// @brief Biblioteca para controle de PWM no ESP32
 /// @details Utilizada para controle de motores e outros dispositivos
 /// @note A biblioteca ESP32Servo é uma alternativa ao uso direto de PWM
 Servo meuServo;
 
- /// @brief Tensão de referência do ADC
- /// @details Utilizada para conversão de valores analógicos
-const float VREF = 5; // Tensão de referência do ADC (5V para o sensor de tensão)
-
  /// @brief Servidor web na porta 80
  WebServer server(80);
  
- /// @brief Flag para indicar atualização de dados
- volatile bool dadosAtualizados = false;
+ /// @brief Quadros ESP-NOW válidos recebidos
+ volatile uint32_t quadrosRecebidos = 0;
+
+ /// @brief Quadros de fluxo descartados por chegarem depois de um mais novo
+ volatile uint32_t quadrosAtrasados = 0;
+
+ /// @brief Reboots do foguete já tratados pela correção (tarefa do WiFi)
+ uint32_t fluxosReiniciados = 0;
+
+ /// @brief Tarefa do loop(), acordada a cada quadro para enviar o evento
+ TaskHandle_t tarefaLoop = nullptr;
  
-uint16_t nextSequenceId = 0;
+/// @brief Perdas, repetições e reordenações medidas pelos números de sequência
+LinkMonitor enlace(Config::Link::RESYNC_GAP);
+
+void processarQuadro(const uint8_t *frame, size_t len, void *);
+
+/// @brief Reordena os quadros e reconstrói perdas a partir da paridade
+Telemetry::FecDecoder correcao(processarQuadro, nullptr);
 
  /** @brief Estrutura global para armazenamento de dados de telemetria */
  SensorData sensorData = {};
@@ -69,18 +87,130 @@ uint16_t nextSequenceId = 0;
      esp_wifi_set_channel(Config::EspNow::CHANNEL, secondChan);
  }
 
+ /**
+  * @brief Escapa um texto para dentro de uma string JSON
+  * 
+  * @details Aspas, barra invertida e caracteres de controle. Parte dos
+  * textos vem do foguete, como o nome do arquivo de voo.
+  */
+ String escaparJSON(const String &texto) {
+    String saida;
+    saida.reserve(texto.length());
+    for (const char *p = texto.c_str(); *p != '\0'; p++) {
+        const char c = *p;
+        if (c == '"' || c == '\\') {
+            saida += '\\';
+            saida += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char codigo[8];
+            snprintf(codigo, sizeof(codigo), "\\u%04x", (unsigned)c);
+            saida += codigo;
+        } else {
+            saida += c;
+        }
+    }
+    return saida;
+ }
+
+ /// @brief Escapa um texto para o conteúdo de um elemento HTML
+ String escaparHTML(const String &texto) {
+    String saida;
+    saida.reserve(texto.length());
+    for (const char *p = texto.c_str(); *p != '\0'; p++) {
+        const char c = *p;
+        if (c == '&') {
+            saida += "&amp;";
+        } else if (c == '<') {
+            saida += "&lt;";
+        } else if (c == '>') {
+            saida += "&gt;";
+        } else {
+            saida += c;
+        }
+    }
+    return saida;
+ }
+
+ /**
+  * @brief Situação da transferência do arquivo de voo, para a página
+  * 
+  * @return Etapa e progresso, em texto
+  */
+ String formatarDownload() {
+    Download::Status s;
+    Download::status(s);
+
+    String texto = String(Download::stateName(s.state));
+    if (s.state == Transfer::Receiver::FAILED && s.answer != Transfer::OK) {
+        texto += " (" + String(Download::answerName(s.answer)) + ")";
+    }
+    if (s.size > 0) {
+        texto += ": " + String((unsigned long)(s.written / 1024)) + " / " +
+                String((unsigned long)(s.size / 1024)) + " kB";
+    }
+    return texto;
+ }
+
+ /// @brief Recebe uma linha do painel: id da célula, rótulo e valor formatado
+ typedef void (*VisitaLinha)(const char *id, const char *rotulo, const String &valor, void *contexto);
+
+ /**
+  * @brief Percorre as linhas da tabela do painel
+  * 
+  * @param dados Amostra mostrada
+  * @param visita Chamada uma vez por linha, sempre na mesma ordem
+  * @param contexto Repassado a @p visita
+  * 
+  * Fonte única das linhas: a página monta a tabela com elas e o fluxo
+  * /events envia as mesmas células quando mudam.
+  */
+ void percorrerPainel(const SensorData &dados, VisitaLinha visita, void *contexto) {
+    visita("canal", "Canal ESP-NOW", String(Config::EspNow::CHANNEL), contexto);
+    visita("accX", "Acelerômetro X", String(dados.acelerometro.accX, 2), contexto);
+    visita("accY", "Acelerômetro Y", String(dados.acelerometro.accY, 2), contexto);
+    visita("accZ", "Acelerômetro Z", String(dados.acelerometro.accZ, 2), contexto);
+    visita("gyroX", "Giroscópio X", String(dados.acelerometro.gyroX, 2), contexto);
+    visita("gyroY", "Giroscópio Y", String(dados.acelerometro.gyroY, 2), contexto);
+    visita("gyroZ", "Giroscópio Z", String(dados.acelerometro.gyroZ, 2), contexto);
+    visita("temp", "Temp", String(dados.acelerometro.temp, 2), contexto);
+    visita("roll", "Roll", String(dados.acelerometro.roll, 2), contexto);
+    visita("pitch", "Pitch", String(dados.acelerometro.pitch, 2), contexto);
+    visita("altitude", "Altitude", String(dados.altimetro.altitude, 2), contexto);
+    visita("pressure", "Pressure", String(dados.altimetro.pressure, 2), contexto);
+    visita("vBase", "Voltage (Base)", String(Battery::voltage(), 2), contexto);
+    visita("vRocket", "Voltage (Rocket)", String(dados.tensao.voltage_rocket, 2), contexto);
+    visita("lat", "Latitude", String(dados.gps.latitude, 6), contexto);
+    visita("lon", "Longitude", String(dados.gps.longitude, 6), contexto);
+    visita("altGps", "Altitude GPS", String(dados.gps.altitude, 2), contexto);
+    visita("fixAge", "Idade do fix GPS (ms)", String((unsigned long)dados.gps.fixAge), contexto);
+    visita("hdop", "HDOP", String(dados.gps.hdop, 1), contexto);
+    visita("sats", "Satélites", String((unsigned)dados.gps.satellites), contexto);
+    visita("fase", "Fase de voo", String(Telemetry::phaseName(dados.phase)), contexto);
+    visita("gravador", "Gravador do foguete", (dados.status & Telemetry::STATUS_RECORDER_FAULT) ? "falha: sem espaço ou erro da flash (baixe o voo anterior)" : "ok", contexto);
+    visita("quadros", "Quadros / amostras recebidos", String((unsigned long)quadrosRecebidos) + " / " + String((unsigned long)History::total()), contexto);
+    visita("perdidos", "Quadros perdidos", String((unsigned long)enlace.stats().lost) + " (" + String(enlace.lossRatio() * 100.0f, 1) + "%)", contexto);
+    visita("rajada", "Maior rajada de perda", String((unsigned long)enlace.stats().maxBurst), contexto);
+    visita("fec", "Quadros recuperados (FEC)", String((unsigned long)correcao.stats().recovered), contexto);
+    visita("taxa", "Taxa do foguete", String((unsigned)dados.radio.frameIntervalMs) + " ms, " + String((unsigned)dados.radio.batchSize) + " amostras/quadro, entrega " + String((unsigned)dados.radio.deliveryPct) + "%", contexto);
+    visita("timestamp", "Timestamp (ms)", String((unsigned long)(dados.timestampUs / 1000)), contexto);
+    visita("arquivo", "Arquivo de voo", formatarDownload(), contexto);
+ }
+
  /**
   * @brief Gera página HTML com dados dos sensores
   * 
   * @return String contendo o HTML formatado com dados dos sensores
   * 
-  * Cria uma página web responsiva com tabela de dados de sensores,
-  * incluindo atualização automática a cada 2 segundos.
+  * Cria uma página web responsiva com tabela de dados de sensores. A
+  * página abre o fluxo /events e troca só o texto das células que
+  * mudaram, sem recarregar. Os valores são sempre texto: alguns vêm do
+  * foguete e não podem virar HTML.
   */
  String formatarDadosHTML() {
-    return "<!DOCTYPE html><html><head>"
+    const SensorData dados = ultimaAmostra.load();
+
+    String html = "<!DOCTYPE html><html><head>"
        "<meta charset='utf-8'>"
-       "<meta http-equiv='refresh' content='2'>"
        "<style>"
        "body { font-family: Arial, sans-serif; max-width: 600px; margin: 0 auto; padding: 20px; }"
        "h1 { color: #333; }"
@@ -91,29 +221,122 @@ uint16_t nextSequenceId = 0;
        "<title>Dados ESP-NOW</title></head><body>"
        "<h1>Dados Recebidos via ESP-NOW</h1>"
        "<table>"
-       "<tr><th>Sensor</th><th>Valor</th></tr>"
-       "<tr><td>Canal ESP-NOW</td><td>" + String(Config::EspNow::CHANNEL) + "</td></tr>"
-       "<tr><td>Acelerômetro X</td><td>" + String(dadosRecebidos.acelerometro.accX, 2) + "</td></tr>"
-       "<tr><td>Acelerômetro Y</td><td>" + String(dadosRecebidos.acelerometro.accY, 2) + "</td></tr>"
-       "<tr><td>Acelerômetro Z</td><td>" + String(dadosRecebidos.acelerometro.accZ, 2) + "</td></tr>"
-       "<tr><td>Giroscópio X</td><td>" + String(dadosRecebidos.acelerometro.gyroX, 2) + "</td></tr>"
-       "<tr><td>Giroscópio Y</td><td>" + String(dadosRecebidos.acelerometro.gyroY, 2) + "</td></tr>"
-       "<tr><td>Giroscópio Z</td><td>" + String(dadosRecebidos.acelerometro.gyroZ, 2) + "</td></tr>"
-       "<tr><td>Temp</td><td>" + String(dadosRecebidos.acelerometro.temp, 2) + "</td></tr>"
-       "<tr><td>Roll</td><td>" + String(dadosRecebidos.acelerometro.roll, 2) + "</td></tr>"
-       "<tr><td>Pitch</td><td>" + String(dadosRecebidos.acelerometro.pitch, 2) + "</td></tr>"
-       "<tr><td>Altitude</td><td>" + String(dadosRecebidos.altimetro.altitude, 2) + "</td></tr>"
-       "<tr><td>Pressure</td><td>" + String(dadosRecebidos.altimetro.pressure, 2) + "</td></tr>"
-       "<tr><td>Voltage (Base)</td><td>" + String(tensaoBase.tensaoReal, 2) + "</td></tr>"
-       "<tr><td>Voltage (Rocket)</td><td>" + String(dadosRecebidos.tensao.voltage_rocket, 2) + "</td></tr>"
-       "<tr><td>Latitude</td><td>" + String(dadosRecebidos.gps.latitude, 6) + "</td></tr>"
-       "<tr><td>Longitude</td><td>" + String(dadosRecebidos.gps.longitude, 6) + "</td></tr>"
-       "<tr><td>Altitude GPS</td><td>" + String(dadosRecebidos.gps.altitude, 2) + "</td></tr>"
-       "<tr><td>Timestamp</td><td>" + String(dadosRecebidos.timestamp) + "</td></tr>"
-       "</table>"
+       "<tr><th>Sensor</th><th>Valor</th></tr>";
+    percorrerPainel(dados, [](const char *id, const char *rotulo, const String &valor, void *contexto) {
+        String &pagina = *static_cast<String *>(contexto);
+        pagina += "<tr><td>" + String(rotulo) + "</td><td id='" + String(id) + "'>" + escaparHTML(valor) + "</td></tr>";
+    }, &html);
+    html += "</table>"
+       // O pedido dispara uma transferência: POST, para que nenhuma pré-carga o repita.
+       // Fora de hora, /log/start responde 409 e /log/file, 404
+       "<p><form method='post' action='/log/start' style='display:inline'>"
+       "<button>baixar do foguete</button></form> "
+       "<a href='/log/file'>salvar arquivo de voo</a></p>"
+       // Cada evento traz {"id":"valor"} das células que mudaram
+       "<script>"
+       "new EventSource('/events').onmessage = function (e) {"
+       "  var d = JSON.parse(e.data);"
+       "  for (var id in d) { var c = document.getElementById(id); if (c) c.textContent = d[id]; }"
+       "};"
+       "</script>"
        "</body></html>";
+    return html;
+ }
+
+ /// @brief Valores já enviados pelo fluxo /events, na ordem das linhas
+ /// @details Uma posição por linha de percorrerPainel(), acrescentada no
+ /// primeiro evento; a contagem sai do próprio percurso
+ std::vector<String> valoresEnviados;
+
+ /// @brief O próximo evento leva todas as células (um navegador acabou de entrar)
+ bool eventoCompleto = true;
+
+ /**
+  * @brief Monta o evento com as células que mudaram desde o último
+  * 
+  * @param dados Amostra mais recente
+  * @param sequencia Sequência da amostra no histórico
+  * @return JSON {"seq":N,"id":"valor",...}
+  */
+ String formatarEvento(const SensorData &dados, uint32_t sequencia) {
+    struct Montagem {
+        String json;
+        size_t linha;
+    } montagem = {"{\"seq\":" + String((unsigned long)sequencia), 0};
+
+    percorrerPainel(dados, [](const char *id, const char *, const String &valor, void *contexto) {
+        Montagem &m = *static_cast<Montagem *>(contexto);
+        const size_t linha = m.linha++;
+        if (linha == valoresEnviados.size()) {
+            valoresEnviados.push_back(valor);
+        } else {
+            if (!eventoCompleto && valoresEnviados[linha] == valor) return;
+            valoresEnviados[linha] = valor;
+        }
+        m.json += ",\"" + String(id) + "\":\"" + escaparJSON(valor) + "\"";
+    }, &montagem);
+    eventoCompleto = false;
+
+    return montagem.json + "}";
  }
  
+ /**
+  * @brief Decodifica um quadro liberado pela correção de erros
+  * 
+  * @param frame Quadro de telemetria (fluxo v4, lote v3 ou avulso v2)
+  * @param len Tamanho do quadro
+  * 
+  * Guarda todas as amostras no histórico e publica a mais recente.
+  * Chamado por Telemetry::FecDecoder, em ordem de sequência exceto pelos
+  * quadros que chegam depois de o grupo deles ter sido liberado. Esses
+  * são descartados aqui: o histórico precisa das amostras em ordem de
+  * tempo (History::find()), e um keyframe atrasado ainda desalinharia o
+  * decodificador. Depois de um reboot do foguete, já com a retenção do
+  * fluxo anterior entregue (onEspNowReceive()), a sequência volta a
+  * valer a partir do quadro novo.
+  */
+void processarQuadro(const uint8_t *frame, size_t len, void *) {
+    // Estáticos: o callback roda sempre na mesma tarefa do WiFi, de pilha curta
+    static Telemetry::StreamDecoder decodificador;
+    static SensorData lote[Telemetry::MAX_FRAME_SAMPLES];
+    static uint16_t ultimaSequencia = 0;
+    static bool temSequencia = false;
+    static uint32_t reboots = 0;
+
+    // Lotes v3 e pacotes v2 não têm sequência nem passam pela retenção da correção
+    uint16_t sequencia;
+    if (Telemetry::sequenceOf(frame, len, sequencia)) {
+        if (fluxosReiniciados != reboots) {
+            reboots = fluxosReiniciados;
+            temSequencia = false;
+        }
+        if (temSequencia && static_cast<int16_t>(sequencia - ultimaSequencia) <= 0) {
+            quadrosAtrasados = quadrosAtrasados + 1;
+            return;
+        }
+        ultimaSequencia = sequencia;
+        temSequencia = true;
+    }
+
+    size_t amostras = decodificador.decode(frame, len, lote, Telemetry::MAX_FRAME_SAMPLES);
+    if (amostras == 0) {
+        LOG_WARN("Quadro descartado: %u bytes (v%u), %lu aguardando keyframe",
+                 (unsigned)len, (unsigned)frame[0],
+                 (unsigned long)decodificador.skipped());
+        return;
+    }
+    quadrosRecebidos = quadrosRecebidos + 1;
+
+    // Todas as amostras vão para o histórico; a página mostra a última
+    for (size_t i = 0; i < amostras; i++) {
+        History::push(lote[i]);
+    }
+    ultimaAmostra.store(lote[amostras - 1]);
+    if (tarefaLoop != nullptr) xTaskNotifyGive(tarefaLoop);
+
+    LOG_DEBUG("Dados recebidos: %u amostras", (unsigned)amostras);
+}
+
  /**
   * @brief Callback para recebimento de dados via ESP-NOW
   * 
@@ -121,31 +344,54 @@ uint16_t nextSequenceId = 0;
   * @param incomingData Ponteiro para os dados recebidos
   * @param len Tamanho dos dados recebidos
   * 
-  * Processa os dados recebidos, verifica integridade e atualiza 
-  * variáveis globais com informações dos sensores.
+  * Contabiliza o quadro no enlace e o entrega à correção de erros, que
+  * chama processarQuadro() para cada quadro liberado. As mensagens da
+  * transferência do arquivo de voo são desviadas antes.
   */
 void onEspNowReceive(const uint8_t *mac, const uint8_t *incomingData, int len) {
-    if (len != sizeof(SensorData)) {
-        Serial.printf("Tamanho de dados inválido. Esperado: %d, Recebido: %d\n", 
-                      sizeof(SensorData), len);
-        return;
+    if (len <= 0) return;
+
+    // Mensagens da transferência do arquivo de voo vão para a tarefa dela
+    if (Download::receive(mac, incomingData, len)) return;
+
+    // Conta o quadro mesmo que o fluxo ainda não possa ser decodificado
+    uint16_t sequencia;
+    if (Telemetry::sequenceOf(incomingData, static_cast<size_t>(len), sequencia)) {
+        enlace.record(sequencia);
+        Download::rocketSeen(mac);
+
+        // Foguete reiniciado: o grupo retido é do fluxo anterior e a
+        // sequência nova recomeça abaixo dele
+        if (enlace.stats().resets != fluxosReiniciados) {
+            correcao.reset();
+            fluxosReiniciados = enlace.stats().resets;
+        }
     }
 
-    // Formata endereço MAC do remetente
-    char macStr[18];
-    snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
-             mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+    correcao.push(incomingData, static_cast<size_t>(len));
 
-    // Copia os dados recebidos
-    memcpy(&dadosRecebidos, incomingData, sizeof(SensorData));
+    // Log de recebimento, formatado fora da tarefa do WiFi
+    LOG_DEBUG("MAC: %02X:%02X:%02X:%02X:%02X:%02X",
+              mac[0], mac[1], mac[2], mac[3], mac[4], mac[5]);
+}
 
-    // Marca dados como atualizados
-    dadosAtualizados = true;
+ /**
+  * @brief Devolve ao foguete a contagem do enlace
+  * 
+  * O foguete envia a um endereço de grupo, sem ACK do rádio: a entrega
+  * que ele usa no controle de taxa é a que a Base mede aqui. Sem
+  * foguete visto, nada é enviado.
+  */
+void enviarRelatorioEnlace() {
+    const LinkStats &s = enlace.stats();
+    if (s.received == 0) return;
 
-    // Log de recebimento
-    Serial.println("Dados recebidos:");
-    Serial.printf("MAC: %s\n", macStr);
-    Serial.println("-----------");
+    Telemetry::LinkReport relatorio = {};
+    relatorio.version = Telemetry::LINK_REPORT_VERSION;
+    relatorio.lastSequence = s.lastSequence;
+    relatorio.received = s.received;
+    relatorio.lost = s.lost;
+    Download::sendToRocket(reinterpret_cast<const uint8_t *>(&relatorio), sizeof(relatorio));
 }
 
 
@@ -165,60 +411,102 @@ void onEspNowReceive(const uint8_t *mac, const uint8_t *incomingData, int len) {
   * acelerômetro e timestamp.
   */
  // Retorna uma string JSON para os dados do altímetro. Ex: {"altitude":VAL,"pressure":VAL}
-String getAltimetroPayloadJson() {
-    return "{\"altitude\":" + String(dadosRecebidos.altimetro.altitude, 2) +
-           ",\"pressure\":" + String(dadosRecebidos.altimetro.pressure, 2) + "}";
+String getAltimetroPayloadJson(const SensorData &dados) {
+    return "{\"altitude\":" + String(dados.altimetro.altitude, 2) +
+           ",\"pressure\":" + String(dados.altimetro.pressure, 2) + "}";
 }
 
 // Retorna uma string JSON para os dados do acelerômetro. Ex: {"accX":VAL,...,"pitch":VAL}
-String getAcelerometroPayloadJson() {
-    return "{\"accX\":" + String(dadosRecebidos.acelerometro.accX, 2) +
-           ",\"accY\":" + String(dadosRecebidos.acelerometro.accY, 2) +
-           ",\"accZ\":" + String(dadosRecebidos.acelerometro.accZ, 2) +
-           ",\"gyroX\":" + String(dadosRecebidos.acelerometro.gyroX, 2) +
-           ",\"gyroY\":" + String(dadosRecebidos.acelerometro.gyroY, 2) +
-           ",\"gyroZ\":" + String(dadosRecebidos.acelerometro.gyroZ, 2) +
-           ",\"temp\":" + String(dadosRecebidos.acelerometro.temp, 2) +
-           ",\"roll\":" + String(dadosRecebidos.acelerometro.roll, 2) +
-           ",\"pitch\":" + String(dadosRecebidos.acelerometro.pitch, 2) + "}";
+String getAcelerometroPayloadJson(const SensorData &dados) {
+    return "{\"accX\":" + String(dados.acelerometro.accX, 2) +
+           ",\"accY\":" + String(dados.acelerometro.accY, 2) +
+           ",\"accZ\":" + String(dados.acelerometro.accZ, 2) +
+           ",\"gyroX\":" + String(dados.acelerometro.gyroX, 2) +
+           ",\"gyroY\":" + String(dados.acelerometro.gyroY, 2) +
+           ",\"gyroZ\":" + String(dados.acelerometro.gyroZ, 2) +
+           ",\"temp\":" + String(dados.acelerometro.temp, 2) +
+           ",\"roll\":" + String(dados.acelerometro.roll, 2) +
+           ",\"pitch\":" + String(dados.acelerometro.pitch, 2) + "}";
 }
 
 // Retorna uma string JSON para os dados de tensão. Ex: {"voltage_base":VAL,"voltage_rocket":VAL}
-String getTensaoPayloadJson() {
-    return "{\"voltage_base\":" + String(tensaoBase.tensaoReal, 2) +
-           ",\"voltage_rocket\":" + String(dadosRecebidos.tensao.voltage_rocket, 2) + "}";
+String getTensaoPayloadJson(const SensorData &dados) {
+    return "{\"voltage_base\":" + String(Battery::voltage(), 2) +
+           ",\"voltage_rocket\":" + String(dados.tensao.voltage_rocket, 2) + "}";
 }
 
-// Retorna uma string JSON para os dados do GPS. Ex: {"latitude":VAL,...,"second":VAL}
-String getGpsPayloadJson() {
-    return "{\"latitude\":" + String(dadosRecebidos.gps.latitude, 6) +
-           ",\"longitude\":" + String(dadosRecebidos.gps.longitude, 6) +
-           ",\"altitude\":" + String(dadosRecebidos.gps.altitude, 2) +
-           ",\"day\":" + String(dadosRecebidos.gps.day) +
-           ",\"month\":" + String(dadosRecebidos.gps.month) +
-           ",\"year\":" + String(dadosRecebidos.gps.year) +
-           ",\"hour\":" + String(dadosRecebidos.gps.hour) +
-           ",\"minute\":" + String(dadosRecebidos.gps.minute) +
-           ",\"second\":" + String(dadosRecebidos.gps.second) + "}";
+// Retorna uma string JSON para os dados do GPS. Ex: {"latitude":VAL,...,"satellites":VAL}
+String getGpsPayloadJson(const SensorData &dados) {
+    return "{\"latitude\":" + String(dados.gps.latitude, 6) +
+           ",\"longitude\":" + String(dados.gps.longitude, 6) +
+           ",\"altitude\":" + String(dados.gps.altitude, 2) +
+           ",\"day\":" + String(dados.gps.day) +
+           ",\"month\":" + String(dados.gps.month) +
+           ",\"year\":" + String(dados.gps.year) +
+           ",\"hour\":" + String(dados.gps.hour) +
+           ",\"minute\":" + String(dados.gps.minute) +
+           ",\"second\":" + String(dados.gps.second) +
+           ",\"fixAge\":" + String((unsigned long)dados.gps.fixAge) +
+           ",\"hdop\":" + String(dados.gps.hdop, 1) +
+           ",\"satellites\":" + String((unsigned)dados.gps.satellites) + "}";
 }
 
-String getBaseStationInfoJson() {
+// Retorna uma string JSON com a contabilidade do enlace. Ex: {"received":VAL,...,"burst_histogram":[...],"fec":{...},"rate":{...}}
+String getLinkPayloadJson(const SensorData &dados) {
+    const LinkStats &s = enlace.stats();
+    const Telemetry::FecDecoder::Stats &fec = correcao.stats();
+    String histograma = "[";
+    for (size_t i = 0; i < LINK_BURST_BUCKETS; i++) {
+        if (i > 0) histograma += ",";
+        histograma += String((unsigned long)s.burstHistogram[i]);
+    }
+    histograma += "]";
+
+    return "{\"received\":" + String((unsigned long)s.received) +
+           ",\"lost\":" + String((unsigned long)s.lost) +
+           ",\"duplicates\":" + String((unsigned long)s.duplicates) +
+           ",\"reordered\":" + String((unsigned long)s.reordered) +
+           ",\"loss_ratio\":" + String(enlace.lossRatio(), 4) +
+           ",\"bursts\":" + String((unsigned long)s.bursts) +
+           ",\"max_burst\":" + String((unsigned long)s.maxBurst) +
+           ",\"last_burst\":" + String((unsigned long)s.lastBurst) +
+           ",\"burst_histogram\":" + histograma +
+           ",\"resets\":" + String((unsigned long)s.resets) +
+           ",\"last_sequence\":" + String((unsigned)s.lastSequence) +
+           ",\"fec\":{\"parity\":" + String((unsigned long)fec.parity) +
+           ",\"recovered\":" + String((unsigned long)fec.recovered) +
+           ",\"unrecoverable\":" + String((unsigned long)fec.unrecoverable) +
+           ",\"delayed\":" + String((unsigned long)fec.delayed) +
+           ",\"late_dropped\":" + String((unsigned long)quadrosAtrasados) + "}" +
+           ",\"rate\":{\"frame_interval_ms\":" + String((unsigned)dados.radio.frameIntervalMs) +
+           ",\"batch_size\":" + String((unsigned)dados.radio.batchSize) +
+           ",\"delivery_pct\":" + String((unsigned)dados.radio.deliveryPct) + "}}";
+}
+
+String getBaseStationInfoJson(const SensorData &dados) {
     return "\"esp_now_channel\":" + String(Config::EspNow::CHANNEL) +
            ",\"mac_address\":\"" + WiFi.macAddress() + "\"" + // MAC da interface STA
-           ",\"timestamp\":" + String(dadosRecebidos.timestamp);
+           ",\"phase\":\"" + String(Telemetry::phaseName(dados.phase)) + "\"" +
+           ",\"recorder_fault\":" + String((dados.status & Telemetry::STATUS_RECORDER_FAULT) ? "true" : "false") +
+           ",\"frames_received\":" + String((unsigned long)quadrosRecebidos) +
+           ",\"samples_received\":" + String((unsigned long)History::total()) +
+           ",\"timestamp\":" + String((unsigned long)(dados.timestampUs / 1000));
 }
  void handleJSON() {
-    String altimetroJson = getAltimetroPayloadJson();
-    String acelerometroJson = getAcelerometroPayloadJson();
-    String tensaoJson = getTensaoPayloadJson();
-    String gpsJson = getGpsPayloadJson();
-    String baseInfoJson = getBaseStationInfoJson();
+    // Uma única cópia: todas as seções descrevem a mesma amostra
+    const SensorData dados = ultimaAmostra.load();
+    String altimetroJson = getAltimetroPayloadJson(dados);
+    String acelerometroJson = getAcelerometroPayloadJson(dados);
+    String tensaoJson = getTensaoPayloadJson(dados);
+    String gpsJson = getGpsPayloadJson(dados);
+    String baseInfoJson = getBaseStationInfoJson(dados);
 
     String jsonResponse = "{\"sensors\":{";
     jsonResponse += "\"altimetro\":" + altimetroJson + ",";
     jsonResponse += "\"acelerometro\":" + acelerometroJson + ",";
     jsonResponse += "\"tensao\":" + tensaoJson + ",";
-    jsonResponse += "\"gps\":" + gpsJson + ","; // Vírgula aqui, pois baseInfoJson segue
+    jsonResponse += "\"gps\":" + gpsJson + ",";
+    jsonResponse += "\"link\":" + getLinkPayloadJson(dados) + ","; // Vírgula aqui, pois baseInfoJson segue
     jsonResponse += baseInfoJson; // Esta já contém as chaves e não termina com vírgula
     jsonResponse += "}}";
 
@@ -226,28 +514,163 @@ String getBaseStationInfoJson() {
 }
 // Handler para retornar apenas dados do altímetro
 void handleAltimetroJSON() {
-    String jsonResponse = "{\"altimetro\":" + getAltimetroPayloadJson() + "}";
+    const SensorData dados = ultimaAmostra.load();
+    String jsonResponse = "{\"altimetro\":" + getAltimetroPayloadJson(dados) + "}";
     server.send(200, "application/json", jsonResponse);
 }
 
 // Handler para retornar apenas dados do acelerômetro
 void handleAcelerometroJSON() {
-    String jsonResponse = "{\"acelerometro\":" + getAcelerometroPayloadJson() + "}";
+    const SensorData dados = ultimaAmostra.load();
+    String jsonResponse = "{\"acelerometro\":" + getAcelerometroPayloadJson(dados) + "}";
     server.send(200, "application/json", jsonResponse);
 }
 
 // Handler para retornar apenas dados de tensão
 void handleTensaoJSON() {
-    String jsonResponse = "{\"tensao\":" + getTensaoPayloadJson() + "}";
+    const SensorData dados = ultimaAmostra.load();
+    String jsonResponse = "{\"tensao\":" + getTensaoPayloadJson(dados) + "}";
+    server.send(200, "application/json", jsonResponse);
+}
+
+// Handler para retornar apenas a contabilidade do enlace
+void handleLinkJSON() {
+    const SensorData dados = ultimaAmostra.load();
+    String jsonResponse = "{\"link\":" + getLinkPayloadJson(dados) + "}";
     server.send(200, "application/json", jsonResponse);
 }
 
 // Handler para retornar apenas dados do GPS
 void handleGpsJSON() {
-    String jsonResponse = "{\"gps\":" + getGpsPayloadJson() + "}";
+    const SensorData dados = ultimaAmostra.load();
+    String jsonResponse = "{\"gps\":" + getGpsPayloadJson(dados) + "}";
     server.send(200, "application/json", jsonResponse);
 }
 
+// Retorna uma string JSON para uma amostra do histórico. Ex: {"seq":VAL,"timestamp_us":VAL,...,"gps":{...}}
+String getAmostraPayloadJson(uint32_t sequencia, const SensorData &dados) {
+    return "{\"seq\":" + String((unsigned long)sequencia) +
+           ",\"timestamp_us\":" + String((unsigned long)dados.timestampUs) +
+           ",\"phase\":\"" + String(Telemetry::phaseName(dados.phase)) + "\"" +
+           ",\"altimetro\":" + getAltimetroPayloadJson(dados) +
+           ",\"acelerometro\":" + getAcelerometroPayloadJson(dados) +
+           ",\"voltage_rocket\":" + String(dados.tensao.voltage_rocket, 2) +
+           ",\"gps\":" + getGpsPayloadJson(dados) + "}";
+}
+
+// Handler que mantém a conexão aberta e envia um evento por quadro
+void handleEvents() {
+    if (Events::attach(server.client())) {
+        eventoCompleto = true;
+    } else {
+        server.send(503, "text/plain", "Limite de conexoes em /events");
+    }
+}
+
+// Handler para retornar as amostras guardadas, a partir de uma sequência ou de um instante
+// Ex: /json/history?since=SEQ&limit=N ou /json/history?from_us=TEMPO; o cliente continua de "next"
+void handleHistoryJSON() {
+    const uint32_t fim = History::total();
+    uint32_t sequencia = History::oldest();
+    if (server.hasArg("since")) {
+        sequencia = strtoul(server.arg("since").c_str(), nullptr, 10);
+    } else if (server.hasArg("from_us")) {
+        sequencia = History::find(strtoul(server.arg("from_us").c_str(), nullptr, 10));
+    }
+    // Sequência à frente da Base (a Base reiniciou): recomeça do início
+    if (sequencia > fim) sequencia = History::oldest();
+
+    size_t limite = Config::History::MAX_PAGE;
+    if (server.hasArg("limit")) {
+        const unsigned long pedido = strtoul(server.arg("limit").c_str(), nullptr, 10);
+        if (pedido > 0 && pedido < limite) limite = pedido;
+    }
+
+    // Resposta em partes: uma amostra por vez, sem montar o JSON inteiro na RAM
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "application/json", "{\"samples\":[");
+
+    uint32_t perdidas = 0;
+    size_t enviadas = 0;
+    while (sequencia < fim && enviadas < limite) {
+        SensorData dados;
+        if (!History::get(sequencia, dados)) {
+            // Já sobrescrita: segue da mais antiga ainda guardada
+            const uint32_t primeira = History::oldest();
+            const uint32_t proxima = primeira > sequencia ? primeira : sequencia + 1;
+            perdidas += proxima - sequencia;
+            sequencia = proxima;
+            continue;
+        }
+        String parte = enviadas > 0 ? "," : "";
+        parte += getAmostraPayloadJson(sequencia, dados);
+        server.sendContent(parte);
+        enviadas++;
+        sequencia++;
+    }
+
+    server.sendContent("],\"missed\":" + String((unsigned long)perdidas) +
+                       ",\"next\":" + String((unsigned long)sequencia) +
+                       ",\"total\":" + String((unsigned long)History::total()) + "}");
+    server.sendContent("");  // Fim da resposta em partes
+}
+
+// Retorna uma string JSON com a transferência do arquivo de voo. Ex: {"state":"recebendo",...,"kbps":VAL}
+String getDownloadPayloadJson() {
+    Download::Status s;
+    Download::status(s);
+    const float kbps = s.elapsedMs > 0 ? (s.written / 1024.0f) / (s.elapsedMs / 1000.0f) : 0.0f;
+
+    return "{\"state\":\"" + String(Download::stateName(s.state)) + "\"" +
+           ",\"answer\":\"" + String(Download::answerName(s.answer)) + "\"" +
+           ",\"name\":\"" + escaparJSON(s.name) + "\"" +
+           ",\"size\":" + String((unsigned long)s.size) +
+           ",\"written\":" + String((unsigned long)s.written) +
+           ",\"elapsed_ms\":" + String((unsigned long)s.elapsedMs) +
+           ",\"kbps\":" + String(kbps, 1) +
+           ",\"received\":" + String((unsigned long)s.stats.received) +
+           ",\"duplicates\":" + String((unsigned long)s.stats.duplicates) +
+           ",\"out_of_order\":" + String((unsigned long)s.stats.outOfOrder) +
+           ",\"acks\":" + String((unsigned long)s.stats.acks) +
+           ",\"queue_drops\":" + String((unsigned long)s.queueDrops) + "}";
+}
+
+// Handler para retornar apenas a transferência do arquivo de voo
+void handleLogJSON() {
+    String jsonResponse = "{\"log\":" + getDownloadPayloadJson() + "}";
+    server.send(200, "application/json", jsonResponse);
+}
+
+// Handler que pede o arquivo de voo ao foguete (POST; GET recebe 405)
+void handleLogStart() {
+    if (Download::request()) {
+        server.send(202, "text/plain", "Pedido enviado ao foguete; acompanhe em /json/log");
+    } else {
+        server.send(409, "text/plain", "Foguete ainda nao visto ou transferencia em andamento");
+    }
+}
+
+// Handler que entrega o arquivo de voo recebido
+void handleLogFile() {
+    Download::Status s;
+    Download::status(s);
+    File arquivo = s.state == Transfer::Receiver::DONE ? LittleFS.open(Config::Download::FILE_NAME, FILE_READ)
+                                                       : File();
+    if (!arquivo) {
+        server.send(404, "text/plain", "Nenhum arquivo de voo completo");
+        return;
+    }
+    // Nome do arquivo no foguete, sem a barra inicial; vem do rádio, então
+    // só letras, dígitos, '.', '_' e '-' vão para o cabeçalho
+    String nome;
+    for (const char *p = s.name[0] == '/' ? s.name + 1 : s.name; *p != '\0'; p++) {
+        if (isalnum(static_cast<unsigned char>(*p)) || *p == '.' || *p == '_' || *p == '-') nome += *p;
+    }
+    server.sendHeader("Content-Disposition", "attachment; filename=\"" + nome + "\"");
+    server.streamFile(arquivo, "application/octet-stream");
+    arquivo.close();
+}
+
  /**
   * @brief Função de configuração inicial do sistema
   * 
@@ -257,9 +680,20 @@ void handleGpsJSON() {
  void setup() {
     // Inicialização serial
     Serial.begin(115200);
+    tarefaLoop = xTaskGetCurrentTaskHandle();  // setup() e loop() rodam na mesma tarefa
     while(!Serial) { delay(10); }
+    // A configuração segue imprimindo direto; os callbacks do WiFi
+    // passam pelo registro assíncrono
+    if (!Log::start()) {
+      Serial.println("Erro ao criar a tarefa de registro");
+    }
     meuServo.setPeriodHertz(50); // frequência típica de servos (50 Hz)
     meuServo.attach(Config::Hardware::SERVO_PIN, 500, 2400); // Pino do servo motor
+
+    // Tensão da base: ADC contínuo por DMA, lido sob demanda pelas páginas
+    if (!Battery::start()) {
+      Serial.println("Erro ao iniciar o ADC continuo");
+    }
     // Configuração do modo WiFi
     WiFi.mode(WIFI_AP_STA);  // Modo misto para ESP-NOW e AP
     WiFi.softAPConfig(Config::Network::AP_IP, Config::Network::AP_IP, Config::Network::SUBNET_MASK);
@@ -283,6 +717,11 @@ void handleGpsJSON() {
     }
     esp_now_register_recv_cb(onEspNowReceive);
 
+    // Arquivo de voo: LittleFS e tarefa própria; sem eles resta a telemetria
+    if (!Download::start()) {
+      Serial.println("Erro ao iniciar o download do arquivo de voo");
+    }
+
     // Rotas do servidor web
     server.on("/", handleRoot);
     server.on("/json", handleJSON);
@@ -290,6 +729,16 @@ void handleGpsJSON() {
     server.on("/json/tensao", handleTensaoJSON);
     server.on("/json/altimetro", handleAltimetroJSON);
     server.on("/json/acelerometro", handleAcelerometroJSON);
+    server.on("/json/link", handleLinkJSON);
+    server.on("/json/history", handleHistoryJSON);
+    server.on("/events", handleEvents);
+    server.on("/json/log", handleLogJSON);
+    server.on("/log/start", HTTP_POST, handleLogStart);
+    server.on("/log/start", HTTP_GET, []() {
+        server.sendHeader("Allow", "POST");
+        server.send(405, "text/plain", "Use POST para pedir o arquivo ao foguete");
+    });
+    server.on("/log/file", handleLogFile);
 
     server.onNotFound([]() {
         server.send(404, "text/plain", "404 Not Found");
@@ -319,20 +768,30 @@ void handleGpsJSON() {
  /**
   * @brief Função de loop principal
   * 
-  * Mantém o servidor web processando requisições e garante 
-  * funcionamento contínuo do sistema.
+  * Mantém o servidor web processando requisições e envia um evento a
+  * /events a cada quadro decodificado.
   */
  void loop() {
+    static uint32_t versaoEnviada = 0;
+    static uint32_t ultimoRelatorio = 0;
+
     // Lida com requisições do servidor web
     server.handleClient();
-    int leituraADC = analogRead(Config::Hardware::ADC_PIN);
-    float tensaoPino = (leituraADC / 4095.0) * VREF;
-    float tensaoReal = tensaoPino * Config::Hardware::ADC_MULTIPLIER;
-    tensaoBase.tensaoReal = tensaoReal;
-    tensaoBase.leituraADC = leituraADC;
-    tensaoBase.tensaoPino = tensaoPino;
-
-    // Pequeno delay para evitar travamentos
-    delay(100);
+
+    // Um quadro novo acorda o loop na hora; sem quadros, segue o ritmo de antes
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(Config::Events::LOOP_WAIT));
+
+    const uint32_t versao = ultimaAmostra.version();
+    if (versao != versaoEnviada) {
+        versaoEnviada = versao;
+        if (Events::clients() > 0) {
+            Events::broadcast(formatarEvento(ultimaAmostra.load(), History::total() - 1));
+        }
+    }
+    Events::keepAlive(millis());
+
+    if (millis() - ultimoRelatorio >= Config::Link::REPORT_INTERVAL) {
+        ultimoRelatorio = millis();
+        enviarRelatorioEnlace();
+    }
  }
- 
\ No newline at end of file
@@ -0,0 +1,121 @@
+/**
+ * @file test_main.cpp
+ * @brief Recuperação de quadros pela paridade (FecDecoder) após reboot do foguete
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Roda no host: pio test -e native -f test_fec
+ *
+ * Depois de um reboot a sequência recomeça do zero, abaixo do grupo que
+ * o decodificador acompanhava. O reset() feito pela Base deve entregar o
+ * que estava retido e deixar a correção valer já no primeiro grupo novo.
+ */
+
+#include <unity.h>
+
+#include <cstring>
+#include <vector>
+
+#include "Fec.h"
+#include "Telemetry.h"
+
+namespace
+{
+    constexpr uint8_t GROUP = 4U;
+
+    /// @brief Sequências entregues pelo decodificador, em ordem
+    std::vector<uint16_t> delivered;
+
+    void sink(const uint8_t *frame, size_t len, void *)
+    {
+        uint16_t sequence;
+        TEST_ASSERT_TRUE(Telemetry::sequenceOf(frame, len, sequence));
+        delivered.push_back(sequence);
+    }
+
+    /// @brief Quadro de fluxo com @p sequence e conteúdo que varia com ela
+    std::vector<uint8_t> frame(uint16_t sequence)
+    {
+        Telemetry::StreamHeader header = {};
+        header.version = Telemetry::STREAM_VERSION;
+        header.flags = static_cast<uint8_t>(GROUP << Telemetry::STREAM_FEC_SHIFT);
+        header.sequence = sequence;
+        header.temp = static_cast<int16_t>(sequence * 7);
+
+        std::vector<uint8_t> bytes(sizeof(header) + 4U + (sequence % 3U));
+        memcpy(bytes.data(), &header, sizeof(header));
+        for (size_t i = sizeof(header); i < bytes.size(); i++)
+            bytes[i] = static_cast<uint8_t>(sequence + i);
+        return bytes;
+    }
+
+    /**
+     * @brief Codifica os quadros [first, last] e entrega ao decodificador
+     * @param lost Sequência não entregue (a paridade do grupo ainda chega)
+     */
+    void stream(Telemetry::FecDecoder &decoder, uint16_t first, uint16_t last, int32_t lost)
+    {
+        Telemetry::FecEncoder encoder(GROUP);
+        uint8_t parity[Telemetry::MAX_FRAME_BYTES];
+        size_t parityLen;
+        for (uint32_t s = first; s <= last; s++) {
+            const std::vector<uint8_t> bytes = frame(static_cast<uint16_t>(s));
+            const bool closed = encoder.add(bytes.data(), bytes.size(), parity, parityLen);
+            if (static_cast<int32_t>(s) != lost) decoder.push(bytes.data(), bytes.size());
+            if (closed) decoder.push(parity, parityLen);
+        }
+    }
+}
+
+void setUp()
+{
+    delivered.clear();
+}
+
+void tearDown()
+{
+}
+
+/// @brief Quadro perdido no primeiro grupo do fluxo novo é reconstruído
+void test_recovers_after_rewind()
+{
+    Telemetry::FecDecoder decoder(sink, nullptr);
+    stream(decoder, 1000, 1007, -1);
+    TEST_ASSERT_EQUAL_UINT32(8, delivered.size());
+
+    decoder.reset();
+    delivered.clear();
+    stream(decoder, 0, 7, 1);
+
+    TEST_ASSERT_EQUAL_UINT32(1, decoder.stats().recovered);
+    TEST_ASSERT_EQUAL_UINT32(0, decoder.stats().unrecoverable);
+    TEST_ASSERT_EQUAL_UINT32(8, delivered.size());
+    for (uint16_t s = 0; s < 8; s++) TEST_ASSERT_EQUAL_UINT16(s, delivered[s]);
+}
+
+/// @brief O grupo retido do fluxo anterior é entregue antes do reset
+void test_reset_flushes_retained()
+{
+    Telemetry::FecDecoder decoder(sink, nullptr);
+    const std::vector<uint8_t> a = frame(1000);
+    const std::vector<uint8_t> c = frame(1002);
+    decoder.push(a.data(), a.size());
+    decoder.push(c.data(), c.size());  // 1001 falta: 1002 fica retido
+    TEST_ASSERT_EQUAL_UINT32(1, delivered.size());
+
+    decoder.reset();
+    TEST_ASSERT_EQUAL_UINT32(2, delivered.size());
+    TEST_ASSERT_EQUAL_UINT16(1002, delivered[1]);
+    TEST_ASSERT_EQUAL_UINT32(2, decoder.stats().unrecoverable);  // 1001 e 1003
+
+    decoder.reset();  // Nada retido: não entrega de novo
+    TEST_ASSERT_EQUAL_UINT32(2, delivered.size());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_recovers_after_rewind);
+    RUN_TEST(test_reset_flushes_retained);
+    return UNITY_END();
+}
@@ -0,0 +1,131 @@
+/**
+ * @file test_main.cpp
+ * @brief Contabilidade de perdas do enlace (LinkMonitor)
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Roda no host: pio test -e native -f test_link_stats
+ */
+
+#include <unity.h>
+
+#include "LinkStats.h"
+
+namespace
+{
+    /// @brief Como Config::Link::RESYNC_GAP (Config.h depende do Arduino)
+    constexpr uint16_t RESYNC_GAP = 1000U;
+
+    void receive(LinkMonitor &link, uint16_t first, uint16_t last)
+    {
+        for (uint32_t s = first; s <= last; s++) link.record(static_cast<uint16_t>(s));
+    }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/// @brief Lacuna conta como rajada; o quadro que chega atrasado deixa de ser perda
+void test_loss_and_reorder()
+{
+    LinkMonitor link(RESYNC_GAP);
+    receive(link, 0, 9);
+    receive(link, 13, 20);  // 10, 11 e 12 faltam
+    link.record(11);         // Chega atrasado
+    link.record(11);         // E repetido
+
+    const LinkStats &s = link.stats();
+    TEST_ASSERT_EQUAL_UINT32(19, s.received);
+    TEST_ASSERT_EQUAL_UINT32(2, s.lost);
+    TEST_ASSERT_EQUAL_UINT32(1, s.reordered);
+    TEST_ASSERT_EQUAL_UINT32(1, s.duplicates);
+    TEST_ASSERT_EQUAL_UINT32(1, s.bursts);
+    TEST_ASSERT_EQUAL_UINT32(3, s.maxBurst);
+    TEST_ASSERT_EQUAL_UINT32(0, s.resets);
+}
+
+/// @brief A volta de 65535 para 0 é continuidade, não reinício
+void test_wraparound()
+{
+    LinkMonitor link(RESYNC_GAP);
+    receive(link, 65530, 65535);
+    receive(link, 0, 5);
+
+    const LinkStats &s = link.stats();
+    TEST_ASSERT_EQUAL_UINT32(12, s.received);
+    TEST_ASSERT_EQUAL_UINT32(0, s.lost);
+    TEST_ASSERT_EQUAL_UINT32(0, s.resets);
+}
+
+/// @brief Reinício do foguete no começo do voo: a sequência volta a 0
+void test_reboot_rewinds_to_zero()
+{
+    LinkMonitor link(RESYNC_GAP);
+    receive(link, 0, 30);
+    receive(link, 0, 20);  // Mesmos números de antes, que a janela ainda lembra
+
+    const LinkStats &s = link.stats();
+    TEST_ASSERT_EQUAL_UINT32(1, s.resets);
+    TEST_ASSERT_EQUAL_UINT32(52, s.received);
+    TEST_ASSERT_EQUAL_UINT32(0, s.duplicates);
+    TEST_ASSERT_EQUAL_UINT32(0, s.reordered);
+    TEST_ASSERT_EQUAL_UINT32(0, s.lost);
+    TEST_ASSERT_EQUAL_UINT16(20, s.lastSequence);
+}
+
+/// @brief Reinício em que os primeiros quadros se perderam
+void test_reboot_first_frames_lost()
+{
+    LinkMonitor link(RESYNC_GAP);
+    receive(link, 0, 40);
+    receive(link, LinkMonitor::REWIND_SLACK, 50);
+
+    const LinkStats &s = link.stats();
+    TEST_ASSERT_EQUAL_UINT32(1, s.resets);
+    TEST_ASSERT_EQUAL_UINT32(0, s.duplicates);
+    TEST_ASSERT_EQUAL_UINT32(0, s.lost);
+}
+
+/// @brief Reinício tardio: salto para trás maior que a janela
+void test_reboot_far_behind()
+{
+    LinkMonitor link(RESYNC_GAP);
+    receive(link, 0, 500);
+    receive(link, 100, 110);  // Nem perto de 0 nem dentro da janela
+
+    const LinkStats &s = link.stats();
+    TEST_ASSERT_EQUAL_UINT32(1, s.resets);
+    TEST_ASSERT_EQUAL_UINT32(0, s.duplicates);
+    TEST_ASSERT_EQUAL_UINT32(0, s.lost);
+    TEST_ASSERT_EQUAL_UINT32(512, s.received);
+}
+
+/// @brief Repetição do quadro anterior logo no começo não é reinício
+void test_early_duplicate_is_not_reboot()
+{
+    LinkMonitor link(RESYNC_GAP);
+    receive(link, 0, 3);
+    link.record(2);
+    link.record(0);
+
+    const LinkStats &s = link.stats();
+    TEST_ASSERT_EQUAL_UINT32(0, s.resets);
+    TEST_ASSERT_EQUAL_UINT32(2, s.duplicates);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_loss_and_reorder);
+    RUN_TEST(test_wraparound);
+    RUN_TEST(test_reboot_rewinds_to_zero);
+    RUN_TEST(test_reboot_first_frames_lost);
+    RUN_TEST(test_reboot_far_behind);
+    RUN_TEST(test_early_duplicate_is_not_reboot);
+    return UNITY_END();
+}
@@ -0,0 +1,308 @@
+/**
+ * @file test_main.cpp
+ * @brief Ida e volta dos pacotes de telemetria (v2, lote v3 e fluxo v4)
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Roda no host: pio test -e native -f test_telemetry
+ *
+ * Este arquivo deve ser idêntico em Foguete e Base, como Telemetry.h e
+ * Telemetry.cpp: o que uma placa empacota a outra tem de desempacotar.
+ */
+
+#include <unity.h>
+
+#include <cmath>
+#include <cstring>
+
+#include "Telemetry.h"
+
+namespace
+{
+    /// @brief Leitura típica em voo, com todos os campos preenchidos
+    SensorData sample(uint32_t timestampUs)
+    {
+        SensorData d;
+        memset(&d, 0, sizeof(d));
+        d.timestampUs = timestampUs;
+        d.phase = 2;
+        d.acelerometro.accX = 1.234f;
+        d.acelerometro.accY = -9.81f;
+        d.acelerometro.accZ = 45.0f;
+        d.acelerometro.gyroX = 0.5f;
+        d.acelerometro.gyroY = -3.2f;
+        d.acelerometro.gyroZ = 12.0f;
+        d.acelerometro.temp = 27.35f;
+        d.acelerometro.pitch = 85.5f;
+        d.acelerometro.roll = -12.25f;
+        d.altimetro.pressure = 925.43f;
+        d.tensao.voltage_rocket = 7.412f;
+        d.gps.latitude = -23.5505199;
+        d.gps.longitude = -46.6333094;
+        d.gps.altitude = 760.3;
+        d.gps.year = 2026;
+        d.gps.month = 10;
+        d.gps.day = 16;
+        d.gps.hour = 23;
+        d.gps.minute = 59;
+        d.gps.second = 58;
+        d.gps.fixAge = 250;
+        d.gps.hdop = 1.3f;
+        d.gps.satellites = 11;
+        return d;
+    }
+
+    /// @brief Cada campo volta dentro de meio passo da sua escala
+    void assertSame(const SensorData &expected, const SensorData &actual)
+    {
+        using namespace Telemetry;
+        TEST_ASSERT_EQUAL_UINT32(expected.timestampUs, actual.timestampUs);
+        TEST_ASSERT_EQUAL_UINT8(expected.phase, actual.phase);
+        TEST_ASSERT_FLOAT_WITHIN(ACC_SCALE / 2, expected.acelerometro.accX, actual.acelerometro.accX);
+        TEST_ASSERT_FLOAT_WITHIN(ACC_SCALE / 2, expected.acelerometro.accY, actual.acelerometro.accY);
+        TEST_ASSERT_FLOAT_WITHIN(ACC_SCALE / 2, expected.acelerometro.accZ, actual.acelerometro.accZ);
+        TEST_ASSERT_FLOAT_WITHIN(GYRO_SCALE / 2, expected.acelerometro.gyroX, actual.acelerometro.gyroX);
+        TEST_ASSERT_FLOAT_WITHIN(GYRO_SCALE / 2, expected.acelerometro.gyroY, actual.acelerometro.gyroY);
+        TEST_ASSERT_FLOAT_WITHIN(GYRO_SCALE / 2, expected.acelerometro.gyroZ, actual.acelerometro.gyroZ);
+        TEST_ASSERT_FLOAT_WITHIN(ANGLE_SCALE / 2, expected.acelerometro.pitch, actual.acelerometro.pitch);
+        TEST_ASSERT_FLOAT_WITHIN(ANGLE_SCALE / 2, expected.acelerometro.roll, actual.acelerometro.roll);
+        TEST_ASSERT_FLOAT_WITHIN(0.005f, expected.altimetro.pressure, actual.altimetro.pressure);
+        TEST_ASSERT_FLOAT_WITHIN(TEMP_SCALE / 2, expected.acelerometro.temp, actual.acelerometro.temp);
+        TEST_ASSERT_FLOAT_WITHIN(VOLTAGE_SCALE / 2, expected.tensao.voltage_rocket, actual.tensao.voltage_rocket);
+        TEST_ASSERT_FLOAT_WITHIN(COORDINATE_SCALE / 2, expected.gps.latitude, actual.gps.latitude);
+        TEST_ASSERT_FLOAT_WITHIN(COORDINATE_SCALE / 2, expected.gps.longitude, actual.gps.longitude);
+        TEST_ASSERT_FLOAT_WITHIN(GPS_ALTITUDE_SCALE / 2, expected.gps.altitude, actual.gps.altitude);
+        TEST_ASSERT_EQUAL_INT(expected.gps.year, actual.gps.year);
+        TEST_ASSERT_EQUAL_INT(expected.gps.second, actual.gps.second);
+        TEST_ASSERT_EQUAL_UINT32(expected.gps.fixAge, actual.gps.fixAge);
+        TEST_ASSERT_FLOAT_WITHIN(0.05f, expected.gps.hdop, actual.gps.hdop);
+        TEST_ASSERT_EQUAL_UINT8(expected.gps.satellites, actual.gps.satellites);
+    }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/// @brief PacketV2: todos os campos voltam dentro da quantização
+void test_packet_round_trip()
+{
+    const SensorData in = sample(123456789U);
+    Telemetry::PacketV2 packet;
+    Telemetry::encode(in, packet);
+
+    SensorData out;
+    memset(&out, 0, sizeof(out));
+    TEST_ASSERT_TRUE(Telemetry::decode(reinterpret_cast<const uint8_t *>(&packet), sizeof(packet), out));
+    assertSame(in, out);
+
+    // A altitude barométrica é recalculada da pressão, com a fórmula do foguete
+    const float expected = 44330.0f * (1.0f - powf(in.altimetro.pressure / Telemetry::SEA_LEVEL_PRESSURE, 0.1903f));
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, expected, out.altimetro.altitude);
+}
+
+/// @brief Fora da faixa satura no extremo em vez de dar a volta
+void test_saturation()
+{
+    SensorData in = sample(1);
+    in.acelerometro.accX = 500.0f;      // ±163 m/s² cabem
+    in.acelerometro.accY = -500.0f;
+    in.acelerometro.gyroZ = 100.0f;     // ±32 rad/s cabem
+    in.tensao.voltage_rocket = -1.0f;   // Sem sinal
+    in.altimetro.pressure = 1200.0f;    // Acima de PRESSURE_OFFSET_PA + 65535 Pa
+    in.gps.hdop = 99.0f;                // 8 bits de 0,1
+    in.gps.fixAge = 100000U;
+
+    Telemetry::PacketV2 packet;
+    Telemetry::encode(in, packet);
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, packet.acc[0]);
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, packet.acc[1]);
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, packet.gyro[2]);
+    TEST_ASSERT_EQUAL_UINT16(0, packet.voltage);
+    TEST_ASSERT_EQUAL_UINT16(UINT16_MAX, packet.pressure);
+    TEST_ASSERT_EQUAL_UINT8(UINT8_MAX, packet.hdop);
+    TEST_ASSERT_EQUAL_UINT16(Telemetry::NO_FIX, packet.fixAge);
+
+    in.altimetro.pressure = 300.0f;     // Abaixo de PRESSURE_OFFSET_PA
+    Telemetry::encode(in, packet);
+    TEST_ASSERT_EQUAL_UINT16(0, packet.pressure);
+}
+
+/// @brief NaN de um sensor com falha vira o mínimo do campo, não lixo
+void test_nan_is_clamped()
+{
+    SensorData in = sample(1);
+    in.acelerometro.accZ = NAN;
+    in.acelerometro.pitch = NAN;
+    in.altimetro.pressure = NAN;
+    in.tensao.voltage_rocket = NAN;
+
+    Telemetry::PacketV2 packet;
+    Telemetry::encode(in, packet);
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, packet.acc[2]);
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, packet.pitch);
+    TEST_ASSERT_EQUAL_UINT16(0, packet.pressure);
+    TEST_ASSERT_EQUAL_UINT16(0, packet.voltage);
+}
+
+/// @brief Data e hora compactadas: ida e volta, limites e data desconhecida
+void test_utc_pack_unpack()
+{
+    GPSData gps;
+    memset(&gps, 0, sizeof(gps));
+    const int dates[][6] = {{2000, 1, 1, 0, 0, 0}, {2026, 10, 16, 23, 59, 59}, {2063, 12, 31, 23, 59, 60}};
+    for (const int *d : dates) {
+        gps.year = d[0];
+        gps.month = d[1];
+        gps.day = d[2];
+        gps.hour = d[3];
+        gps.minute = d[4];
+        gps.second = d[5];
+        const uint32_t utc = Telemetry::packUtc(gps);
+        TEST_ASSERT_TRUE(utc != 0);
+
+        GPSData back;
+        Telemetry::unpackUtc(utc, back);
+        TEST_ASSERT_EQUAL_INT(d[0], back.year);
+        TEST_ASSERT_EQUAL_INT(d[1], back.month);
+        TEST_ASSERT_EQUAL_INT(d[2], back.day);
+        TEST_ASSERT_EQUAL_INT(d[3], back.hour);
+        TEST_ASSERT_EQUAL_INT(d[4], back.minute);
+        TEST_ASSERT_EQUAL_INT(d[5], back.second);
+    }
+
+    // Sem data do GPS, ou fora do que 6 bits de ano representam
+    gps.year = 0;
+    TEST_ASSERT_EQUAL_UINT32(0, Telemetry::packUtc(gps));
+    gps.year = 2064;
+    TEST_ASSERT_EQUAL_UINT32(0, Telemetry::packUtc(gps));
+    gps.year = 2026;
+    gps.month = 13;
+    TEST_ASSERT_EQUAL_UINT32(0, Telemetry::packUtc(gps));
+
+    GPSData unknown;
+    memset(&unknown, 0xFF, sizeof(unknown));
+    Telemetry::unpackUtc(0, unknown);
+    TEST_ASSERT_EQUAL_INT(0, unknown.year);
+    TEST_ASSERT_EQUAL_INT(0, unknown.month);
+    TEST_ASSERT_EQUAL_INT(0, unknown.second);
+}
+
+/// @brief Versão ou tamanho errados são rejeitados e a saída fica intocada
+void test_rejects_wrong_version_or_size()
+{
+    const SensorData in = sample(42);
+    uint8_t bytes[sizeof(Telemetry::PacketV2) + 1];
+    Telemetry::PacketV2 packet;
+    Telemetry::encode(in, packet);
+    memcpy(bytes, &packet, sizeof(packet));
+
+    SensorData out;
+    memset(&out, 0xA5, sizeof(out));
+    SensorData untouched;
+    memcpy(&untouched, &out, sizeof(out));
+
+    TEST_ASSERT_FALSE(Telemetry::decode(bytes, sizeof(packet) - 1, out));
+    TEST_ASSERT_FALSE(Telemetry::decode(bytes, sizeof(packet) + 1, out));
+    bytes[0] = Telemetry::PACKET_VERSION + 1;
+    TEST_ASSERT_FALSE(Telemetry::decode(bytes, sizeof(packet), out));
+    TEST_ASSERT_EQUAL_MEMORY(&untouched, &out, sizeof(out));
+
+    // Lote com contagem que não bate com o tamanho, ou versão desconhecida
+    SensorData samples[3] = {sample(1000), sample(2000), sample(3000)};
+    uint8_t frame[Telemetry::MAX_FRAME_BYTES];
+    size_t packed;
+    const size_t len = Telemetry::encodeBatch(samples, 3, frame, packed);
+    SensorData decoded[3];
+    TEST_ASSERT_EQUAL_size_t(0, Telemetry::decodeBatch(frame, len - 1, decoded, 3));
+    TEST_ASSERT_EQUAL_size_t(0, Telemetry::decodeBatch(frame, len, decoded, 2));
+    frame[0] = 0x7F;
+    TEST_ASSERT_EQUAL_size_t(0, Telemetry::decodeBatch(frame, len, decoded, 3));
+}
+
+/// @brief Lote v3: amostras e intervalos voltam na ordem
+void test_batch_round_trip()
+{
+    SensorData samples[4];
+    for (size_t i = 0; i < 4; i++) {
+        samples[i] = sample(1000000U + static_cast<uint32_t>(i) * 1001U);
+        samples[i].acelerometro.accZ = 10.0f * static_cast<float>(i);
+    }
+    uint8_t frame[Telemetry::MAX_FRAME_BYTES];
+    size_t packed;
+    const size_t len = Telemetry::encodeBatch(samples, 4, frame, packed);
+    TEST_ASSERT_EQUAL_size_t(4, packed);
+
+    SensorData decoded[4];
+    TEST_ASSERT_EQUAL_size_t(4, Telemetry::decodeBatch(frame, len, decoded, 4));
+    for (size_t i = 0; i < 4; i++) assertSame(samples[i], decoded[i]);
+}
+
+/// @brief Fluxo v4: keyframe e quadros delta reconstroem as amostras
+void test_stream_round_trip()
+{
+    Telemetry::StreamEncoder encoder(4, 0);
+    Telemetry::StreamDecoder decoder;
+    uint32_t t = 5000000U;
+    for (int frameIndex = 0; frameIndex < 6; frameIndex++) {
+        SensorData samples[5];
+        for (size_t i = 0; i < 5; i++) {
+            samples[i] = sample(t);
+            samples[i].acelerometro.accX = 0.37f * static_cast<float>(frameIndex * 5 + static_cast<int>(i));
+            samples[i].status = frameIndex % 2 ? Telemetry::STATUS_RECORDER_FAULT : 0;
+            t += 1000U + static_cast<uint32_t>(i % 2);
+        }
+        uint8_t frame[Telemetry::MAX_FRAME_BYTES];
+        size_t packed;
+        const size_t len = encoder.encode(samples, 5, frame, packed);
+        TEST_ASSERT_EQUAL_size_t(5, packed);
+
+        SensorData decoded[Telemetry::MAX_FRAME_SAMPLES];
+        TEST_ASSERT_EQUAL_size_t(5, decoder.decode(frame, len, decoded, Telemetry::MAX_FRAME_SAMPLES));
+        for (size_t i = 0; i < 5; i++) {
+            assertSame(samples[i], decoded[i]);
+            TEST_ASSERT_EQUAL_UINT8(samples[i].status, decoded[i].status);  // Vai no cabeçalho, como o estado do rádio
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, decoder.skipped());
+}
+
+/// @brief Relatório de enlace: aceito inteiro, recusado com outra versão ou tamanho
+void test_link_report()
+{
+    Telemetry::LinkReport report = {};
+    report.version = Telemetry::LINK_REPORT_VERSION;
+    report.lastSequence = 65535;
+    report.received = 123456U;
+    report.lost = 789U;
+    uint8_t bytes[sizeof(report) + 1];
+    memcpy(bytes, &report, sizeof(report));
+
+    Telemetry::LinkReport out = {};
+    TEST_ASSERT_TRUE(Telemetry::decodeLinkReport(bytes, sizeof(report), out));
+    TEST_ASSERT_EQUAL_UINT16(65535, out.lastSequence);
+    TEST_ASSERT_EQUAL_UINT32(123456U, out.received);
+    TEST_ASSERT_EQUAL_UINT32(789U, out.lost);
+
+    TEST_ASSERT_FALSE(Telemetry::decodeLinkReport(bytes, sizeof(report) + 1, out));
+    bytes[0] = Telemetry::STREAM_VERSION;
+    TEST_ASSERT_FALSE(Telemetry::decodeLinkReport(bytes, sizeof(report), out));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_packet_round_trip);
+    RUN_TEST(test_saturation);
+    RUN_TEST(test_nan_is_clamped);
+    RUN_TEST(test_utc_pack_unpack);
+    RUN_TEST(test_rejects_wrong_version_or_size);
+    RUN_TEST(test_batch_round_trip);
+    RUN_TEST(test_stream_round_trip);
+    RUN_TEST(test_link_report);
+    return UNITY_END();
+}
@@ -0,0 +1,181 @@
+/**
+ * @file SeqLockStress.cpp
+ * @brief Teste de estresse no host da publicação da última amostra (SeqLock.h)
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Não faz parte do firmware. Compilação e uso, a partir de Base/:
+ *
+ *     g++ -std=gnu++11 -O2 -pthread -Iinclude tools/SeqLockStress.cpp -o seqlock_stress
+ *     ./seqlock_stress [segundos] [leitores]
+ *
+ * Um escritor publica SensorData sem parar, como o callback do ESP-NOW;
+ * vários leitores copiam, como as páginas. Cada valor publicado tem o
+ * número k em timestampUs e todos os outros bytes derivados de k, então
+ * uma cópia com pedaços de dois valores é detectada byte a byte. Os
+ * leitores também conferem que k nunca volta.
+ *
+ * Para comparação, a mesma cópia é feita sem conferir a sequência (como
+ * era a leitura campo a campo de dadosRecebidos); ali as cópias rasgadas
+ * devem aparecer. Com -fsanitize=thread o compilador avisa que não
+ * modela as barreiras, mas como todo acesso é atômico não há corrida.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "SeqLock.h"
+#include "Structs.h"
+
+namespace
+{
+    /// @brief Byte @p i do valor número @p k (fora de timestampUs)
+    uint8_t pattern(uint32_t k, size_t i)
+    {
+        return static_cast<uint8_t>((k * 2654435761U) >> 24 ^ (i * 31U));
+    }
+
+    SensorData make(uint32_t k)
+    {
+        SensorData data;
+        uint8_t *bytes = reinterpret_cast<uint8_t *>(&data);
+        for (size_t i = 0; i < sizeof(data); i++) bytes[i] = pattern(k, i);
+        data.timestampUs = k;
+        return data;
+    }
+
+    /// @retval true Todos os bytes pertencem ao mesmo valor
+    bool whole(const SensorData &data)
+    {
+        const size_t first = offsetof(SensorData, timestampUs);
+        const size_t last = first + sizeof(data.timestampUs);
+        const uint8_t *bytes = reinterpret_cast<const uint8_t *>(&data);
+        for (size_t i = 0; i < sizeof(data); i++) {
+            if (i >= first && i < last) continue;
+            if (bytes[i] != pattern(data.timestampUs, i)) return false;
+        }
+        return true;
+    }
+
+    /// @brief Mesmas palavras do SeqLock, sem a sequência
+    struct Unprotected {
+        static constexpr size_t WORDS = (sizeof(SensorData) + 3) / 4;
+        std::atomic<uint32_t> words[WORDS];
+
+        void store(const SensorData &value)
+        {
+            uint32_t buffer[WORDS] = {};
+            memcpy(buffer, &value, sizeof(value));
+            for (size_t i = 0; i < WORDS; i++) words[i].store(buffer[i], std::memory_order_relaxed);
+        }
+
+        SensorData load() const
+        {
+            uint32_t buffer[WORDS];
+            for (size_t i = 0; i < WORDS; i++) buffer[i] = words[i].load(std::memory_order_relaxed);
+            SensorData out;
+            memcpy(&out, buffer, sizeof(out));
+            return out;
+        }
+    };
+
+    /// @brief Resultado de um leitor
+    struct Counters {
+        uint64_t reads = 0;
+        uint64_t retries = 0;
+        uint64_t torn = 0;
+        uint64_t backwards = 0;
+    };
+
+    SeqLock<SensorData> published;
+    Unprotected unprotected;
+    std::atomic<bool> running{true};
+
+    void writer(uint64_t &writes)
+    {
+        uint32_t k = 1;
+        while (running.load(std::memory_order_relaxed)) {
+            const SensorData data = make(k++);
+            published.store(data);
+            unprotected.store(data);
+        }
+        writes = k - 1;
+    }
+
+    void reader(Counters &locked, Counters &raw)
+    {
+        uint32_t lastLocked = 0;
+        uint32_t lastRaw = 0;
+        while (running.load(std::memory_order_relaxed)) {
+            SensorData data;
+            while (!published.tryLoad(data)) locked.retries++;
+            locked.reads++;
+            if (!whole(data)) locked.torn++;
+            if (data.timestampUs < lastLocked) locked.backwards++;
+            lastLocked = data.timestampUs;
+
+            data = unprotected.load();
+            raw.reads++;
+            if (!whole(data)) raw.torn++;
+            if (data.timestampUs < lastRaw) raw.backwards++;
+            lastRaw = data.timestampUs;
+        }
+    }
+
+    void print(const char *name, const std::vector<Counters> &counters)
+    {
+        Counters total;
+        for (const Counters &c : counters) {
+            total.reads += c.reads;
+            total.retries += c.retries;
+            total.torn += c.torn;
+            total.backwards += c.backwards;
+        }
+        printf("%-10s %12llu %10llu %10llu %10llu\n", name, (unsigned long long)total.reads,
+               (unsigned long long)total.retries, (unsigned long long)total.torn,
+               (unsigned long long)total.backwards);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const double seconds = argc > 1 ? atof(argv[1]) : 3.0;
+    size_t readers = std::thread::hardware_concurrency() > 2 ? std::thread::hardware_concurrency() - 1 : 2;
+    if (argc > 2) readers = static_cast<size_t>(atoi(argv[2]));
+
+    published.store(make(0));
+    unprotected.store(make(0));
+
+    std::vector<Counters> locked(readers);
+    std::vector<Counters> raw(readers);
+    std::vector<std::thread> threads;
+    uint64_t writes = 0;
+
+    threads.emplace_back(writer, std::ref(writes));
+    for (size_t i = 0; i < readers; i++) threads.emplace_back(reader, std::ref(locked[i]), std::ref(raw[i]));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<long>(seconds * 1000.0)));
+    running.store(false);
+    for (std::thread &t : threads) t.join();
+
+    printf("%llu escritas de %zu bytes, %zu leitores, %.1f s\n\n", (unsigned long long)writes,
+           sizeof(SensorData), readers, seconds);
+    printf("%-10s %12s %10s %10s %10s\n", "copia", "leituras", "repeticoes", "rasgadas", "voltas");
+    print("seqlock", locked);
+    print("sem trava", raw);
+
+    for (const Counters &c : locked) {
+        if (c.torn != 0 || c.backwards != 0) {
+            printf("\nFALHA: o seqlock entregou uma copia inconsistente\n");
+            return 1;
+        }
+    }
+    printf("\nseqlock ok\n");
+    return 0;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file Ahrs.h
+ * @brief Estimador de orientação por quatérnio (filtro de Mahony)
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Integra o giroscópio em um quatérnio e corrige a deriva com a direção
+ * da gravidade medida pelo acelerômetro, estimando também o viés do
+ * giroscópio. Ao contrário dos ângulos de Euler, o quatérnio não tem
+ * singularidade em voo vertical; pitch, roll e yaw são apenas saídas
+ * derivadas para exibição.
+ *
+ * Não depende do Arduino: recebe grandezas em SI e o passo de tempo.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Filtro de Mahony com realimentação proporcional e integral
+ *
+ * @details O termo proporcional puxa a gravidade estimada para a medida;
+ * o termo integral converge para o negativo do viés do giroscópio. A
+ * correção só é aplicada quando o módulo da aceleração está próximo de
+ * 1 g: durante a propulsão o acelerômetro não mede a gravidade e o filtro
+ * segue apenas o giroscópio.
+ *
+ * @note Sem magnetômetro, o yaw e o viés do giroscópio em torno da
+ * vertical não são observáveis e derivam livremente.
+ */
+class Ahrs
+{
+public:
+    /**
+     * @param kp Ganho proporcional ((rad/s)/rad)
+     * @param ki Ganho integral da estimativa de viés ((rad/s²)/rad)
+     * @param accelGate Desvio relativo máximo de |a| em relação a 1 g
+     *                  para que o acelerômetro seja usado na correção
+     */
+    Ahrs(float kp, float ki, float accelGate);
+
+    /**
+     * @brief Alinha a orientação à gravidade medida
+     *
+     * @details Usa o menor giro que leva o eixo Z ao vetor medido, com yaw
+     * zero. Zera a estimativa de viés.
+     *
+     * @param acc Aceleração nos eixos X, Y e Z (m/s²)
+     */
+    void align(const float acc[3]);
+
+    /**
+     * @brief Avança o filtro um passo
+     *
+     * @param gyro Velocidade angular nos eixos X, Y e Z (rad/s)
+     * @param acc Aceleração nos eixos X, Y e Z (m/s²)
+     * @param dt Passo de tempo (s)
+     * @retval true O acelerômetro foi usado na correção
+     * @retval false Passo apenas com o giroscópio
+     */
+    bool update(const float gyro[3], const float acc[3], float dt);
+
+    /// @brief Quatérnio corpo -> referência, na ordem w, x, y, z
+    const float *quaternion() const { return q_; }
+
+    /// @brief Viés estimado do giroscópio nos eixos X, Y e Z (rad/s)
+    void gyroBias(float out[3]) const;
+
+    /// @brief Vertical da referência (para cima) expressa no corpo
+    void up(float out[3]) const;
+
+    /**
+     * @brief Ângulos derivados do quatérnio (graus)
+     *
+     * @details Pitch e roll seguem a mesma convenção do antigo filtro
+     * complementar (calculados sobre a gravidade no referencial do corpo),
+     * portanto são diretamente comparáveis aos valores históricos.
+     */
+    void angles(float &pitch, float &roll, float &yaw) const;
+
+private:
+    float kp_;
+    float ki_;
+    float accelGate_;
+
+    /// @brief Quatérnio de orientação (w, x, y, z)
+    float q_[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+
+    /// @brief Termo integral; converge para o negativo do viés (rad/s)
+    float integral_[3] = {0.0f, 0.0f, 0.0f};
+};
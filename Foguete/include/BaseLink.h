@@ -0,0 +1,83 @@
+/**
+ * @file BaseLink.h
+ * @brief Mensagens da Base ao foguete: relatórios de enlace e transferência
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * A telemetria vai a Config::EspNow::broadcastAddress, um endereço de
+ * grupo (primeiro octeto ímpar); nenhum rádio transmite a partir dele.
+ * A Base responde do seu próprio MAC de estação, que o foguete não
+ * conhece de antemão: o remetente do primeiro relatório de enlace ou
+ * pedido de arquivo válido passa a ser a Base, e daí até o reboot do
+ * foguete só as mensagens desse MAC são aceitas.
+ *
+ * O callback de recepção do ESP-NOW é o único produtor; cada fila tem
+ * um consumidor: a transmissão lê os relatórios e a tarefa do download,
+ * as mensagens da transferência.
+ *
+ * Não depende do Arduino: pode ser exercitado no host.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Config.h"
+#include "SpscQueue.h"
+#include "Telemetry.h"
+#include "Transfer.h"
+
+/**
+ * @brief Filtro e filas das mensagens vindas da Base
+ */
+class BaseLink
+{
+public:
+    /// @brief Pedido ou ACK da transferência, copiado do callback
+    struct Message {
+        uint8_t length;
+        uint8_t data[Transfer::MAX_CONTROL_BYTES];
+    };
+
+    /// @brief Destino de uma mensagem recebida
+    enum Route : uint8_t {
+        IGNORED = 0,  ///< Outro remetente, formato desconhecido ou fila cheia
+        REPORT,       ///< Relatório de enlace, na fila da transmissão
+        TRANSFER      ///< Mensagem da transferência, na fila do download
+    };
+
+    /**
+     * @brief Classifica e enfileira uma mensagem do ESP-NOW
+     * @param mac Remetente
+     * @param data Mensagem
+     * @param len Tamanho da mensagem
+     * @return Fila em que a mensagem entrou
+     */
+    Route receive(const uint8_t *mac, const uint8_t *data, int len);
+
+    /// @brief Retira o relatório de enlace mais antigo (tarefa de transmissão)
+    bool popReport(Telemetry::LinkReport &report) { return reports_.pop(report); }
+
+    /// @brief Retira a mensagem da transferência mais antiga (tarefa do download)
+    bool popTransfer(Message &message) { return transfers_.pop(message); }
+
+    /// @brief A Base já foi identificada
+    bool known() const { return known_; }
+
+    /// @brief MAC da Base; válido depois de known()
+    const uint8_t *address() const { return base_; }
+
+    /// @brief Mensagens válidas de outros remetentes, descartadas
+    uint32_t rejected() const { return rejected_; }
+
+private:
+    /// @brief Confere o remetente, fixando-o como a Base se @p learn e ainda não houver uma
+    bool accept(const uint8_t *mac, bool learn);
+
+    SpscQueue<Telemetry::LinkReport, Config::RateControl::REPORT_QUEUE_DEPTH> reports_;
+    SpscQueue<Message, Config::Download::QUEUE_DEPTH> transfers_;
+    uint8_t base_[6] = {};
+    volatile bool known_ = false;
+    volatile uint32_t rejected_ = 0;
+};
@@ -0,0 +1,61 @@
+/**
+ * @file Battery.h
+ * @brief Medição contínua da tensão da bateria pelo ADC em modo DMA
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * O ADC1 amostra o pino de tensão continuamente e entrega blocos por DMA.
+ * Uma tarefa de baixa prioridade faz a média de Config::Adc::OVERSAMPLING
+ * leituras, aplica a calibração de fábrica (esp_adc_cal) e publica a
+ * tensão filtrada. Quem precisa da tensão apenas lê o último valor, sem
+ * tocar no ADC.
+ *
+ * @note O modo contínuo do ESP32 só está disponível no ADC1 (GPIO32..39).
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @namespace Battery
+ * @brief Amostragem do ADC em segundo plano e tensão filtrada
+ */
+namespace Battery
+{
+    /**
+     * @brief Contadores da amostragem
+     *
+     * @details Atualizados apenas pela tarefa do ADC.
+     */
+    struct Stats {
+        /// @brief Leituras do canal recebidas por DMA
+        volatile uint32_t samples;
+
+        /// @brief Valores publicados (um a cada OVERSAMPLING leituras)
+        volatile uint32_t updates;
+
+        /// @brief Vezes em que o buffer do driver encheu e perdeu dados
+        volatile uint32_t overruns;
+    };
+
+    /**
+     * @brief Caracteriza o ADC, inicia a conversão contínua e cria a tarefa
+     *
+     * @retval true ADC e tarefa iniciados
+     * @retval false Pino fora do ADC1 ou falha do driver
+     */
+    bool start();
+
+    /// @brief Tensão filtrada da bateria, já multiplicada pelo divisor (V)
+    float voltage();
+
+    /// @brief Tensão calibrada e filtrada no pino do ADC (V)
+    float pinVoltage();
+
+    /// @brief Média da última janela em contagens brutas (12 bits)
+    uint16_t raw();
+
+    /// @brief Retorna os contadores da amostragem
+    const Stats &stats();
+}
@@ -0,0 +1,159 @@
+/**
+ * @file Bmp280.h
+ * @brief Driver enxuto do barômetro BMP280
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Lê pressão e temperatura brutas em uma única rajada I2C e aplica a
+ * compensação em ponto fixo do datasheet da Bosch uma única vez por
+ * amostra. A taxa de saída do sensor é escolhida a partir do período
+ * de aquisição, e cada leitura informa se trouxe uma conversão nova.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class TwoWire;
+
+/**
+ * @brief Leitura compensada do BMP280
+ */
+struct BaroSample {
+    /// @brief Temperatura em centésimos de grau Celsius
+    int32_t temperature;
+
+    /// @brief Pressão em Pa, formato Q24.8 (dividir por 256)
+    uint32_t pressure;
+
+    /// @brief Indica se a leitura traz uma conversão nova do sensor
+    bool fresh;
+};
+
+/**
+ * @brief Driver do BMP280 com leitura em rajada
+ *
+ * @details Opera em modo normal com oversampling x2 (temperatura),
+ * x16 (pressão) e filtro IIR x16, mantendo a configuração original do
+ * projeto; apenas o tempo de standby é ajustado ao período de aquisição.
+ */
+class Bmp280
+{
+public:
+    /// @brief Coeficientes de calibração gravados de fábrica (0x88..0x9F)
+    struct Calibration {
+        uint16_t t1;
+        int16_t t2, t3;
+        uint16_t p1;
+        int16_t p2, p3, p4, p5, p6, p7, p8, p9;
+    };
+
+    /// @param wire Barramento I2C onde está o sensor
+    explicit Bmp280(TwoWire &wire);
+
+    /**
+     * @brief Detecta o sensor, lê a calibração e configura a amostragem
+     *
+     * @param address Endereço I2C (0x76 ou 0x77)
+     * @param acquisitionPeriodMs Período com que read() será chamado
+     * @retval true Sensor encontrado e configurado
+     * @retval false Sensor ausente ou falha de comunicação
+     */
+    bool begin(uint8_t address, uint32_t acquisitionPeriodMs);
+
+    /**
+     * @brief Lê pressão e temperatura em uma rajada de 6 bytes
+     *
+     * @param out Leitura compensada
+     * @retval false Falha de comunicação I2C
+     */
+    bool read(BaroSample &out);
+
+    /// @brief Período de saída do sensor com a configuração atual (µs)
+    uint32_t outputPeriodUs() const { return outputPeriodUs_; }
+
+    /**
+     * @brief Escolhe o standby para que o sensor acompanhe a aquisição
+     *
+     * @details Retorna o maior tempo de standby com o qual o período de
+     * saída (conversão + standby) não excede @p periodUs. Assim toda
+     * leitura feita no ritmo da aquisição encontra uma conversão nova,
+     * sem o sensor converter mais vezes que o necessário.
+     *
+     * @param measurementUs Duração de uma conversão (µs)
+     * @param periodUs Período de aquisição (µs)
+     * @return Índice t_sb (0..7) do registrador config
+     */
+    static uint8_t standbyFor(uint32_t measurementUs, uint32_t periodUs)
+    {
+        uint8_t best = 0;
+        for (uint8_t i = 0; i < 8; i++) {
+            if (measurementUs + STANDBY_US[i] <= periodUs &&
+                STANDBY_US[i] > STANDBY_US[best])
+                best = i;
+        }
+        return best;
+    }
+
+    /**
+     * @brief Compensação de temperatura (datasheet BMP280, seção 8.2)
+     *
+     * @param adcT Leitura bruta de temperatura (20 bits)
+     * @param calib Coeficientes de calibração
+     * @param tFine Termo fino de temperatura, usado pela compensação de pressão
+     * @return Temperatura em centésimos de grau Celsius
+     */
+    static int32_t compensateTemperature(int32_t adcT, const Calibration &calib, int32_t &tFine)
+    {
+        int32_t var1 = ((((adcT >> 3) - (static_cast<int32_t>(calib.t1) << 1))) *
+                        static_cast<int32_t>(calib.t2)) >> 11;
+        int32_t var2 = (((((adcT >> 4) - static_cast<int32_t>(calib.t1)) *
+                          ((adcT >> 4) - static_cast<int32_t>(calib.t1))) >> 12) *
+                        static_cast<int32_t>(calib.t3)) >> 14;
+        tFine = var1 + var2;
+        return (tFine * 5 + 128) >> 8;
+    }
+
+    /**
+     * @brief Compensação de pressão em 64 bits (datasheet BMP280, seção 8.2)
+     *
+     * @param adcP Leitura bruta de pressão (20 bits)
+     * @param calib Coeficientes de calibração
+     * @param tFine Termo fino calculado por compensateTemperature()
+     * @return Pressão em Pa no formato Q24.8; 0 se a calibração for inválida
+     */
+    static uint32_t compensatePressure(int32_t adcP, const Calibration &calib, int32_t tFine)
+    {
+        int64_t var1 = static_cast<int64_t>(tFine) - 128000;
+        int64_t var2 = var1 * var1 * calib.p6;
+        var2 = var2 + ((var1 * calib.p5) << 17);
+        var2 = var2 + (static_cast<int64_t>(calib.p4) << 35);
+        var1 = ((var1 * var1 * calib.p3) >> 8) + ((var1 * calib.p2) << 12);
+        var1 = (((static_cast<int64_t>(1) << 47) + var1)) * calib.p1 >> 33;
+        if (var1 == 0) return 0;  // Evita divisão por zero
+
+        int64_t p = 1048576 - adcP;
+        p = (((p << 31) - var2) * 3125) / var1;
+        var1 = (static_cast<int64_t>(calib.p9) * (p >> 13) * (p >> 13)) >> 25;
+        var2 = (static_cast<int64_t>(calib.p8) * p) >> 19;
+        p = ((p + var1 + var2) >> 8) + (static_cast<int64_t>(calib.p7) << 4);
+        return static_cast<uint32_t>(p);
+    }
+
+private:
+    /// @brief Tempos de standby do registrador config, por índice t_sb (µs)
+    static constexpr uint32_t STANDBY_US[8] = {
+        500, 62500, 125000, 250000, 500000, 1000000, 2000000, 4000000
+    };
+
+    bool writeRegister(uint8_t reg, uint8_t value);
+    bool readRegisters(uint8_t reg, uint8_t *buffer, size_t len);
+
+    TwoWire &wire_;
+    uint8_t address_ = 0x76;
+    Calibration calib_ = {};
+    uint32_t outputPeriodUs_ = 0;
+    int32_t lastAdcT_ = -1;
+    int32_t lastAdcP_ = -1;
+};
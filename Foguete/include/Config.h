@@ -10,6 +10,7 @@
 
 #pragma once // Diretiva moderna para include guard
 
+#include <cstddef> // Para size_t
 #include <cstdint> // Para tipos integrais de largura específica
 
 /**
@@ -37,8 +38,129 @@ namespace Config
     constexpr uint32_t GPS_RX = 16;
     constexpr uint32_t GPS_TX = 17;
 
-    constexpr uint32_t ADC_PIN = 32;      // Pino ADC para leitura de tensão
-    constexpr float ADC_MULTIPLIER = 2.0; // Porque estamos usando 10k e 10k
+    /// @brief UART do ESP32 ligada ao GPS
+    constexpr uint8_t GPS_UART = 2;
+
+    constexpr uint32_t ADC_PIN = 32;      // Pino ADC para leitura de tensão (ADC1)
+    constexpr float ADC_MULTIPLIER = 2.0f; // Porque estamos usando 10k e 10k
+
+    /// @brief Frequência do barramento I2C (Hz)
+    /// @details Fast-mode, necessário para esvaziar o FIFO do MPU6050 a 1 kHz
+    constexpr uint32_t I2C_CLOCK = 400000U;
+
+    /// @brief Pino ligado ao INT do MPU6050 (sinal de dado pronto)
+    constexpr uint8_t MPU_INT_PIN = 4;
+  }
+
+  /**
+   * @namespace Sensors
+   * @brief Configurações de aquisição dos sensores
+   *
+   * Define o modo de leitura do MPU6050 e as escalas das leituras brutas.
+   */
+  namespace Sensors
+  {
+    /// @brief Modos de aquisição do MPU6050
+    enum class ImuMode : uint8_t
+    {
+      POLLED,     ///< Uma leitura por período de SENSOR_READ_INTERVAL
+      FIFO,       ///< Rajadas do FIFO interno a IMU_SAMPLE_RATE
+      DATA_READY, ///< Uma leitura por pulso no pino INT (MPU_INT_PIN)
+      TIMER       ///< Uma leitura por disparo de um esp_timer periódico
+    };
+
+    /// @brief Modo de aquisição em uso
+    constexpr ImuMode IMU_MODE = ImuMode::FIFO;
+
+    /// @brief Taxa de amostragem do MPU6050 nos modos FIFO, DATA_READY e TIMER (Hz)
+    constexpr uint16_t IMU_SAMPLE_RATE = 1000U;
+
+    /// @brief Tamanho máximo de uma rajada I2C (bytes)
+    /// @details Limitado pelo buffer de 128 bytes da biblioteca Wire
+    constexpr size_t I2C_BURST_BYTES = 120U;
+
+    /// @brief Sensibilidade do acelerômetro na faixa de ±8 g (LSB/g)
+    constexpr float ACCEL_LSB_PER_G = 4096.0f;
+
+    /// @brief Sensibilidade do giroscópio na faixa de ±500 °/s (LSB/(°/s))
+    constexpr float GYRO_LSB_PER_DPS = 65.5f;
+
+    /// @brief Aceleração da gravidade padrão (m/s²)
+    constexpr float GRAVITY = 9.80665f;
+
+    /// @brief Pressão de referência ao nível do mar para o cálculo de altitude (hPa)
+    constexpr float SEA_LEVEL_PRESSURE = 1013.25f;
+
+    /// @brief Ganho proporcional do estimador de orientação ((rad/s)/rad)
+    constexpr float AHRS_KP = 0.5f;
+
+    /// @brief Ganho integral da estimativa de viés do giroscópio ((rad/s²)/rad)
+    constexpr float AHRS_KI = 0.02f;
+
+    /// @brief Desvio relativo máximo de |a| em relação a 1 g para corrigir com o acelerômetro
+    /// @details Fora dessa faixa (propulsão, impacto) só o giroscópio é integrado
+    constexpr float AHRS_ACCEL_GATE = 0.15f;
+
+    /// @brief Maior passo de tempo integrado de uma vez (s)
+    /// @details Lacunas maiores (fila cheia, reinício) não são extrapoladas
+    constexpr float AHRS_MAX_DT = 0.1f;
+
+    /// @brief Orçamento de um passo da fusão (ciclos de CPU)
+    /// @details 10% do período de 1 ms a 240 MHz
+    constexpr uint32_t FUSION_CYCLE_BUDGET = 24000U;
+
+    /// @brief Executa o micro-benchmark da fusão na inicialização
+    /// @details Imprime ciclos por passo da fusão e compara com FUSION_CYCLE_BUDGET;
+    /// atrasa o boot, então só é ligado para medir
+    constexpr bool RUN_FUSION_BENCHMARK = false;
+  }
+
+  /**
+   * @namespace Flight
+   * @brief Limiares da detecção de fases de voo
+   *
+   * Cada transição exige que a condição se mantenha pelo tempo de
+   * confirmação; o evento recebe o instante em que ela começou.
+   */
+  namespace Flight
+  {
+    /// @brief Módulo da aceleração que caracteriza o lançamento (g)
+    constexpr float LAUNCH_ACCEL_G = 3.0f;
+
+    /// @brief Tempo de confirmação do lançamento (µs)
+    constexpr uint32_t LAUNCH_HOLD_US = 5000U;
+
+    /// @brief Tempo de confirmação do fim da propulsão (µs)
+    /// @details Aceleração vertical negativa por este tempo encerra a propulsão
+    constexpr uint32_t BURNOUT_HOLD_US = 10000U;
+
+    /// @brief Duração máxima da propulsão (µs)
+    constexpr uint32_t MAX_BOOST_US = 2000000U;
+
+    /// @brief Queda em relação à altitude máxima que confirma o apogeu (m)
+    /// @details Reserva para o caso de a velocidade inercial não cruzar zero
+    constexpr float APOGEE_DROP_M = 2.0f;
+
+    /// @brief Velocidade vertical máxima para considerar o foguete parado (m/s)
+    constexpr float LANDED_SPEED = 1.0f;
+
+    /// @brief Desvio máximo de |a| em relação a 1 g para considerar o foguete parado (g)
+    constexpr float LANDED_ACCEL_TOLERANCE_G = 0.2f;
+
+    /// @brief Tempo de confirmação do pouso (µs)
+    constexpr uint32_t LANDED_HOLD_US = 2000000U;
+
+    /// @brief Ganho da correção barométrica da altitude (adimensional)
+    constexpr float ALTITUDE_GAIN = 0.2f;
+
+    /// @brief Ganho da correção barométrica da velocidade vertical (1/s)
+    constexpr float SPEED_GAIN = 1.0f;
+
+    /// @brief Ganho com que a altitude de referência acompanha o barômetro na rampa
+    constexpr float GROUND_TRACKING_GAIN = 0.05f;
+
+    /// @brief Profundidade da fila de eventos de voo (fusão -> registro)
+    constexpr size_t EVENT_QUEUE_DEPTH = 8U;
   }
 
   /**
@@ -56,6 +178,286 @@ namespace Config
     /// @brief Intervalo de atualização da página web
     /// @details Período entre atualizações da interface web (em milissegundos)
     constexpr uint16_t WEB_REFRESH_INTERVAL = 2000U;
+
+    /// @brief Intervalo de leitura dos sensores
+    /// @details Período da tarefa de aquisição (em milissegundos) - 10 Hz
+    constexpr uint32_t SENSOR_READ_INTERVAL = 100U;
+
+    /// @brief Intervalo de transmissão de dados
+    /// @details Período inicial da tarefa de transmissão (em milissegundos) - 2 Hz;
+    /// o RateController o ajusta entre os limites de Config::RateControl
+    constexpr uint32_t TRANSMISSION_INTERVAL = 500U;
+
+    /// @brief Intervalo entre amostras enviadas por rádio
+    /// @details A fusão entrega à transmissão uma amostra a cada intervalo
+    /// (em milissegundos) - ~33 Hz; cada quadro leva as amostras do período,
+    /// comprimidas a ~13 bytes por amostra (tools/TelemetryBench.cpp). O
+    /// RateController arredonda o intervalo para um número inteiro de
+    /// amostras por quadro e o alonga acima de RateControl::MAX_BATCH
+    constexpr uint32_t TELEMETRY_SAMPLE_INTERVAL = 30U;
+
+    /// @brief Intervalo de esvaziamento do FIFO do MPU6050
+    /// @details Período da tarefa de aquisição no modo FIFO (em milissegundos)
+    constexpr uint32_t FIFO_DRAIN_INTERVAL = 10U;
+
+    /// @brief Intervalo de impressão de telemetria no console
+    /// @details A fusão roda na taxa do IMU; o console recebe uma amostra
+    /// a cada LOG_INTERVAL (em milissegundos)
+    constexpr uint32_t LOG_INTERVAL = 100U;
+
+    /// @brief Intervalo de relatório das estatísticas do pipeline
+    /// @details Período entre impressões de vazão por estágio (em milissegundos)
+    constexpr uint32_t STATS_REPORT_INTERVAL = 5000U;
+  }
+
+  /**
+   * @namespace Tasks
+   * @brief Configurações das tarefas FreeRTOS do pipeline
+   *
+   * Aquisição e fusão ficam no APP_CPU (núcleo 1), longe da pilha WiFi;
+   * transmissão e registro ficam no PRO_CPU (núcleo 0), junto ao rádio.
+   */
+  namespace Tasks
+  {
+    /// @brief Núcleo das tarefas de aquisição e fusão
+    constexpr int SENSOR_CORE = 1;
+
+    /// @brief Núcleo das tarefas de transmissão e registro
+    constexpr int COMM_CORE = 0;
+
+    /// @brief Prioridades (maior valor = mais prioritária)
+    constexpr uint32_t ACQUISITION_PRIORITY = 5U;
+    constexpr uint32_t FUSION_PRIORITY = 4U;
+    constexpr uint32_t TRANSMISSION_PRIORITY = 3U;
+    constexpr uint32_t GPS_PRIORITY = 2U;
+    constexpr uint32_t LOGGING_PRIORITY = 1U;
+
+    /// @brief Tamanho das pilhas das tarefas (em bytes)
+    constexpr uint32_t ACQUISITION_STACK = 4096U;
+    constexpr uint32_t FUSION_STACK = 4096U;
+    constexpr uint32_t TRANSMISSION_STACK = 4096U;
+    constexpr uint32_t GPS_STACK = 4096U;
+    constexpr uint32_t LOGGING_STACK = 4096U;
+
+    /// @brief Número de posições das filas entre estágios (potência de 2)
+    constexpr size_t QUEUE_DEPTH = 16U;
+
+    /// @brief Posições da fila fusão -> transmissão (potência de 2)
+    /// @details Comporta as amostras de alguns períodos de transmissão,
+    /// inclusive as que sobram quando um quadro enche
+    constexpr size_t TX_QUEUE_DEPTH = 64U;
+
+    /// @brief Posições da fila de amostras brutas (potência de 2)
+    /// @details Comporta vários lotes do FIFO caso a fusão atrase
+    constexpr size_t RAW_QUEUE_DEPTH = 128U;
+
+    /// @brief Máximo de amostras entregues por ciclo de aquisição
+    constexpr size_t ACQUISITION_BATCH = 32U;
+
+    /// @brief Posições da fila de disparos ISR/timer -> aquisição (potência de 2)
+    constexpr size_t TRIGGER_QUEUE_DEPTH = 16U;
+  }
+
+  /**
+   * @namespace Adc
+   * @brief Configurações da amostragem contínua do ADC (tensão da bateria)
+   *
+   * O ADC1 converte em segundo plano por DMA; a tarefa do ADC faz a média
+   * de OVERSAMPLING leituras e aplica um filtro exponencial.
+   */
+  namespace Adc
+  {
+    /// @brief Taxa de conversão do ADC (Hz); 20 kHz é o mínimo no ESP32
+    constexpr uint32_t SAMPLE_RATE_HZ = 20000U;
+
+    /// @brief Leituras por valor publicado (20 Hz a 20 kHz)
+    constexpr uint32_t OVERSAMPLING = 1000U;
+
+    /// @brief Coeficiente do filtro exponencial aplicado às médias
+    constexpr float SMOOTHING = 0.2f;
+
+    /// @brief Bytes entregues pelo DMA a cada interrupção e lidos por chamada
+    constexpr uint32_t READ_BYTES = 256U;
+
+    /// @brief Buffer do driver entre o DMA e a tarefa (bytes)
+    /// @details 100 ms de leituras a 20 kHz
+    constexpr uint32_t DMA_BUFFER_BYTES = 4096U;
+
+    /// @brief Referência padrão para a calibração quando o eFuse não tem Vref (mV)
+    constexpr uint32_t DEFAULT_VREF_MV = 1100U;
+
+    /// @brief Tarefa do ADC
+    constexpr uint32_t TASK_PRIORITY = 1U;
+    constexpr uint32_t TASK_STACK = 3072U;
+    constexpr int TASK_CORE = 0; // Junto ao rádio, longe do IMU
+  }
+
+  /**
+   * @namespace Log
+   * @brief Configurações do registro assíncrono (Log.h)
+   *
+   * Quem registra grava em um buffer circular e segue; uma tarefa de baixa
+   * prioridade esvazia o buffer na serial.
+   */
+  namespace Log
+  {
+    /// @brief Maior nível compilado: 0 nada, 1 erro, 2 aviso, 3 info, 4 depuração
+    /// @details Mensagens acima deste nível não geram código. Em 4, o
+    /// despejo da telemetria em Pipeline::log() volta à serial
+    constexpr uint8_t LEVEL = 3U;
+
+    /// @brief Envia registros binários, formatados no host por tools/LogDecode.cpp
+    constexpr bool BINARY = false;
+
+    /// @brief Mensagens no buffer circular (potência de 2)
+    constexpr size_t SLOTS = 64U;
+
+    /// @brief Maior mensagem, em bytes; as maiores são cortadas
+    constexpr size_t RECORD_BYTES = 120U;
+
+    /// @brief Formatos lembrados pelo modo binário antes de reenviá-los
+    constexpr size_t FORMAT_CACHE = 32U;
+
+    /// @brief Espera da tarefa quando o buffer esvazia (ms)
+    constexpr uint32_t DRAIN_INTERVAL = 10U;
+
+    /// @brief Tarefa de esvaziamento
+    constexpr uint32_t TASK_PRIORITY = 1U;
+    constexpr uint32_t TASK_STACK = 3072U;
+    constexpr int TASK_CORE = 0; // Junto ao rádio, longe do IMU
+  }
+
+  /**
+   * @namespace Recorder
+   * @brief Configurações do gravador de voo (Recorder.h)
+   *
+   * Cada amostra ocupa 32 bytes: a 1 kHz são 32 kB/s, ou ~60 s de voo
+   * em MAX_FILE_BYTES, contados a partir do pré-disparo.
+   *
+   * Limite de vazão: cada bloco novo do arquivo custa um apagamento de
+   * setor, durante o qual o cache fica desligado e a aquisição para. O
+   * FIFO do MPU6050 guarda 1024/14 = 73 amostras, 73 ms a 1 kHz; o
+   * apagamento típico da flash do ESP32-DevKitC (~45 ms) cabe nele, o
+   * pior caso de folha de dados (~400 ms) não, e as amostras desse
+   * intervalo se perdem. O LittleFS apaga o bloco só ao alocá-lo, então
+   * não há como pré-apagar o arquivo; as perdas de cada voo ficam
+   * medidas em Recorder::Stats::gaps e maxGapUs.
+   */
+  namespace Recorder
+  {
+    /// @brief Bloco do LittleFS, igual ao setor da flash (bytes)
+    constexpr size_t BLOCK_BYTES = 4096U;
+
+    /// @brief Tamanho de cada um dos dois buffers de gravação (bytes)
+    /// @details Múltiplo de BLOCK_BYTES; 8 kB seguram 256 ms a 1 kHz, o
+    /// que cobre a escrita do outro buffer com um apagamento de pior caso
+    constexpr size_t BUFFER_BYTES = 2U * BLOCK_BYTES;
+
+    /// @brief Amostras guardadas em RAM antes do disparo
+    /// @details ~1 s a 1 kHz, 32 kB; o arquivo começa por elas
+    constexpr size_t PRETRIGGER_RECORDS = 1024U;
+
+    /// @brief Amostras movidas do anel para os buffers a cada amostra nova
+    /// @details Esvazia o pré-disparo em ~30 ms sem pesar na fusão
+    constexpr size_t PUMP_RECORDS = 32U;
+
+    /// @brief Maior arquivo de voo (bytes); limitado também pelo espaço livre
+    constexpr size_t MAX_FILE_BYTES = 1920U * 1024U;
+
+    /// @brief Menor arquivo de voo aceito (bytes)
+    /// @details ~20 s a 1 kHz, um voo de foguete d'água com folga. Com menos
+    /// espaço livre o gravador fica em FAILED até a Base baixar o voo
+    /// anterior, que então é apagado
+    constexpr size_t MIN_FILE_BYTES = 640U * 1024U;
+
+    /// @brief Intervalo entre amostras gravadas contado como lacuna (µs)
+    /// @details 1,5 período do IMU: uma amostra ou mais se perdeu
+    constexpr uint32_t GAP_US = 3000000UL / (2U * Sensors::IMU_SAMPLE_RATE);
+
+    /// @brief Blocos deixados livres para os metadados do LittleFS
+    constexpr size_t FREE_BLOCKS = 8U;
+
+    /// @brief Início do nome dos arquivos de voo, seguido do número do voo
+    constexpr const char *FILE_PREFIX = "/flight_log_";
+
+    /// @brief Tarefa do gravador
+    /// @details Abaixo da transmissão: a flash espera, o rádio não
+    constexpr uint32_t TASK_PRIORITY = 2U;
+    constexpr uint32_t TASK_STACK = 4096U;
+    constexpr int TASK_CORE = 0;
+  }
+
+  /**
+   * @namespace Download
+   * @brief Envio do arquivo de voo à Base depois do pouso (Transfer.h)
+   *
+   * A ~2,5 ms de ar por pedaço de 240 bytes, o enlace a 1 Mbit/s dá no
+   * máximo ~90 kB/s; um voo de MAX_FILE_BYTES leva ~25 s sem perdas.
+   */
+  namespace Download
+  {
+    /// @brief Pedaços enviados sem confirmação (1 a Transfer::MAX_WINDOW)
+    constexpr size_t WINDOW = 32U;
+
+    /// @brief Envios de pedaços aguardando o callback do ESP-NOW
+    /// @details Somados aos dois envios da telemetria por período, cabem duas
+    /// vezes em SEND_IN_FLIGHT (verificado em main.cpp)
+    constexpr size_t MAX_IN_FLIGHT = 2U;
+
+    /// @brief Tempo sem confirmação até reenviar um pedaço (ms)
+    /// @details Cobre a espera na fila do rádio e o ACK atrasado da Base
+    constexpr uint32_t RETRY_TIMEOUT = 60U;
+
+    /// @brief Tempo sem ACK até abandonar a transferência (ms)
+    constexpr uint32_t IDLE_TIMEOUT = 5000U;
+
+    /// @brief Intervalo entre verificações sem mensagens novas (ms)
+    constexpr uint32_t POLL_INTERVAL = 2U;
+
+    /// @brief Posições da fila callback de recepção -> tarefa (potência de 2)
+    constexpr size_t QUEUE_DEPTH = 8U;
+
+    /// @brief Tarefa da transferência
+    constexpr uint32_t TASK_PRIORITY = 2U;
+    constexpr uint32_t TASK_STACK = 4096U;
+    constexpr int TASK_CORE = 0;
+  }
+
+  /**
+   * @namespace Gps
+   * @brief Configurações da recepção do GPS NEO-6M
+   */
+  namespace Gps
+  {
+    /// @brief Velocidade da UART do GPS (padrão de fábrica do NEO-6M)
+    constexpr uint32_t BAUD_RATE = 9600U;
+
+    /// @brief Usa o protocolo binário UBX em vez do NMEA
+    /// @details Se o receptor não confirmar a configuração, volta ao NMEA
+    constexpr bool USE_UBX = true;
+
+    /// @brief Velocidade da UART no modo UBX
+    constexpr uint32_t UBX_BAUD_RATE = 115200U;
+
+    /// @brief Taxa de navegação no modo UBX (Hz)
+    /// @details 5 Hz é o máximo do NEO-6M; receptores M8 aceitam até 10 Hz
+    constexpr uint32_t UBX_RATE_HZ = 5U;
+
+    /// @brief Tempo máximo de espera pelo ACK de uma configuração (ms)
+    constexpr uint32_t ACK_TIMEOUT_MS = 250U;
+
+    /// @brief Buffer de recepção do driver da UART (bytes)
+    /// @details Mais de um segundo de sentenças NMEA a 9600 baud
+    constexpr int RX_BUFFER_SIZE = 2048;
+
+    /// @brief Profundidade da fila de eventos do driver da UART
+    constexpr int EVENT_QUEUE_DEPTH = 16;
+
+    /// @brief Bytes lidos do driver por chamada
+    constexpr size_t READ_CHUNK = 128U;
+
+    /// @brief Posições da fila GPS -> fusão (potência de 2)
+    constexpr size_t FIX_QUEUE_DEPTH = 4U;
   }
   /**
    * @namespace EspNow
@@ -68,6 +470,67 @@ namespace Config
     /// @brief Canal de comunicação ESP-NOW
     /// @details Canal específico para transmissão de dados ESP-NOW
     constexpr uint8_t CHANNEL = 1;
+
+    /// @brief Quadros de fluxo entre keyframes
+    /// @details Um quadro perdido inutiliza os seguintes até o próximo keyframe
+    /// (no máximo KEYFRAME_INTERVAL * TRANSMISSION_INTERVAL ms de dados).
+    /// Com perda independente p e intervalo N, chega a fração
+    /// (1 - p)(1 - (1 - p)^N) / (N p) das amostras: com 10% de perda e sem
+    /// FEC, 77,4% para N = 4 (85,5% para N = 2, 58,6% para N = 10), contra
+    /// os 90% de quadros entregues. A paridade (FEC_GROUP = 2) devolve ~98%;
+    /// tools/FecBench.cpp mede os dois casos
+    constexpr uint16_t KEYFRAME_INTERVAL = 4U;
+
+    /// @brief Quadros de fluxo por quadro de paridade XOR (0 desativa)
+    /// @details Potência de 2 até Telemetry::MAX_FEC_GROUP. Recupera uma perda
+    /// por grupo ao custo de um quadro extra; após uma perda, a Base retém os
+    /// quadros seguintes por até (FEC_GROUP - 1) * TRANSMISSION_INTERVAL ms
+    constexpr uint8_t FEC_GROUP = 2U;
+
     constexpr uint8_t broadcastAddress[] = {0x2B, 0xBC, 0xBB, 0x4B, 0xE4, 0xBD}; // Endereço do receptor
   }
+
+  /**
+   * @namespace RateControl
+   * @brief Limites do controle adaptativo da taxa de envio (RateController)
+   *
+   * O período entre quadros começa em Timing::TRANSMISSION_INTERVAL e
+   * varia entre MIN_INTERVAL e MAX_INTERVAL conforme a entrega que a
+   * Base mede e devolve em Telemetry::LinkReport.
+   */
+  namespace RateControl
+  {
+    /// @brief Menor período entre quadros (ms)
+    constexpr uint32_t MIN_INTERVAL = 250U;
+
+    /// @brief Maior período entre quadros (ms)
+    /// @details Deve caber em StreamHeader::frameInterval (2550 ms)
+    constexpr uint32_t MAX_INTERVAL = 2000U;
+
+    /// @brief Redução do período a cada janela com boa entrega (ms)
+    constexpr uint32_t DECREASE_STEP = 50U;
+
+    /// @brief Fator de aumento do período com entrega ruim (em 1/100)
+    constexpr uint32_t LOSS_BACKOFF_PCT = 150U;
+
+    /// @brief Fator de aumento do período quando a fila do ESP-NOW enche (em 1/100)
+    constexpr uint32_t QUEUE_FULL_BACKOFF_PCT = 200U;
+
+    /// @brief Envios concluídos por janela de avaliação
+    constexpr uint32_t WINDOW = 8U;
+
+    /// @brief Entrega mínima (%) para encurtar o período
+    constexpr uint8_t GOOD_DELIVERY_PCT = 95U;
+
+    /// @brief Entrega (%) abaixo da qual o período cresce
+    constexpr uint8_t POOR_DELIVERY_PCT = 70U;
+
+    /// @brief Maior número de amostras por quadro
+    /// @details Acima de MAX_BATCH * TELEMETRY_SAMPLE_INTERVAL ms de período,
+    /// a fusão espaça mais as amostras
+    constexpr uint8_t MAX_BATCH = 16U;
+
+    /// @brief Relatórios de enlace da Base à espera da transmissão (potência de 2)
+    constexpr size_t REPORT_QUEUE_DEPTH = 4U;
+  }
 }
@@ -0,0 +1,70 @@
+/**
+ * @file Download.h
+ * @brief Envio do arquivo de voo à Base pelo ESP-NOW, depois do pouso
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * A Base pede o arquivo (Transfer.h) e uma tarefa própria o envia do
+ * LittleFS, no núcleo do rádio. Os pedidos e ACKs chegam pelo callback
+ * de recepção do ESP-NOW, que só os copia para a fila de BaseLink.
+ *
+ * É servido o arquivo de voo de maior número com algum conteúdo: o do
+ * voo que acabou ou, se o foguete foi religado, o do voo anterior (o
+ * arquivo novo fica vazio até o disparo). Durante a gravação a resposta
+ * é Transfer::BUSY, e uma transferência em andamento para até o pouso:
+ * o rádio e a flash ficam para a telemetria e o gravador. A entrega
+ * confirmada é avisada ao gravador (Recorder::delivered()), que apaga o
+ * arquivo se precisar do espaço.
+ *
+ * Os pedaços usam o mesmo caminho de envio da telemetria, com no máximo
+ * Config::Download::MAX_IN_FLIGHT envios aguardando o callback, contados
+ * junto com os da telemetria; um envio recusado só adia o pedaço.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "BaseLink.h"
+#include "Transfer.h"
+
+/**
+ * @namespace Download
+ * @brief Tarefa que atende os pedidos do arquivo de voo
+ */
+namespace Download
+{
+    /**
+     * @brief Cria a tarefa da transferência
+     *
+     * @details Requer o LittleFS montado (Recorder::start()).
+     * @param link Origem dos pedidos e ACKs da Base (BaseLink::popTransfer())
+     * @retval true Tarefa criada
+     * @retval false Falha ao criar a tarefa
+     */
+    bool start(BaseLink &link);
+
+    /// @brief Acorda a tarefa: BaseLink enfileirou uma mensagem da transferência
+    void notify();
+
+    /// @brief Acorda a tarefa: um envio terminou e há espaço no rádio
+    void wake();
+
+    /// @brief Estado do envio, para relatório
+    const Transfer::Sender &sender();
+
+    /**
+     * @name Rádio
+     * @brief Funções implementadas em main.cpp, junto ao envio da telemetria
+     * @{
+     */
+
+    /// @brief Envia uma mensagem à Base; false se o ESP-NOW recusou
+    bool send(const uint8_t *message, size_t len);
+
+    /// @brief Envios aceitos que ainda aguardam o callback
+    size_t inFlight();
+
+    /** @} */
+}
@@ -0,0 +1,98 @@
+/**
+ * @file FastMath.h
+ * @brief Funções matemáticas rápidas, somente em precisão simples
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * A FPU do ESP32 opera apenas em float; qualquer double é emulado em
+ * software. Este arquivo reúne aproximações com erro conhecido e
+ * constantes em float para o caminho crítico da fusão.
+ *
+ * @note Arquivos que incluem este cabeçalho no caminho crítico devem
+ * ativar "#pragma GCC diagnostic error \"-Wdouble-promotion\"" antes
+ * dos #include, para que qualquer promoção implícita para double, aqui
+ * inclusive, falhe na compilação.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @namespace FastMath
+ * @brief Aproximações em float com erro máximo documentado
+ */
+namespace FastMath
+{
+    constexpr float PI_F = 3.14159265f;
+    constexpr float HALF_PI_F = 1.57079633f;
+
+    /// @brief Fator de conversão de radianos para graus
+    constexpr float RAD_TO_DEG_F = 57.2957795f;
+
+    /// @brief Fator de conversão de graus para radianos
+    constexpr float DEG_TO_RAD_F = 0.0174532925f;
+
+    /// @brief Valor absoluto sem passar por fabs(double)
+    inline float absf(float x)
+    {
+        return x < 0.0f ? -x : x;
+    }
+
+    /**
+     * @brief Arco tangente de dois argumentos
+     *
+     * @details Reduz o argumento a [0, 1] e aplica um polinômio minimax
+     * de grau 9 (Abramowitz & Stegun 4.4.49).
+     *
+     * @return Ângulo em radianos, em [-π, π]
+     * @note Erro máximo de 1,2e-5 rad (0,0007°) em todo o círculo.
+     */
+    inline float atan2(float y, float x)
+    {
+        float ax = absf(x), ay = absf(y);
+        if (ax == 0.0f && ay == 0.0f) return 0.0f;
+
+        float a = ay < ax ? ay / ax : ax / ay;
+        float s = a * a;
+        float r = a * (0.99986600f + s * (-0.33029950f + s * (0.18014100f +
+                  s * (-0.08513300f + s * 0.02083510f))));
+
+        if (ay > ax) r = HALF_PI_F - r;
+        if (x < 0.0f) r = PI_F - r;
+        return y < 0.0f ? -r : r;
+    }
+
+    /**
+     * @brief Inverso da raiz quadrada
+     *
+     * @details Estimativa inicial por manipulação de bits seguida de duas
+     * iterações de Newton-Raphson.
+     *
+     * @param x Valor positivo
+     * @note Erro relativo máximo de 4,8e-6.
+     */
+    inline float invSqrt(float x)
+    {
+        uint32_t bits;
+        memcpy(&bits, &x, sizeof(bits));
+        bits = 0x5F375A86u - (bits >> 1);
+        float y;
+        memcpy(&y, &bits, sizeof(y));
+
+        const float halfX = 0.5f * x;
+        y = y * (1.5f - halfX * y * y);
+        y = y * (1.5f - halfX * y * y);
+        return y;
+    }
+
+    /**
+     * @brief Raiz quadrada
+     * @note Erro relativo máximo de 4,8e-6; retorna 0 para x <= 0.
+     */
+    inline float sqrt(float x)
+    {
+        return x > 0.0f ? x * invSqrt(x) : 0.0f;
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * @file FlightState.h
+ * @brief Detecção embarcada das fases de voo
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Classifica o voo em rampa, propulsão, voo livre, apogeu, descida e
+ * pouso a cada amostra do IMU, a partir do módulo da aceleração e de
+ * uma velocidade vertical que integra o acelerômetro e é corrigida pelo
+ * barômetro. Cada transição gera um evento com o instante em que a
+ * condição física começou, e não o instante em que foi confirmada.
+ *
+ * Não depende do Arduino: pode ser alimentado no host com registros de voo.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+/// @brief Fases do voo, na ordem em que ocorrem
+/// @note Os valores trafegam na telemetria (SensorData::phase); não reordenar
+enum class FlightPhase : uint8_t
+{
+    PAD,      ///< Na rampa, aguardando o lançamento
+    BOOST,    ///< Propulsão (jato de água)
+    COAST,    ///< Subida sem propulsão
+    APOGEE,   ///< Ponto mais alto; dura uma única amostra
+    DESCENT,  ///< Descida
+    LANDED    ///< Em repouso após o voo
+};
+
+/**
+ * @brief Transição de fase
+ */
+struct FlightEvent {
+    /// @brief Fase em que o voo entrou
+    FlightPhase phase;
+
+    /// @brief Instante do evento físico (µs desde o boot)
+    uint32_t timestampUs;
+
+    /// @brief Altitude acima da rampa no evento (m)
+    float altitude;
+
+    /// @brief Velocidade vertical no evento (m/s)
+    float verticalSpeed;
+};
+
+/**
+ * @brief Máquina de estados das fases de voo
+ *
+ * @details Os limiares ficam em Config::Flight. Uma condição só dispara a
+ * transição depois de se manter pelo tempo de confirmação da fase; o
+ * evento, porém, recebe o timestamp da primeira amostra que a satisfez.
+ */
+class FlightDetector
+{
+public:
+    /**
+     * @brief Processa uma amostra
+     *
+     * @param timestampUs Instante da amostra (µs)
+     * @param acc Aceleração medida nos eixos X, Y e Z (m/s²)
+     * @param up Vertical da referência expressa no corpo (vetor unitário)
+     * @param baroAltitude Altitude barométrica (m); usada se @p baroFresh
+     * @param baroFresh Indica se @p baroAltitude é uma conversão nova
+     * @param event Preenchido quando há transição de fase
+     * @retval true Houve transição nesta amostra
+     */
+    bool update(uint32_t timestampUs, const float acc[3], const float up[3],
+                float baroAltitude, bool baroFresh, FlightEvent &event);
+
+    /// @brief Volta à rampa e descarta o estado
+    void reset();
+
+    /// @brief Fase atual
+    FlightPhase phase() const { return phase_; }
+
+    /// @brief Altitude estimada acima da rampa (m)
+    float altitude() const { return height_; }
+
+    /// @brief Velocidade vertical estimada (m/s, positiva para cima)
+    float verticalSpeed() const { return speed_; }
+
+    /// @brief Maior altitude estimada desde o lançamento (m)
+    float maxAltitude() const { return maxHeight_; }
+
+private:
+    /**
+     * @brief Acompanha há quanto tempo uma condição se mantém
+     * @retval true A condição se mantém há pelo menos @p holdUs
+     */
+    bool held(bool condition, uint32_t nowUs, uint32_t holdUs);
+
+    /// @brief Muda de fase e preenche o evento
+    void enter(FlightPhase phase, uint32_t timestampUs, FlightEvent &event);
+
+    FlightPhase phase_ = FlightPhase::PAD;
+    bool initialized_ = false;
+    uint32_t lastUs_ = 0;
+    uint32_t phaseStartUs_ = 0;
+
+    /// @brief Início da condição em confirmação
+    uint32_t sinceUs_ = 0;
+    bool holding_ = false;
+
+    /// @brief Altitude barométrica da rampa (m)
+    float ground_ = 0.0f;
+
+    /// @brief ground_ já recebeu uma conversão do barômetro
+    bool groundSet_ = false;
+
+    float height_ = 0.0f;
+    float speed_ = 0.0f;
+    float maxHeight_ = 0.0f;
+};
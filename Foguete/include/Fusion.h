@@ -0,0 +1,118 @@
+/**
+ * @file Fusion.h
+ * @brief Fusão sensorial do foguete, somente em precisão simples
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Converte as amostras brutas para unidades SI e estima a orientação
+ * com o filtro de Mahony (Ahrs.h) na taxa completa do IMU, alimentando
+ * a detecção de fases de voo (FlightState.h) no mesmo passo.
+ * É o caminho crítico do pipeline: roda uma vez por amostra do IMU e
+ * é compilado com promoção para double tratada como erro.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "FlightState.h"
+#include "Pipeline.h"
+
+/**
+ * @brief Amostra do IMU em unidades SI
+ */
+struct ImuReading {
+    /// @brief Aceleração nos eixos X, Y e Z (m/s²)
+    float acc[3];
+
+    /// @brief Velocidade angular nos eixos X, Y e Z (rad/s)
+    float gyro[3];
+
+    /// @brief Temperatura do MPU6050 (°C)
+    float temp;
+};
+
+/**
+ * @brief Resultado da fusão de uma amostra
+ */
+struct FusedSample {
+    /// @brief Leitura do IMU em unidades SI
+    ImuReading imu;
+
+    /// @brief Orientação corpo -> referência (w, x, y, z)
+    float quaternion[4];
+
+    /// @brief Ângulo de arfagem (graus), derivado do quatérnio
+    float pitch;
+
+    /// @brief Ângulo de rolagem (graus), derivado do quatérnio
+    float roll;
+
+    /// @brief Ângulo de guinada (graus), derivado do quatérnio
+    /// @note Sem magnetômetro, deriva com o viés residual do giroscópio
+    float yaw;
+
+    /// @brief Viés estimado do giroscópio nos eixos X, Y e Z (rad/s)
+    float gyroBias[3];
+
+    /// @brief Pressão atmosférica (hPa); válida se baroFresh
+    float pressure;
+
+    /// @brief Altitude barométrica (m); válida se baroFresh
+    float altitude;
+
+    /// @brief Indica se pressão e altitude foram atualizadas nesta amostra
+    bool baroFresh;
+
+    /// @brief Fase de voo após esta amostra
+    FlightPhase phase;
+
+    /// @brief Velocidade vertical estimada (m/s, positiva para cima)
+    float verticalSpeed;
+
+    /// @brief Indica se esta amostra causou uma transição de fase
+    bool hasEvent;
+
+    /// @brief Transição de fase; válida se hasEvent
+    FlightEvent event;
+
+    /// @brief Instante da amostra (µs desde o boot)
+    uint32_t timestampUs;
+};
+
+/**
+ * @namespace Fusion
+ * @brief Conversão de unidades e estimativa de orientação
+ */
+namespace Fusion
+{
+    /**
+     * @brief Converte uma amostra bruta do MPU6050 para unidades SI
+     * @param raw Amostra em contagens do sensor
+     * @param out Amostra convertida
+     */
+    void toSi(const ImuSample &raw, ImuReading &out);
+
+    /**
+     * @brief Processa uma amostra bruta
+     *
+     * @param sample Amostra vinda da aquisição
+     * @param out Resultado da fusão
+     * @retval false Na primeira amostra, usada para alinhar a orientação
+     *               à gravidade e como referência de dt
+     */
+    bool update(const RawSample &sample, FusedSample &out);
+
+    /// @brief Descarta o estado do filtro e volta a fase de voo para a rampa
+    void reset();
+
+    /**
+     * @brief Micro-benchmark da fusão
+     *
+     * @details Mede, em ciclos de CPU, um passo da fusão original em
+     * double e um passo de update() sobre os mesmos dados sintéticos,
+     * e imprime o resultado no console junto com o orçamento
+     * Config::Sensors::FUSION_CYCLE_BUDGET. Deixa o filtro reiniciado.
+     */
+    void runBenchmark();
+}
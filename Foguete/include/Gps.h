@@ -0,0 +1,82 @@
+/**
+ * @file Gps.h
+ * @brief Aquisição do GPS NEO-6M em tarefa própria, dirigida por eventos da UART
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * O driver de UART do ESP-IDF recebe as sentenças NMEA por interrupção
+ * e avisa a tarefa do GPS pela fila de eventos. A tarefa alimenta o
+ * TinyGPSPlus (NMEA) ou o UbxParser (binário, Config::Gps::USE_UBX) e
+ * publica uma posição apenas quando ela é atualizada, sem nunca disputar
+ * tempo com as tarefas do IMU.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "Structs.h"
+
+/**
+ * @namespace Gps
+ * @brief Tarefa de recepção e decodificação do GPS
+ */
+namespace Gps
+{
+    /**
+     * @brief Posição publicada pela tarefa do GPS
+     */
+    struct Fix {
+        /// @brief Posição, data/hora UTC, HDOP e satélites
+        /// @details fixAge é preenchido pelo consumidor, no momento do uso
+        GPSData data;
+
+        /// @brief Instante em que a sentença foi decodificada (µs desde o boot)
+        uint32_t timestampUs;
+    };
+
+    /**
+     * @brief Contadores da recepção
+     *
+     * @details Atualizados apenas pela tarefa do GPS.
+     */
+    struct Stats {
+        /// @brief Sentenças NMEA ou quadros UBX com checksum válido
+        volatile uint32_t sentences;
+
+        /// @brief Sentenças ou quadros descartados por checksum inválido
+        volatile uint32_t checksumErrors;
+
+        /// @brief Posições publicadas
+        volatile uint32_t fixes;
+
+        /// @brief Transbordos do FIFO ou do buffer da UART
+        volatile uint32_t overruns;
+    };
+
+    /// @brief Valor de GPSData::fixAge enquanto não houver nenhuma posição
+    constexpr uint32_t NO_FIX_AGE = 0xFFFFFFFFUL;
+
+    /**
+     * @brief Instala o driver da UART e cria a tarefa do GPS
+     *
+     * @retval true Driver e tarefa criados
+     * @retval false Falha ao configurar a UART ou ao criar a tarefa
+     */
+    bool start();
+
+    /**
+     * @brief Retira a posição mais recente, sem bloquear
+     *
+     * @details Deve ser chamada por uma única tarefa consumidora.
+     * @param fix Posição mais recente; intocada se não houver nova
+     * @retval true Havia ao menos uma posição nova
+     */
+    bool poll(Fix &fix);
+
+    /// @brief Retorna os contadores da recepção
+    const Stats &stats();
+
+    /// @brief Indica se o receptor confirmou o modo UBX binário
+    bool usingUbx();
+}
@@ -0,0 +1,127 @@
+/**
+ * @file Log.h
+ * @brief Registro assíncrono em buffer circular, compartilhado por Foguete e Base
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Um Serial.printf de 400 bytes a 115200 baud bloqueia quem chama por
+ * ~35 ms. Aqui quem registra apenas reserva uma posição de um buffer
+ * circular sem travas, grava a mensagem e segue; uma tarefa de baixa
+ * prioridade esvazia o buffer na serial. Se o buffer estiver cheio, a
+ * mensagem é descartada e contada, e a tarefa avisa o descarte.
+ *
+ * Os níveis são resolvidos em tempo de compilação: LOG_DEBUG(...) com
+ * Config::Log::LEVEL abaixo de DEBUG não gera código nem avalia os
+ * argumentos.
+ *
+ * No modo binário (Config::Log::BINARY) a formatação sai do MCU: o
+ * registro guarda o endereço do formato e os argumentos crus, e a tarefa
+ * envia quadros que tools/LogDecode.cpp (no projeto do foguete)
+ * transforma em texto no host. Cada formato é enviado por extenso uma
+ * vez, na primeira vez em que aparece.
+ *
+ * Quadros binários (little-endian, iniciados por BINARY_SYNC):
+ *
+ * | Tipo | Conteúdo                                                    |
+ * |------|-------------------------------------------------------------|
+ * | 'S'  | id (uint32), tamanho (uint8), texto do formato              |
+ * | 'R'  | timestampUs (uint32), nível (uint8), id (uint32),           |
+ * |      | tamanho (uint8), argumentos                                 |
+ * | 'D'  | total de mensagens descartadas (uint32)                     |
+ *
+ * Argumentos: inteiros e ponteiros em 4 bytes (8 com "ll"), reais em
+ * double de 8 bytes e strings com um byte de tamanho antes do texto.
+ *
+ * Este arquivo e Log.cpp devem ser idênticos nos dois projetos.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Config.h"
+
+/**
+ * @namespace Log
+ * @brief Registro não bloqueante com esvaziamento em segundo plano
+ */
+namespace Log
+{
+    /// @brief Severidade da mensagem; Config::Log::LEVEL usa os mesmos valores
+    enum Level : uint8_t {
+        NONE = 0,
+        ERROR,
+        WARN,
+        INFO,
+        DEBUG
+    };
+
+    /// @brief Início de todo quadro do modo binário
+    constexpr uint8_t BINARY_SYNC = 0xA5;
+
+    /// @brief Bytes de texto (ou de argumentos) por mensagem
+    constexpr size_t RECORD_BYTES = Config::Log::RECORD_BYTES;
+
+    /**
+     * @brief Contadores do registro
+     */
+    struct Stats {
+        /// @brief Mensagens aceitas no buffer
+        uint32_t written;
+
+        /// @brief Mensagens descartadas com o buffer cheio
+        uint32_t dropped;
+
+        /// @brief Mensagens cortadas em RECORD_BYTES
+        uint32_t truncated;
+    };
+
+    /// @brief Nível incluído na compilação
+    constexpr bool enabled(Level level)
+    {
+        return level != NONE && level <= Config::Log::LEVEL;
+    }
+
+    /**
+     * @brief Cria a tarefa que esvazia o buffer
+     *
+     * @details Antes dela as mensagens se acumulam no buffer (e as que
+     * não couberem são descartadas).
+     * @retval true Tarefa criada
+     */
+    bool start();
+
+    /**
+     * @brief Registra uma mensagem no estilo printf
+     *
+     * @details Não bloqueia; pode ser chamada de qualquer tarefa, inclusive
+     * do WiFi, mas não de interrupções. Prefira as macros LOG_*, que
+     * descartam os níveis desligados na compilação.
+     */
+    void write(Level level, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+    /// @brief Contadores acumulados
+    Stats stats();
+
+    /// @brief Letra que identifica o nível na saída de texto
+    char levelTag(Level level);
+}
+
+/// @brief Registra em @p level se o nível estiver incluído na compilação
+#define LOG_AT(level, ...)                                       \
+    do {                                                         \
+        if (Log::enabled(level)) Log::write(level, __VA_ARGS__); \
+    } while (0)
+
+/// @brief Falha que compromete uma função do sistema
+#define LOG_ERROR(...) LOG_AT(Log::ERROR, __VA_ARGS__)
+
+/// @brief Situação anormal da qual o sistema se recupera
+#define LOG_WARN(...) LOG_AT(Log::WARN, __VA_ARGS__)
+
+/// @brief Eventos e relatórios periódicos
+#define LOG_INFO(...) LOG_AT(Log::INFO, __VA_ARGS__)
+
+/// @brief Despejo detalhado para depuração
+#define LOG_DEBUG(...) LOG_AT(Log::DEBUG, __VA_ARGS__)
@@ -0,0 +1,209 @@
+/**
+ * @file Mpu6050.h
+ * @brief Driver enxuto do MPU6050 com leituras inteiras em rajada
+ * @version 1.1
+ * @date Outubro/2026
+ *
+ * Acessa os registradores diretamente, sem a biblioteca Adafruit: cada
+ * amostra é uma rajada I2C de 14 bytes mantida em contagens inteiras,
+ * e a conversão para unidades SI fica para o estágio que a consome.
+ *
+ * O MPU6050 amostra acelerômetro e giroscópio a até 1 kHz e guarda os
+ * quadros em um FIFO de 1024 bytes. O driver pode esvaziar o FIFO em
+ * rajadas de vários quadros, atribuindo a cada amostra um carimbo de
+ * tempo em microssegundos, ou ler amostra a amostra, disparado pelo
+ * sinal de dado pronto (pino INT) ou por um timer.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+class TwoWire;
+
+/**
+ * @brief Amostra bruta do MPU6050, em contagens do ADC do sensor
+ *
+ * @details A conversão para unidades SI é feita depois, fora do
+ * caminho de aquisição.
+ */
+struct ImuSample {
+    /// @brief Aceleração nos eixos X, Y e Z (LSB)
+    int16_t acc[3];
+
+    /// @brief Velocidade angular nos eixos X, Y e Z (LSB)
+    int16_t gyro[3];
+
+    /// @brief Temperatura do sensor (LSB)
+    int16_t temp;
+
+    /// @brief Instante da amostra (µs desde o boot)
+    uint32_t timestampUs;
+};
+
+/**
+ * @brief Driver do MPU6050
+ *
+ * @details Configura as faixas de ±8 g e ±500 °/s, coerentes com
+ * Config::Sensors::ACCEL_LSB_PER_G e GYRO_LSB_PER_DPS. Quadros do FIFO
+ * e leituras diretas têm o mesmo layout de 14 bytes, na ordem dos
+ * registradores (ACCEL_XOUT..ACCEL_ZOUT, TEMP_OUT, GYRO_XOUT..GYRO_ZOUT,
+ * big-endian).
+ */
+class Mpu6050
+{
+public:
+    /// @brief Bytes por quadro no FIFO (3 eixos de acel. + temp. + 3 de giro)
+    static constexpr size_t FRAME_SIZE = 14;
+
+    /// @brief Capacidade do FIFO interno do sensor (bytes)
+    static constexpr size_t FIFO_CAPACITY = 1024;
+
+    /// @brief Endereço I2C padrão (pino AD0 em nível baixo)
+    static constexpr uint8_t DEFAULT_ADDRESS = 0x68;
+
+    /**
+     * @param wire Barramento I2C onde está o sensor
+     * @param address Endereço I2C do MPU6050
+     */
+    explicit Mpu6050(TwoWire &wire, uint8_t address = DEFAULT_ADDRESS);
+
+    /**
+     * @brief Reinicia o sensor e configura faixas de medida e filtro
+     *
+     * @details Verifica o WHO_AM_I, usa o PLL do giroscópio X como
+     * relógio e habilita o DLPF de 21 Hz, mantendo o comportamento do
+     * modo POLLED original.
+     *
+     * @retval true Sensor encontrado e configurado
+     * @retval false Sensor ausente ou falha de comunicação I2C
+     */
+    bool begin();
+
+    /**
+     * @brief Configura taxa de amostragem, filtro e habilita o FIFO
+     *
+     * @param sampleRateHz Taxa desejada (4 Hz a 1 kHz)
+     * @retval true Configuração escrita com sucesso
+     * @retval false Falha de comunicação I2C
+     */
+    bool beginFifo(uint16_t sampleRateHz);
+
+    /**
+     * @brief Configura o sinal de dado pronto no pino INT, sem FIFO
+     *
+     * @details O pino INT gera um pulso de 50 µs a cada nova amostra,
+     * que é lida depois com readSample().
+     *
+     * @param sampleRateHz Taxa desejada (4 Hz a 1 kHz)
+     * @retval true Configuração escrita com sucesso
+     * @retval false Falha de comunicação I2C
+     */
+    bool beginDataReady(uint16_t sampleRateHz);
+
+    /**
+     * @brief Lê a amostra mais recente dos registradores de saída
+     *
+     * @details Uma única rajada de 14 bytes a partir de ACCEL_XOUT_H,
+     * com o mesmo layout de um quadro do FIFO.
+     *
+     * @param out Amostra lida; o timestamp não é preenchido
+     * @retval false Falha de comunicação I2C
+     */
+    bool readSample(ImuSample &out);
+
+    /**
+     * @brief Esvazia o FIFO em rajadas
+     *
+     * @param out Vetor de destino das amostras
+     * @param max Número máximo de amostras a ler; as demais ficam no FIFO
+     * para a próxima chamada
+     * @param nowUs Instante da leitura (µs), atribuído ao quadro mais novo
+     * do FIFO; os lidos são datados para trás a partir dele
+     * @return Número de amostras escritas em @p out
+     *
+     * @note Em caso de estouro do FIFO os dados ficam desalinhados;
+     * o FIFO é reiniciado, o estouro é contabilizado e nada é retornado.
+     */
+    size_t drainFifo(ImuSample *out, size_t max, uint32_t nowUs);
+
+    /// @brief Número de estouros do FIFO desde beginFifo()
+    uint32_t overflows() const { return overflows_; }
+
+    /// @brief Período entre amostras configurado (µs)
+    uint32_t periodUs() const { return periodUs_; }
+
+    /**
+     * @brief Decodifica quadros brutos do FIFO
+     *
+     * @param bytes Fluxo de bytes lido do registrador FIFO_R_W
+     * @param len Tamanho do fluxo; bytes de um quadro incompleto são ignorados
+     * @param out Vetor de destino
+     * @param max Capacidade de @p out
+     * @return Número de amostras decodificadas
+     *
+     * @note Função pura, não toca o barramento; não preenche o timestamp.
+     */
+    static size_t decode(const uint8_t *bytes, size_t len, ImuSample *out, size_t max)
+    {
+        size_t count = 0;
+        while (len >= FRAME_SIZE && count < max) {
+            ImuSample &s = out[count++];
+            for (int i = 0; i < 3; i++) {
+                s.acc[i] = static_cast<int16_t>((bytes[2 * i] << 8) | bytes[2 * i + 1]);
+                s.gyro[i] = static_cast<int16_t>((bytes[8 + 2 * i] << 8) | bytes[8 + 2 * i + 1]);
+            }
+            s.temp = static_cast<int16_t>((bytes[6] << 8) | bytes[7]);
+            bytes += FRAME_SIZE;
+            len -= FRAME_SIZE;
+        }
+        return count;
+    }
+
+    /**
+     * @brief Atribui timestamps igualmente espaçados a um lote
+     *
+     * @details A última amostra do lote é ancorada em @p nowUs. Se o lote
+     * continua o anterior sem desvio maior que um período, a sequência é
+     * mantida (timestamps monotônicos e uniformes); caso contrário ela é
+     * ressincronizada à âncora, absorvendo a deriva do oscilador do sensor.
+     *
+     * @param samples Lote recém-decodificado
+     * @param count Tamanho do lote
+     * @param nowUs Instante da leitura (µs)
+     * @param periodUs Período de amostragem (µs)
+     * @param lastUs Timestamp da última amostra anterior; 0 se não houver.
+     * Atualizado com o timestamp da última amostra do lote.
+     */
+    static void stamp(ImuSample *samples, size_t count, uint32_t nowUs,
+                      uint32_t periodUs, uint32_t &lastUs)
+    {
+        if (count == 0) return;
+
+        uint32_t anchor = nowUs - static_cast<uint32_t>(count - 1) * periodUs;
+        uint32_t base = anchor;
+        if (lastUs != 0) {
+            uint32_t expected = lastUs + periodUs;
+            int32_t drift = static_cast<int32_t>(anchor - expected);
+            if (drift < static_cast<int32_t>(periodUs) && drift > -static_cast<int32_t>(periodUs))
+                base = expected;
+        }
+
+        for (size_t i = 0; i < count; i++)
+            samples[i].timestampUs = base + static_cast<uint32_t>(i) * periodUs;
+        lastUs = samples[count - 1].timestampUs;
+    }
+
+private:
+    bool configureRate(uint16_t sampleRateHz);
+    bool writeRegister(uint8_t reg, uint8_t value);
+    bool readRegisters(uint8_t reg, uint8_t *buffer, size_t len);
+    void resetFifo();
+
+    TwoWire &wire_;
+    uint8_t address_;
+    uint32_t periodUs_ = 1000;
+    uint32_t lastTimestampUs_ = 0;
+    uint32_t overflows_ = 0;
+};
@@ -0,0 +1,183 @@
+/**
+ * @file Pipeline.h
+ * @brief Pipeline de telemetria em tarefas FreeRTOS
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Divide o antigo loop() em quatro estágios independentes:
+ * aquisição -> fusão -> {transmissão, registro}. Os estágios são
+ * ligados por filas SPSC sem travas, de modo que um printf lento ou
+ * uma transmissão demorada não atrasam a amostragem dos sensores.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Bmp280.h"
+#include "Mpu6050.h"
+#include "Structs.h"
+
+/**
+ * @brief Amostra bruta produzida pelo estágio de aquisição
+ *
+ * @details Contém apenas o que foi lido dos sensores, em contagens
+ * inteiras e sem nenhum processamento; a conversão para unidades SI e
+ * a fusão sensorial acontecem no estágio seguinte.
+ */
+struct RawSample {
+    /// @brief Leitura do MPU6050 (acelerômetro, giroscópio e temperatura)
+    ImuSample imu;
+
+    /// @brief Leitura compensada do BMP280
+    /// @details baro.fresh indica se é uma conversão nova ou repetida
+    BaroSample baro;
+
+    /// @brief Instante da leitura (µs desde o boot)
+    uint32_t timestampUs;
+};
+
+/**
+ * @namespace Pipeline
+ * @brief Orquestração das tarefas de aquisição, fusão, transmissão e registro
+ */
+namespace Pipeline
+{
+    /// @brief Identificação dos estágios do pipeline
+    enum Stage : uint8_t {
+        ACQUISITION = 0,
+        FUSION,
+        TRANSMISSION,
+        LOGGING,
+        STAGE_COUNT
+    };
+
+    /**
+     * @brief Estatísticas de vazão de um estágio
+     *
+     * @details Atualizadas apenas pela própria tarefa do estágio e lidas
+     * pela tarefa de registro; valores de 32 bits são atômicos no ESP32.
+     */
+    struct StageStats {
+        /// @brief Itens processados desde o início
+        volatile uint32_t processed;
+
+        /// @brief Itens descartados na fila de saída do estágio
+        volatile uint32_t dropped;
+
+        /// @brief Maior tempo de execução de um item (µs)
+        volatile uint32_t maxMicros;
+
+        /// @brief Tempo acumulado de execução (µs)
+        volatile uint32_t totalMicros;
+    };
+
+    /**
+     * @brief Estatísticas de temporização da aquisição disparada
+     *
+     * @details Válidas nos modos DATA_READY e TIMER, em que cada amostra
+     * carrega o instante do disparo capturado com esp_timer_get_time().
+     */
+    struct JitterStats {
+        /// @brief Intervalos medidos entre amostras consecutivas
+        volatile uint32_t intervals;
+
+        /// @brief Disparos cuja amostra foi perdida por atraso da tarefa
+        volatile uint32_t missed;
+
+        /// @brief Maior desvio absoluto em relação ao período nominal (µs)
+        volatile uint32_t maxDeviationUs;
+
+        /// @brief Soma dos desvios absolutos (µs), para a média
+        volatile uint32_t sumDeviationUs;
+    };
+
+    /**
+     * @brief Cria as filas e as tarefas do pipeline
+     *
+     * @retval true Todas as tarefas foram criadas
+     * @retval false Falha ao criar alguma tarefa
+     */
+    bool start();
+
+    /**
+     * @brief Retorna as estatísticas de um estágio
+     * @param stage Estágio consultado
+     */
+    const StageStats &stats(Stage stage);
+
+    /// @brief Nome legível de um estágio
+    const char *stageName(Stage stage);
+
+    /// @brief Retorna as estatísticas de jitter da aquisição disparada
+    const JitterStats &jitter();
+
+    /**
+     * @brief Sinaliza uma amostra pronta a partir de uma tarefa
+     *
+     * @details Usado pelo callback do esp_timer (modo TIMER).
+     * @param timestampUs Instante da amostragem (µs)
+     */
+    void trigger(uint32_t timestampUs);
+
+    /**
+     * @brief Sinaliza uma amostra pronta a partir de uma ISR
+     *
+     * @details Usado pela interrupção do pino INT (modo DATA_READY).
+     * @param timestampUs Instante da amostragem (µs)
+     */
+    void triggerFromISR(uint32_t timestampUs);
+
+    /**
+     * @name Estágios
+     * @brief Funções executadas pelas tarefas, implementadas em main.cpp
+     *
+     * Isolam o pipeline do hardware: as tarefas só conhecem estas
+     * funções, e não os sensores ou o rádio.
+     * @{
+     */
+
+    /**
+     * @brief Lê os sensores e preenche até @p max amostras
+     * @param timestampUs Instante do disparo deste ciclo (µs)
+     * @return Número de amostras produzidas neste ciclo (pode ser 0)
+     */
+    size_t acquire(RawSample *samples, size_t max, uint32_t timestampUs);
+
+    /// @brief Aplica a fusão sensorial e preenche @p out
+    bool fuse(const RawSample &sample, SensorData &out);
+
+    /**
+     * @brief Transmite as amostras acumuladas desde o último envio
+     * @param samples Amostras em ordem cronológica
+     * @param count Número de amostras (ao menos 1)
+     * @return Quantas das primeiras amostras foram consumidas; as demais
+     * são oferecidas de novo no próximo período
+     */
+    size_t transmit(const SensorData *samples, size_t count);
+
+    /**
+     * @brief Período atual entre quadros (ms)
+     * @details Consultado pela tarefa de transmissão a cada ciclo
+     */
+    uint32_t frameInterval();
+
+    /**
+     * @brief Intervalo atual entre amostras entregues à transmissão (µs)
+     * @details Consultado pela fusão a cada amostra
+     */
+    uint32_t sampleInterval();
+
+    /// @brief Registra um pacote de telemetria no console
+    void log(const SensorData &data);
+
+    /**
+     * @brief Imprime estatísticas que não pertencem ao pipeline (rádio)
+     * @details Chamada pela tarefa de registro junto com as estatísticas
+     * dos estágios, a cada Config::Timing::STATS_REPORT_INTERVAL
+     */
+    void report();
+
+    /** @} */
+}
@@ -0,0 +1,79 @@
+/**
+ * @file RateControl.h
+ * @brief Controle adaptativo da taxa de envio de telemetria
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Ajusta o período entre quadros ESP-NOW a partir da fração de quadros
+ * que a Base diz ter recebido (Telemetry::LinkReport) e dos erros
+ * ESP_ERR_ESPNOW_NO_MEM (fila de transmissão cheia). O callback de envio
+ * não serve: a telemetria vai a um endereço de grupo, sem ACK do rádio,
+ * e todo envio é dado como bem-sucedido. O ajuste é
+ * AIMD: com o enlace bom o período encurta de um passo fixo; com
+ * entregas ruins ele cresce por um fator, e com a fila cheia dobra.
+ *
+ * O tamanho do lote acompanha o período: cada quadro leva o período
+ * dividido pelo intervalo nominal entre amostras, limitado a
+ * Config::RateControl::MAX_BATCH. Acima desse limite a fusão passa a
+ * espaçar mais as amostras, para que a fila de transmissão não transborde.
+ *
+ * Não depende do Arduino: pode ser exercitado no host.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#include "Structs.h"
+
+/**
+ * @brief Controlador AIMD do período de transmissão
+ *
+ * @details Roda na tarefa de transmissão; as entregas vêm dos contadores
+ * do relatório de enlace da Base. Os valores publicados são lidos por outras tarefas sem
+ * trava (32 bits, atômicos no ESP32).
+ */
+class RateController
+{
+public:
+    RateController();
+
+    /// @brief Registra um esp_now_send() recusado por falta de memória
+    void queueFull();
+
+    /**
+     * @brief Reavalia o período
+     *
+     * @details Chamada uma vez por quadro. Reage de imediato a fila
+     * cheia; senão espera Config::RateControl::WINDOW quadros contados.
+     * Totais menores que os da janela (a Base reiniciou) recomeçam a janela.
+     * @param delivered Total de quadros recebidos pela Base
+     * @param failed Total de quadros perdidos segundo a Base
+     */
+    void update(uint32_t delivered, uint32_t failed);
+
+    /// @brief Período atual entre quadros (ms)
+    uint32_t frameIntervalMs() const { return frameIntervalMs_; }
+
+    /// @brief Intervalo atual entre amostras enviadas (µs)
+    uint32_t sampleIntervalUs() const { return sampleIntervalUs_; }
+
+    /// @brief Estado publicado na telemetria
+    RadioData state() const;
+
+private:
+    /// @brief Limita @p intervalMs e recalcula lote e intervalo entre amostras
+    void apply(uint32_t intervalMs);
+
+    /// @brief Recomeça a janela de entregas a partir dos totais atuais
+    void restartWindow(uint32_t delivered, uint32_t failed);
+
+    bool queueFull_ = false;
+    uint32_t windowDelivered_ = 0;
+    uint32_t windowFailed_ = 0;
+
+    volatile uint32_t frameIntervalMs_ = 0;
+    volatile uint32_t sampleIntervalUs_ = 0;
+    volatile uint8_t batchSize_ = 0;
+    volatile uint8_t deliveryPct_ = 100;
+};
@@ -0,0 +1,238 @@
+/**
+ * @file Recorder.h
+ * @brief Gravador de voo embarcado em LittleFS
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Grava cada amostra do IMU (Config::Sensors::IMU_SAMPLE_RATE) em um
+ * arquivo binário na flash interna.
+ *
+ * Na rampa nada vai para a flash: as amostras circulam por um anel em
+ * RAM que guarda apenas o último ~1 s (Config::Recorder::PRETRIGGER_RECORDS).
+ * Quando a detecção de fases sai da rampa, o gravador passa a esvaziar
+ * o anel em direção à flash, da amostra mais antiga para a mais nova,
+ * e as amostras seguintes continuam entrando pelo mesmo anel: o arquivo
+ * começa antes do lançamento e não tem buracos nem repetições.
+ *
+ * Do anel as amostras vão para um de dois buffers do tamanho de blocos
+ * da flash; quando o buffer enche, passa a vez à tarefa do gravador, que
+ * o escreve inteiro enquanto a fusão preenche o outro. Se a gravação
+ * atrasar a ponto de o anel encher, a amostra é descartada e contada: a
+ * aquisição nunca espera pela flash.
+ *
+ * O arquivo só é sincronizado (fsync) nas mudanças de fase do voo e no
+ * fim da gravação; entre elas o LittleFS apenas acrescenta blocos.
+ *
+ * Enquanto a flash apaga um setor, o cache fica desligado e o núcleo dos
+ * sensores para; o FIFO do MPU6050 (modo FIFO) guarda até 73 ms de
+ * amostras. Apagamentos mais longos perdem amostras, e cada buraco nos
+ * carimbos de tempo gravados é contado (Stats::gaps, ver Config::Recorder).
+ *
+ * Cabe um voo longo por vez na partição. Sem espaço para
+ * Config::Recorder::MIN_FILE_BYTES, o gravador fica em FAILED, o que a
+ * telemetria sinaliza à Base (Telemetry::STATUS_RECORDER_FAULT); quando
+ * a Base confirma o download de um voo anterior, o arquivo dele é
+ * apagado e o gravador se arma de novo. Arquivos vazios, de boots que
+ * não chegaram a voar, são apagados na inicialização.
+ *
+ * O arquivo começa com um RecorderHeader seguido de FlightRecord, todos
+ * de RECORD_BYTES, little-endian.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Pipeline.h"
+#include "Structs.h"
+
+/// @brief Tamanho do cabeçalho e de cada registro do arquivo
+constexpr size_t RECORD_BYTES = 32U;
+
+/// @brief Identificação do arquivo ("VOO" + versão do formato)
+constexpr uint32_t RECORDER_MAGIC = 0x314F4F56UL;  // "VOO1"
+
+/// @brief FlightRecord::flags: a amostra traz uma conversão nova do barômetro
+constexpr uint8_t RECORD_BARO_FRESH = 0x01;
+
+/**
+ * @brief Cabeçalho do arquivo de voo
+ *
+ * @details Torna o arquivo autodescritivo: as escalas permitem
+ * converter as contagens sem conhecer a configuração do firmware.
+ */
+#pragma pack(push, 1)
+struct RecorderHeader {
+    /// @brief RECORDER_MAGIC
+    uint32_t magic;
+
+    /// @brief Tamanho de cada registro (bytes)
+    uint16_t recordBytes;
+
+    /// @brief Taxa nominal das amostras (Hz)
+    uint16_t sampleRate;
+
+    /// @brief Escala do acelerômetro (LSB/g)
+    float accelLsbPerG;
+
+    /// @brief Escala do giroscópio (LSB/(°/s))
+    float gyroLsbPerDps;
+
+    /// @brief Instante da primeira amostra do arquivo (µs desde o boot)
+    uint32_t startUs;
+
+    /// @brief Instante da amostra que saiu da rampa (µs desde o boot)
+    uint32_t triggerUs;
+
+    /// @brief Reservado; zero
+    uint8_t reserved[8];
+};
+#pragma pack(pop)
+
+/**
+ * @brief Uma amostra do IMU no arquivo de voo
+ *
+ * @details Guarda as leituras brutas, e não as convertidas, para que o
+ * voo possa ser reprocessado no host com outra calibração.
+ */
+#pragma pack(push, 1)
+struct FlightRecord {
+    /// @brief Instante da amostra (µs desde o boot)
+    uint32_t timestampUs;
+
+    /// @brief Aceleração nos eixos X, Y e Z (LSB)
+    int16_t acc[3];
+
+    /// @brief Velocidade angular nos eixos X, Y e Z (LSB)
+    int16_t gyro[3];
+
+    /// @brief Temperatura do MPU6050 (LSB)
+    int16_t temp;
+
+    /// @brief Arfagem estimada (centésimos de grau)
+    int16_t pitch;
+
+    /// @brief Rolagem estimada (centésimos de grau)
+    int16_t roll;
+
+    /// @brief Fase do voo (FlightPhase)
+    uint8_t phase;
+
+    /// @brief RECORD_BARO_FRESH
+    uint8_t flags;
+
+    /// @brief Pressão em Pa, formato Q24.8; repetida entre conversões
+    uint32_t pressure;
+
+    /// @brief Temperatura do BMP280 (centésimos de grau Celsius)
+    int32_t temperature;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(RecorderHeader) == RECORD_BYTES, "RecorderHeader deve ter RECORD_BYTES");
+static_assert(sizeof(FlightRecord) == RECORD_BYTES, "FlightRecord deve ter RECORD_BYTES");
+
+/**
+ * @namespace Recorder
+ * @brief Gravação das amostras de voo na flash
+ */
+namespace Recorder
+{
+    /// @brief Etapas do gravador
+    enum State : uint8_t {
+        OFF = 0,    ///< Não iniciado ou sem arquivo
+        ARMED,      ///< Na rampa: só o anel em RAM
+        RECORDING,  ///< Esvaziando o anel na flash
+        DONE,       ///< Arquivo fechado
+        FAILED      ///< Sem espaço ou sem sistema de arquivos; sinalizado na telemetria
+    };
+
+    /**
+     * @brief Contadores do gravador
+     *
+     * @details Os de amostras são atualizados pela fusão; os de escrita,
+     * pela tarefa do gravador.
+     */
+    struct Stats {
+        /// @brief Amostras copiadas do anel para os buffers
+        volatile uint32_t recorded;
+
+        /// @brief Amostras descartadas com o anel cheio durante a gravação
+        volatile uint32_t dropped;
+
+        /// @brief Bytes gravados no arquivo
+        volatile uint32_t bytesWritten;
+
+        /// @brief Sincronizações do arquivo (mudanças de fase e fim)
+        volatile uint32_t syncs;
+
+        /// @brief Escritas que gravaram menos bytes que o pedido
+        volatile uint32_t writeErrors;
+
+        /// @brief Maior tempo de escrita de um buffer (µs)
+        volatile uint32_t maxWriteUs;
+
+        /// @brief Intervalos entre amostras gravadas maiores que Config::Recorder::GAP_US
+        /// @details Amostras perdidas antes do gravador, em geral o FIFO do
+        /// MPU6050 transbordando durante um apagamento da flash
+        volatile uint32_t gaps;
+
+        /// @brief Maior intervalo entre amostras gravadas (µs)
+        volatile uint32_t maxGapUs;
+
+        /// @brief Arquivos de voo apagados (vazios ou já entregues à Base)
+        volatile uint32_t removed;
+    };
+
+    /**
+     * @brief Monta o LittleFS, cria o arquivo do voo e a tarefa do gravador
+     *
+     * @details Formata a partição se ela não montar e apaga os arquivos
+     * de voo vazios. O arquivo recebe o próximo número livre
+     * (/flight_log_000001.bin, ...) e o tamanho é limitado ao espaço
+     * livre e a Config::Recorder::MAX_FILE_BYTES. Nada é gravado na flash
+     * antes de a detecção de fases sair da rampa.
+     * @retval true Gravador armado
+     * @retval false Sem sistema de arquivos, sem espaço ou sem tarefa;
+     * fica em FAILED
+     */
+    bool start();
+
+    /**
+     * @brief A Base confirmou ter recebido o arquivo @p path
+     *
+     * @details Chamada pela tarefa do download. Se o gravador estiver em
+     * FAILED, apaga o arquivo entregue e tenta armar de novo; senão o
+     * arquivo fica, para ser baixado outra vez se preciso.
+     * @param path Caminho do arquivo entregue
+     */
+    void delivered(const char *path);
+
+    /**
+     * @brief Grava uma amostra
+     *
+     * @details Chamada pela fusão, a cada amostra; nunca bloqueia. Não
+     * faz nada se o gravador não foi iniciado ou se o arquivo já terminou.
+     * A primeira amostra fora da rampa dispara a gravação; ela termina
+     * com o arquivo cheio ou na amostra de pouso.
+     * @param sample Leitura bruta dos sensores
+     * @param data Pacote fundido da mesma amostra (atitude e fase)
+     */
+    void record(const RawSample &sample, const SensorData &data);
+
+    /// @brief Etapa atual
+    State state();
+
+    /// @brief O voo não está sendo ou não será gravado por inteiro (FAILED ou erro de escrita)
+    bool fault();
+
+    /// @brief Nome legível de uma etapa
+    const char *stateName(State state);
+
+    /// @brief Nome do arquivo do voo atual (vazio se não houver)
+    const char *fileName();
+
+    /// @brief Retorna os contadores do gravador
+    const Stats &stats();
+}
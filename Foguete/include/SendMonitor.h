@@ -0,0 +1,124 @@
+/**
+ * @file SendMonitor.h
+ * @brief Contadores e latência dos envios ESP-NOW
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * O callback de envio do ESP-NOW roda na tarefa do WiFi; qualquer
+ * printf ali segura a pilha de rádio. Aqui o callback só incrementa
+ * contadores atômicos e guarda o instante da conclusão. Quem envia
+ * anota o instante de cada esp_now_send(), e a diferença entre os dois
+ * vai para um histograma de latência por pacote que uma tarefa de baixa
+ * prioridade imprime.
+ *
+ * O ESP-NOW conclui os envios na ordem em que foram aceitos, então o
+ * n-ésimo callback corresponde ao n-ésimo envio aceito.
+ *
+ * Não depende do Arduino: pode ser exercitado no host.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/// @brief Faixas do histograma de latência de envio
+constexpr size_t SEND_LATENCY_BUCKETS = 8U;
+
+/**
+ * @brief Envios aceitos ainda sem callback que o monitor acompanha (potência de 2)
+ *
+ * @details Por período a telemetria põe no ar um quadro e sua paridade, e
+ * a transferência do arquivo de voo até Config::Download::MAX_IN_FLIGHT
+ * pedaços; o dobro disso cobre um período cujos callbacks ainda não
+ * chegaram. Quem envia consulta inFlight() e recusa o envio que passaria
+ * do limite, para que nenhuma entrada seja sobrescrita antes do callback.
+ */
+constexpr size_t SEND_IN_FLIGHT = 8U;
+
+/**
+ * @brief Contabilidade dos envios
+ *
+ * @details begin()/commit() são chamados apenas pela tarefa de
+ * transmissão e completed() apenas pelo callback de envio; os demais
+ * métodos podem ser chamados de qualquer tarefa.
+ */
+class SendMonitor
+{
+public:
+    /**
+     * @brief Cópia coerente o bastante para relatório
+     */
+    struct Snapshot {
+        /// @brief Envios aceitos por esp_now_send()
+        uint32_t queued;
+
+        /// @brief Callbacks com ESP_NOW_SEND_SUCCESS
+        uint32_t delivered;
+
+        /// @brief Callbacks com falha
+        uint32_t failed;
+
+        /// @brief Instante do último callback (µs)
+        uint32_t lastCompletionUs;
+
+        /// @brief Maior latência observada (µs)
+        uint32_t maxLatencyUs;
+
+        /// @brief Soma das latências (µs), para a média
+        uint32_t sumLatencyUs;
+
+        /// @brief Envios por faixa de latência (ver bucketLimitUs())
+        uint32_t histogram[SEND_LATENCY_BUCKETS];
+    };
+
+    /**
+     * @brief Anota o instante de um envio, antes de esp_now_send()
+     *
+     * @details Precisa vir antes porque o callback pode rodar antes de
+     * esp_now_send() retornar.
+     */
+    void begin(uint32_t nowUs);
+
+    /// @brief Confirma o envio anotado por begin() (esp_now_send() retornou ESP_OK)
+    void commit();
+
+    /**
+     * @brief Registra a conclusão de um envio (callback do ESP-NOW)
+     * @param delivered Status ESP_NOW_SEND_SUCCESS
+     * @param nowUs Instante do callback (µs)
+     */
+    void completed(bool delivered, uint32_t nowUs);
+
+    /// @brief Total de envios aceitos por esp_now_send()
+    uint32_t queued() const { return committed_.load(std::memory_order_relaxed); }
+
+    /// @brief Total de envios confirmados
+    uint32_t delivered() const { return delivered_.load(std::memory_order_relaxed); }
+
+    /// @brief Total de envios que falharam
+    uint32_t failed() const { return failed_.load(std::memory_order_relaxed); }
+
+    /// @brief Envios aceitos ainda sem callback
+    uint32_t inFlight() const;
+
+    /// @brief Copia todos os contadores
+    void snapshot(Snapshot &out) const;
+
+    /// @brief Limite superior (exclusivo) da faixa @p bucket em µs; a última não tem limite
+    static uint32_t bucketLimitUs(size_t bucket);
+
+private:
+    std::atomic<uint32_t> sentUs_[SEND_IN_FLIGHT] = {};
+    uint32_t queued_ = 0;
+    std::atomic<uint32_t> committed_{0};
+    uint32_t completions_ = 0;
+
+    std::atomic<uint32_t> delivered_{0};
+    std::atomic<uint32_t> failed_{0};
+    std::atomic<uint32_t> lastCompletionUs_{0};
+    std::atomic<uint32_t> maxLatencyUs_{0};
+    std::atomic<uint32_t> sumLatencyUs_{0};
+    std::atomic<uint32_t> histogram_[SEND_LATENCY_BUCKETS] = {};
+};
@@ -0,0 +1,89 @@
+/**
+ * @file SpscQueue.h
+ * @brief Fila circular limitada e sem travas (produtor único / consumidor único)
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Liga os estágios do pipeline de telemetria. Cada fila tem exatamente
+ * uma tarefa produtora e uma consumidora, o que permite sincronizar
+ * apenas com índices atômicos, sem mutex nem seção crítica.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Fila SPSC de capacidade fixa
+ *
+ * @tparam T Tipo do elemento (copiado por valor)
+ * @tparam N Número de posições; deve ser potência de 2
+ *
+ * @note Uma posição fica sempre livre para distinguir fila cheia de
+ * vazia, portanto a capacidade útil é N - 1.
+ * @note Não depende de FreeRTOS nem do Arduino, podendo ser compilada
+ * no host.
+ */
+template <typename T, size_t N>
+class SpscQueue
+{
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "N deve ser potencia de 2");
+
+public:
+    /**
+     * @brief Insere um elemento (chamado apenas pelo produtor)
+     * @retval true Elemento inserido
+     * @retval false Fila cheia; o elemento é descartado e contabilizado
+     */
+    bool push(const T &item)
+    {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        const size_t next = (head + 1) & MASK;
+        if (next == tail_.load(std::memory_order_acquire))
+        {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        buffer_[head] = item;
+        head_.store(next, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove o elemento mais antigo (chamado apenas pelo consumidor)
+     * @retval true Elemento copiado para @p item
+     * @retval false Fila vazia
+     */
+    bool pop(T &item)
+    {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire))
+            return false;
+        item = buffer_[tail];
+        tail_.store((tail + 1) & MASK, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Número aproximado de elementos na fila
+    size_t size() const
+    {
+        return (head_.load(std::memory_order_acquire) -
+                tail_.load(std::memory_order_acquire)) & MASK;
+    }
+
+    /// @brief Elementos descartados por fila cheia desde o início
+    uint32_t dropped() const { return dropped_.load(std::memory_order_relaxed); }
+
+    /// @brief Capacidade útil da fila
+    static constexpr size_t capacity() { return N - 1; }
+
+private:
+    static constexpr size_t MASK = N - 1;
+
+    T buffer_[N];
+    std::atomic<size_t> head_{0};
+    std::atomic<size_t> tail_{0};
+    std::atomic<uint32_t> dropped_{0};
+};
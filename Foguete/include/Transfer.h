@@ -0,0 +1,336 @@
+/**
+ * @file Transfer.h
+ * @brief Transferência do arquivo de voo do foguete para a Base por ESP-NOW
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Depois do pouso a Base pede o último arquivo do gravador e o foguete o
+ * envia em pedaços de CHUNK_BYTES. O protocolo é de repetição seletiva:
+ * o foguete mantém até uma janela de pedaços sem confirmação, a Base
+ * confirma com o próximo pedaço esperado e um mapa de bits dos pedaços
+ * seguintes que já chegaram, e só os pedaços que faltam são reenviados.
+ *
+ * O ESP-NOW entrega na ordem de envio, então um pedaço sem confirmação
+ * enviado antes de outro já confirmado foi perdido: é reenviado de
+ * imediato, sem esperar o tempo limite, que fica para as perdas no fim
+ * da janela e para as confirmações perdidas.
+ *
+ * Mensagens (little-endian; o primeiro byte não colide com as versões
+ * de telemetria):
+ *
+ * | Tipo     | Sentido        | Conteúdo                                       |
+ * |----------|----------------|------------------------------------------------|
+ * | REQUEST  | Base → foguete | sessão (uint8)                                 |
+ * | INFO     | foguete → Base | sessão, status (uint8), tamanho (uint32),      |
+ * |          |                | tamanho do nome (uint8), nome                  |
+ * | DATA     | foguete → Base | sessão, pedaço (uint32), até CHUNK_BYTES bytes |
+ * | ACK      | Base → foguete | sessão, próximo pedaço (uint32), mapa (uint32) |
+ *
+ * No ACK, o bit i do mapa indica o pedaço próximo + 1 + i. A sessão é
+ * escolhida pela Base a cada pedido; mensagens de outra sessão são
+ * ignoradas.
+ *
+ * Não depende do Arduino: a simulação tools/TransferBench.cpp usa as
+ * mesmas classes. Este arquivo e Transfer.cpp devem ser idênticos nos
+ * dois projetos.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @namespace Transfer
+ * @brief Protocolo de transferência do arquivo de voo
+ */
+namespace Transfer
+{
+    /// @name Tipos de mensagem (primeiro byte)
+    /// @{
+    constexpr uint8_t REQUEST = 0x10;
+    constexpr uint8_t INFO = 0x11;
+    constexpr uint8_t DATA = 0x12;
+    constexpr uint8_t ACK = 0x13;
+    /// @}
+
+    /// @brief Maior mensagem aceita pelo ESP-NOW
+    constexpr size_t MAX_MESSAGE_BYTES = 250U;
+
+    /// @brief Cabeçalho de DATA: tipo, sessão e número do pedaço
+    constexpr size_t DATA_HEADER_BYTES = 6U;
+
+    /// @brief Bytes do arquivo por pedaço
+    constexpr size_t CHUNK_BYTES = 240U;
+
+    /// @brief Maior janela, limitada pelo mapa de bits do ACK
+    constexpr size_t MAX_WINDOW = 32U;
+
+    /// @brief Maior mensagem da Base ao foguete (ACK)
+    constexpr size_t MAX_CONTROL_BYTES = 10U;
+
+    /// @brief Maior nome de arquivo em INFO
+    constexpr size_t MAX_NAME = 31U;
+
+    /// @brief Pedaços em ordem por ACK; lacunas e repetições são confirmadas na hora
+    constexpr uint8_t ACK_EVERY = 4U;
+
+    /// @brief Espera máxima de um ACK atrasado, contada do ACK anterior (µs)
+    /// @details Maior que ACK_EVERY pedaços no ar (~10 ms a 1 Mbit/s), para
+    /// que o fluxo contínuo seja confirmado só pela contagem
+    constexpr uint32_t ACK_DELAY_US = 15000UL;
+
+    static_assert(DATA_HEADER_BYTES + CHUNK_BYTES <= MAX_MESSAGE_BYTES, "DATA nao cabe no ESP-NOW");
+
+    /// @brief Resposta do foguete em INFO
+    enum Status : uint8_t {
+        OK = 0,   ///< Transferência iniciada
+        BUSY,     ///< Gravador em andamento
+        NO_FILE   ///< Nenhum arquivo de voo
+    };
+
+    /// @brief Envia uma mensagem; false se o rádio recusou (nada foi enviado)
+    typedef bool (*Send)(const uint8_t *message, size_t len, void *context);
+
+    /// @brief Indica se @p message pertence a este protocolo
+    bool isTransfer(const uint8_t *message, size_t len);
+
+    /// @brief Lê a sessão de um REQUEST
+    bool parseRequest(const uint8_t *message, size_t len, uint8_t &session);
+
+    /// @brief Número de pedaços de um arquivo de @p size bytes
+    inline uint32_t chunkCount(uint32_t size)
+    {
+        return (size + CHUNK_BYTES - 1U) / CHUNK_BYTES;
+    }
+
+    /**
+     * @brief Envia o arquivo (lado do foguete)
+     *
+     * @details Não é thread-safe: receive() e poll() devem ser chamados
+     * pela mesma tarefa.
+     */
+    class Sender
+    {
+    public:
+        /// @brief Lê @p len bytes do arquivo a partir de @p offset; retorna os lidos
+        typedef size_t (*Read)(uint32_t offset, uint8_t *out, size_t len, void *context);
+
+        /**
+         * @brief Contadores do envio
+         */
+        struct Stats {
+            /// @brief Pedaços enviados pela primeira vez
+            uint32_t sent;
+
+            /// @brief Pedaços reenviados
+            uint32_t retransmitted;
+
+            /// @brief Reenvios por tempo limite (os demais vieram do ACK)
+            uint32_t timeouts;
+
+            /// @brief ACKs recebidos
+            uint32_t acks;
+
+            /// @brief Envios recusados pelo rádio, tentados de novo depois
+            uint32_t refused;
+        };
+
+        /**
+         * @param send Envio das mensagens
+         * @param read Leitura do arquivo
+         * @param context Repassado a @p send e @p read
+         * @param window Pedaços sem confirmação (1 a MAX_WINDOW)
+         * @param timeoutUs Tempo sem confirmação até reenviar um pedaço (µs)
+         * @param idleUs Tempo sem nenhum ACK até abandonar a sessão (µs)
+         */
+        Sender(Send send, Read read, void *context, size_t window, uint32_t timeoutUs, uint32_t idleUs);
+
+        /**
+         * @brief Atende um REQUEST
+         *
+         * @details Um REQUEST repetido da sessão atual só reenvia o INFO;
+         * uma sessão nova recomeça do início.
+         * @param status OK para enviar; BUSY ou NO_FILE apenas respondem
+         * @param size Tamanho do arquivo (bytes)
+         * @param name Nome do arquivo, informado à Base
+         */
+        void begin(uint8_t session, Status status, uint32_t size, const char *name, uint32_t nowUs);
+
+        /// @brief Processa um ACK
+        void receive(const uint8_t *message, size_t len, uint32_t nowUs);
+
+        /**
+         * @brief Envia o INFO pendente, os reenvios e os pedaços novos que a janela permitir
+         * @param budget Mensagens que o rádio aceita agora
+         */
+        void poll(uint32_t nowUs, size_t budget);
+
+        /// @brief Há uma sessão em andamento
+        bool active() const { return active_; }
+
+        /// @brief Há algo a enviar: uma sessão ou um INFO pendente
+        bool busy() const { return active_ || infoPending_; }
+
+        /// @brief Todos os pedaços da última sessão foram confirmados
+        bool complete() const { return chunks_ > 0 && base_ == chunks_; }
+
+        /// @brief Pedaços confirmados em ordem
+        uint32_t acknowledged() const { return base_; }
+
+        /// @brief Pedaços do arquivo da sessão
+        uint32_t chunks() const { return chunks_; }
+
+        /// @brief Contadores acumulados
+        const Stats &stats() const { return stats_; }
+
+    private:
+        /// @brief Estado de um pedaço da janela
+        struct Slot {
+            uint32_t sentUs;
+            uint32_t order;    ///< Ordem de envio da última transmissão
+            bool acked;
+            bool lost;         ///< Reenviar sem esperar o tempo limite
+        };
+
+        bool sendInfo();
+        bool transmit(uint32_t chunk, uint32_t nowUs);
+
+        Send send_;
+        Read read_;
+        void *context_;
+        const size_t window_;
+        const uint32_t timeoutUs_;
+        const uint32_t idleUs_;
+
+        bool active_ = false;
+        bool infoPending_ = false;
+        uint8_t session_ = 0;
+        Status status_ = NO_FILE;
+        uint32_t size_ = 0;
+        char name_[MAX_NAME + 1] = "";
+
+        uint32_t chunks_ = 0;
+        uint32_t base_ = 0;     ///< Primeiro pedaço sem confirmação
+        uint32_t next_ = 0;     ///< Próximo pedaço nunca enviado
+        uint32_t order_ = 0;
+        uint32_t lastAckUs_ = 0;
+        Slot slots_[MAX_WINDOW] = {};
+
+        Stats stats_ = {};
+    };
+
+    /**
+     * @brief Recebe o arquivo e o entrega em ordem (lado da Base)
+     *
+     * @details Pedaços fora de ordem aguardam em RAM, dentro da janela,
+     * até que os anteriores cheguem; o arquivo só é escrito por acréscimo.
+     * Não é thread-safe: todos os métodos devem ser chamados pela mesma tarefa.
+     */
+    class Receiver
+    {
+    public:
+        /// @brief Prepara o destino de um arquivo de @p size bytes; false recusa
+        typedef bool (*Open)(const char *name, uint32_t size, void *context);
+
+        /// @brief Acrescenta bytes ao destino, em ordem; false aborta
+        typedef bool (*Write)(const uint8_t *data, size_t len, void *context);
+
+        /// @brief Etapas da recepção
+        enum State : uint8_t {
+            IDLE = 0,    ///< Nenhum pedido
+            REQUESTING,  ///< Aguardando o INFO
+            RECEIVING,   ///< Recebendo pedaços
+            DONE,        ///< Arquivo completo
+            FAILED       ///< Recusado, sem resposta ou erro de escrita
+        };
+
+        /**
+         * @brief Contadores da recepção
+         */
+        struct Stats {
+            /// @brief Pedaços recebidos, inclusive repetidos
+            uint32_t received;
+
+            /// @brief Pedaços que já tinham chegado
+            uint32_t duplicates;
+
+            /// @brief Pedaços que chegaram antes de um anterior
+            uint32_t outOfOrder;
+
+            /// @brief ACKs enviados
+            uint32_t acks;
+        };
+
+        /**
+         * @param send Envio dos pedidos e ACKs
+         * @param open Abertura do destino ao receber o INFO
+         * @param write Escrita do arquivo em ordem
+         * @param context Repassado às três funções
+         * @param timeoutUs Espera pelo INFO antes de repetir o pedido, e
+         * sem nenhum pedaço antes de reenviar o último ACK (µs)
+         * @param idleUs Tempo sem nenhuma resposta até desistir (µs)
+         */
+        Receiver(Send send, Open open, Write write, void *context, uint32_t timeoutUs, uint32_t idleUs);
+
+        /// @brief Pede o último arquivo de voo, em uma sessão nova
+        void request(uint32_t nowUs);
+
+        /// @brief Processa um INFO ou DATA
+        void receive(const uint8_t *message, size_t len, uint32_t nowUs);
+
+        /// @brief Repete o pedido ou o ACK e detecta o abandono
+        void poll(uint32_t nowUs);
+
+        /// @brief Etapa atual
+        State state() const { return state_; }
+
+        /// @brief Resposta do foguete ao pedido
+        Status status() const { return status_; }
+
+        /// @brief Tamanho do arquivo informado pelo foguete (bytes)
+        uint32_t size() const { return size_; }
+
+        /// @brief Bytes já escritos em ordem
+        uint32_t written() const { return next_ * CHUNK_BYTES < size_ ? next_ * CHUNK_BYTES : size_; }
+
+        /// @brief Nome do arquivo informado pelo foguete
+        const char *name() const { return name_; }
+
+        /// @brief Contadores acumulados
+        const Stats &stats() const { return stats_; }
+
+    private:
+        void sendRequest();
+        void sendAck(uint32_t nowUs);
+
+        /// @brief Escreve os pedaços guardados a partir de next_
+        bool deliver(const uint8_t *data, size_t len);
+
+        /// @brief Tamanho do pedaço @p chunk
+        size_t chunkLength(uint32_t chunk) const;
+
+        Send send_;
+        Open open_;
+        Write write_;
+        void *context_;
+        const uint32_t timeoutUs_;
+        const uint32_t idleUs_;
+
+        State state_ = IDLE;
+        Status status_ = OK;
+        uint8_t session_ = 0;
+        uint32_t size_ = 0;
+        uint32_t chunks_ = 0;
+        char name_[MAX_NAME + 1] = "";
+
+        uint32_t next_ = 0;          ///< Próximo pedaço a escrever
+        uint32_t present_ = 0;       ///< Bit i: pedaço next_ + 1 + i guardado
+        uint8_t unacked_ = 0;        ///< Pedaços em ordem desde o último ACK
+        uint32_t lastSendUs_ = 0;    ///< Último pedido ou ACK enviado
+        uint32_t lastHeardUs_ = 0;   ///< Última mensagem do foguete
+        uint8_t buffer_[MAX_WINDOW][CHUNK_BYTES];
+
+        Stats stats_ = {};
+    };
+}
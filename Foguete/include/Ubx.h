@@ -0,0 +1,175 @@
+/**
+ * @file Ubx.h
+ * @brief Decodificador do protocolo binário UBX dos receptores u-blox
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Reconhece as mensagens de navegação usadas pelo foguete e preenche
+ * GPSData diretamente a partir dos bytes recebidos. Quando um quadro
+ * inteiro está no bloco lido da UART ele é decodificado no próprio
+ * bloco, sem cópia; só quadros partidos entre duas leituras passam pelo
+ * buffer interno.
+ *
+ * Mensagens suportadas:
+ * - NAV-PVT (84 bytes no u-blox 7, 92 do M8 em diante): posição,
+ *   data/hora e satélites
+ * - NAV-POSLLH + NAV-SOL + NAV-TIMEUTC (NEO-6, sem NAV-PVT): a mesma
+ *   informação, combinada pelo iTOW da época
+ * - NAV-DOP: HDOP, nos dois casos
+ * - ACK-ACK / ACK-NAK: respostas às mensagens de configuração
+ *
+ * Não depende do Arduino: pode decodificar capturas no host.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Structs.h"
+
+/**
+ * @brief Decodificador incremental de quadros UBX
+ */
+class UbxParser
+{
+public:
+    /// @name Classes e identificadores de mensagens
+    /// @{
+    static constexpr uint8_t CLASS_NAV = 0x01;
+    static constexpr uint8_t CLASS_ACK = 0x05;
+    static constexpr uint8_t CLASS_CFG = 0x06;
+
+    static constexpr uint8_t NAV_POSLLH = 0x02;
+    static constexpr uint8_t NAV_DOP = 0x04;
+    static constexpr uint8_t NAV_SOL = 0x06;
+    static constexpr uint8_t NAV_PVT = 0x07;
+    static constexpr uint8_t NAV_TIMEUTC = 0x21;
+
+    static constexpr uint8_t ACK_NAK = 0x00;
+    static constexpr uint8_t ACK_ACK = 0x01;
+
+    static constexpr uint8_t CFG_PRT = 0x00;
+    static constexpr uint8_t CFG_MSG = 0x01;
+    static constexpr uint8_t CFG_RATE = 0x08;
+    /// @}
+
+    /// @brief Maior carga útil aceita (NAV-PVT tem 92 bytes)
+    static constexpr uint16_t MAX_PAYLOAD = 100;
+
+    /// @brief Cabeçalho (sincronismo, classe, id, tamanho) + checksum
+    static constexpr size_t FRAME_OVERHEAD = 8;
+
+    /// @brief Resposta a uma mensagem de configuração
+    struct Ack {
+        uint8_t msgClass;
+        uint8_t msgId;
+        bool accepted;
+    };
+
+    /**
+     * @brief Processa um bloco de bytes recebidos
+     *
+     * @param data Bytes na ordem de chegada
+     * @param len Quantidade de bytes
+     */
+    void feed(const uint8_t *data, size_t len);
+
+    /**
+     * @brief Retira a posição completa mais recente
+     *
+     * @param out Posição; fixAge é zerado
+     * @retval true Houve posição nova desde a última chamada
+     */
+    bool takeFix(GPSData &out);
+
+    /**
+     * @brief Retira a resposta de configuração mais recente
+     * @retval true Houve ACK ou NAK desde a última chamada
+     */
+    bool takeAck(Ack &out);
+
+    /// @brief Quadros com checksum válido
+    uint32_t frames() const { return frames_; }
+
+    /// @brief Quadros descartados por checksum ou tamanho inválido
+    uint32_t errors() const { return errors_; }
+
+    /**
+     * @brief Monta um quadro UBX
+     *
+     * @param msgClass Classe da mensagem
+     * @param msgId Identificador da mensagem
+     * @param payload Carga útil (pode ser nullptr se @p len for 0)
+     * @param len Tamanho da carga útil
+     * @param out Destino; deve comportar len + FRAME_OVERHEAD bytes
+     * @return Tamanho do quadro montado
+     */
+    static size_t frame(uint8_t msgClass, uint8_t msgId, const uint8_t *payload,
+                        uint16_t len, uint8_t *out);
+
+    /// @brief Checksum de Fletcher de 8 bits usado pelo UBX
+    static void checksum(const uint8_t *data, size_t len, uint8_t &ckA, uint8_t &ckB);
+
+private:
+    enum State : uint8_t {
+        SYNC1,
+        SYNC2,
+        CLASS,
+        ID,
+        LENGTH1,
+        LENGTH2,
+        PAYLOAD,
+        CK_A,
+        CK_B
+    };
+
+    /// @brief Bits de época das mensagens combinadas do NEO-6
+    enum EpochPart : uint8_t {
+        PART_POSLLH = 0x01,
+        PART_SOL = 0x02,
+        PART_TIMEUTC = 0x04,
+        PART_ALL = 0x07
+    };
+
+    /// @brief Máquina de estados para quadros partidos entre blocos
+    void step(uint8_t byte);
+
+    /// @brief Decodifica uma mensagem já validada
+    void dispatch(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t len);
+
+    void decodePvt(const uint8_t *p);
+    void decodePosllh(const uint8_t *p);
+    void decodeSol(const uint8_t *p);
+    void decodeTimeUtc(const uint8_t *p);
+
+    /// @brief Começa uma nova época do NEO-6 se o iTOW mudou
+    void enterEpoch(uint32_t iTow);
+
+    /// @brief Marca uma parte da época do NEO-6 e publica se estiver completa
+    void completePart(uint8_t part);
+
+    State state_ = SYNC1;
+    uint8_t header_[4] = {};  ///< Classe, id e tamanho do quadro em montagem
+    uint16_t length_ = 0;
+    uint16_t index_ = 0;
+    uint8_t ckA_ = 0;
+    uint8_t ckB_ = 0;
+    uint8_t buffer_[MAX_PAYLOAD] = {};
+
+    /// @brief Posição em montagem e a última publicada
+    GPSData pending_ = {};
+    GPSData fix_ = {};
+    bool fixReady_ = false;
+
+    uint32_t epochTow_ = 0;
+    uint8_t epochParts_ = 0;
+    bool epochFixOk_ = false;
+    float hdop_ = 0.0f;
+
+    Ack ack_ = {};
+    bool ackReady_ = false;
+
+    uint32_t frames_ = 0;
+    uint32_t errors_ = 0;
+};
@@ -0,0 +1,129 @@
+/**
+ * @file Ahrs.cpp
+ * @brief Implementação do filtro de Mahony em precisão simples
+ * @version 1.0
+ * @date Outubro/2026
+ */
+
+// Roda na taxa do IMU: mesmo critério de Fusion.cpp, nada de double
+#pragma GCC diagnostic error "-Wdouble-promotion"
+#pragma GCC diagnostic error "-Wfloat-conversion"
+
+#include "Ahrs.h"
+#include "Config.h"
+#include "FastMath.h"
+
+Ahrs::Ahrs(float kp, float ki, float accelGate)
+    : kp_(kp), ki_(ki), accelGate_(accelGate)
+{
+}
+
+void Ahrs::align(const float acc[3])
+{
+    float norm = acc[0] * acc[0] + acc[1] * acc[1] + acc[2] * acc[2];
+    integral_[0] = integral_[1] = integral_[2] = 0.0f;
+    if (norm <= 0.0f) {
+        q_[0] = 1.0f;
+        q_[1] = q_[2] = q_[3] = 0.0f;
+        return;
+    }
+
+    float inv = FastMath::invSqrt(norm);
+    float ax = acc[0] * inv, ay = acc[1] * inv, az = acc[2] * inv;
+
+    // Conjugado do menor giro de Z até a: (1 + az, ay, -ax, 0)
+    if (az < -0.999999f) {
+        q_[0] = 0.0f; q_[1] = 1.0f; q_[2] = 0.0f; q_[3] = 0.0f;  // De cabeça para baixo
+        return;
+    }
+    float w = 1.0f + az;
+    float n = FastMath::invSqrt(w * w + ax * ax + ay * ay);
+    q_[0] = w * n;
+    q_[1] = ay * n;
+    q_[2] = -ax * n;
+    q_[3] = 0.0f;
+}
+
+bool Ahrs::update(const float gyro[3], const float acc[3], float dt)
+{
+    float q0 = q_[0], q1 = q_[1], q2 = q_[2], q3 = q_[3];
+    float gx = gyro[0], gy = gyro[1], gz = gyro[2];
+
+    // O acelerômetro só indica a vertical quando mede apenas a gravidade
+    constexpr float g = Config::Sensors::GRAVITY;
+    float norm2 = acc[0] * acc[0] + acc[1] * acc[1] + acc[2] * acc[2];
+    float lower = g * (1.0f - accelGate_), upper = g * (1.0f + accelGate_);
+    bool corrected = norm2 > lower * lower && norm2 < upper * upper;
+
+    if (corrected) {
+        float inv = FastMath::invSqrt(norm2);
+        float ax = acc[0] * inv, ay = acc[1] * inv, az = acc[2] * inv;
+
+        // Gravidade estimada no referencial do corpo
+        float vx = 2.0f * (q1 * q3 - q0 * q2);
+        float vy = 2.0f * (q0 * q1 + q2 * q3);
+        float vz = q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3;
+
+        // Erro: produto vetorial entre a medida e a estimativa
+        float ex = ay * vz - az * vy;
+        float ey = az * vx - ax * vz;
+        float ez = ax * vy - ay * vx;
+
+        if (ki_ > 0.0f) {
+            integral_[0] += ki_ * ex * dt;
+            integral_[1] += ki_ * ey * dt;
+            integral_[2] += ki_ * ez * dt;
+        }
+        gx += kp_ * ex;
+        gy += kp_ * ey;
+        gz += kp_ * ez;
+    }
+    gx += integral_[0];
+    gy += integral_[1];
+    gz += integral_[2];
+
+    // q' = q + 0.5 * q ⊗ (0, ω) * dt
+    float h = 0.5f * dt;
+    gx *= h;
+    gy *= h;
+    gz *= h;
+    q_[0] = q0 - q1 * gx - q2 * gy - q3 * gz;
+    q_[1] = q1 + q0 * gx + q2 * gz - q3 * gy;
+    q_[2] = q2 + q0 * gy - q1 * gz + q3 * gx;
+    q_[3] = q3 + q0 * gz + q1 * gy - q2 * gx;
+
+    float n = FastMath::invSqrt(q_[0] * q_[0] + q_[1] * q_[1] + q_[2] * q_[2] + q_[3] * q_[3]);
+    q_[0] *= n;
+    q_[1] *= n;
+    q_[2] *= n;
+    q_[3] *= n;
+    return corrected;
+}
+
+void Ahrs::gyroBias(float out[3]) const
+{
+    out[0] = -integral_[0];
+    out[1] = -integral_[1];
+    out[2] = -integral_[2];
+}
+
+void Ahrs::up(float out[3]) const
+{
+    const float q0 = q_[0], q1 = q_[1], q2 = q_[2], q3 = q_[3];
+    out[0] = 2.0f * (q1 * q3 - q0 * q2);
+    out[1] = 2.0f * (q0 * q1 + q2 * q3);
+    out[2] = q0 * q0 - q1 * q1 - q2 * q2 + q3 * q3;
+}
+
+void Ahrs::angles(float &pitch, float &roll, float &yaw) const
+{
+    const float q0 = q_[0], q1 = q_[1], q2 = q_[2], q3 = q_[3];
+    float v[3];
+    up(v);
+    const float vx = v[0], vy = v[1], vz = v[2];
+
+    pitch = FastMath::atan2(vy, FastMath::sqrt(vx * vx + vz * vz)) * FastMath::RAD_TO_DEG_F;
+    roll = FastMath::atan2(-vx, vz) * FastMath::RAD_TO_DEG_F;
+    yaw = FastMath::atan2(2.0f * (q1 * q2 + q0 * q3),
+                          q0 * q0 + q1 * q1 - q2 * q2 - q3 * q3) * FastMath::RAD_TO_DEG_F;
+}
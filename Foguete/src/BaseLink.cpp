@@ -0,0 +1,45 @@
+/**
+ * @file BaseLink.cpp
+ * @brief Implementação do filtro das mensagens da Base
+ * @version 1.0
+ * @date Outubro/2026
+ */
+
+#include <string.h>
+
+#include "BaseLink.h"
+
+BaseLink::Route BaseLink::receive(const uint8_t *mac, const uint8_t *data, int len)
+{
+    if (len <= 0) return IGNORED;
+    const size_t size = static_cast<size_t>(len);
+
+    Telemetry::LinkReport report;
+    if (Telemetry::decodeLinkReport(data, size, report)) {
+        if (!accept(mac, true)) return IGNORED;
+        return reports_.push(report) ? REPORT : IGNORED;
+    }
+
+    if (size > Transfer::MAX_CONTROL_BYTES || !Transfer::isTransfer(data, size)) return IGNORED;
+    // Só um pedido apresenta a Base; um ACK solto não
+    uint8_t session;
+    if (!accept(mac, Transfer::parseRequest(data, size, session))) return IGNORED;
+
+    Message message;
+    message.length = static_cast<uint8_t>(size);
+    memcpy(message.data, data, size);
+    return transfers_.push(message) ? TRANSFER : IGNORED;
+}
+
+bool BaseLink::accept(const uint8_t *mac, bool learn)
+{
+    if (!known_) {
+        if (!learn) return false;
+        memcpy(base_, mac, sizeof(base_));
+        known_ = true;
+        return true;
+    }
+    if (memcmp(mac, base_, sizeof(base_)) == 0) return true;
+    rejected_ = rejected_ + 1;
+    return false;
+}
@@ -0,0 +1,160 @@
+/**
+ * @file Battery.cpp
+ * @brief Implementação da medição de tensão por ADC contínuo
+ * @version 1.0
+ * @date Outubro/2026
+ */
+
+#include <Arduino.h>
+#include <driver/adc.h>
+#include <esp_adc_cal.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include "Battery.h"
+#include "Config.h"
+
+namespace Battery
+{
+    namespace
+    {
+        esp_adc_cal_characteristics_t calibration;
+
+        /// @brief Canal do ADC1 ligado a Config::Hardware::ADC_PIN
+        uint8_t channel = 0;
+
+        /// @brief Valores publicados; floats de 32 bits são atômicos no ESP32
+        volatile float filteredPin = 0.0f;
+        volatile uint16_t lastRaw = 0;
+        bool primed = false;
+
+        Stats adcStats = {};
+
+        /**
+         * @brief Converte a média de uma janela em tensão no pino (V)
+         *
+         * @details A média tem resolução abaixo de 1 LSB; a calibração só
+         * aceita inteiros, então interpola entre os dois códigos vizinhos
+         * para não perder o ganho da sobreamostragem.
+         */
+        float calibrate(uint32_t sum, uint32_t count)
+        {
+            const uint32_t base = sum / count;
+            const float fraction = static_cast<float>(sum - base * count) / static_cast<float>(count);
+            const uint32_t low = esp_adc_cal_raw_to_voltage(base, &calibration);
+            const uint32_t high = esp_adc_cal_raw_to_voltage(base + 1, &calibration);
+            const float mv = static_cast<float>(low) + fraction * static_cast<float>(high - low);
+            return mv * 0.001f;
+        }
+
+        /// @brief Publica uma janela: média, calibração e filtro exponencial
+        void publish(uint32_t sum, uint32_t count)
+        {
+            const float pin = calibrate(sum, count);
+            if (!primed) {
+                filteredPin = pin;
+                primed = true;
+            } else {
+                filteredPin = filteredPin + Config::Adc::SMOOTHING * (pin - filteredPin);
+            }
+            lastRaw = static_cast<uint16_t>((sum + count / 2) / count);
+            adcStats.updates = adcStats.updates + 1;
+        }
+
+        /**
+         * @brief Tarefa do ADC
+         *
+         * @details Bloqueia em adc_digi_read_bytes até o DMA entregar um
+         * bloco e acumula as leituras do canal até completar a janela.
+         */
+        void adcTask(void *)
+        {
+            uint8_t buffer[Config::Adc::READ_BYTES];
+            uint32_t sum = 0;
+            uint32_t count = 0;
+
+            for (;;) {
+                uint32_t length = 0;
+                esp_err_t err = adc_digi_read_bytes(buffer, sizeof(buffer), &length, ADC_MAX_DELAY);
+                if (err == ESP_ERR_INVALID_STATE) {
+                    // O buffer do driver encheu: dados antigos se perderam,
+                    // mas o bloco devolvido ainda é válido
+                    adcStats.overruns = adcStats.overruns + 1;
+                } else if (err != ESP_OK) {
+                    continue;
+                }
+
+                for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= length; i += SOC_ADC_DIGI_RESULT_BYTES) {
+                    const adc_digi_output_data_t *p =
+                        reinterpret_cast<const adc_digi_output_data_t *>(&buffer[i]);
+                    if (p->type1.channel != channel) continue;
+
+                    sum += p->type1.data;
+                    if (++count == Config::Adc::OVERSAMPLING) {
+                        publish(sum, count);
+                        sum = count = 0;
+                    }
+                }
+                adcStats.samples = adcStats.samples + length / SOC_ADC_DIGI_RESULT_BYTES;
+            }
+        }
+    }
+
+    bool start()
+    {
+        using namespace Config::Adc;
+
+        int8_t analogChannel = digitalPinToAnalogChannel(Config::Hardware::ADC_PIN);
+        if (analogChannel < 0 || analogChannel >= ADC1_CHANNEL_MAX) return false;  // Só ADC1
+        channel = static_cast<uint8_t>(analogChannel);
+
+        esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTEN_DB_11, ADC_WIDTH_BIT_12,
+                                 DEFAULT_VREF_MV, &calibration);
+
+        adc_digi_init_config_t init = {};
+        init.max_store_buf_size = DMA_BUFFER_BYTES;
+        init.conv_num_each_intr = READ_BYTES;
+        init.adc1_chan_mask = BIT(channel);
+        if (adc_digi_initialize(&init) != ESP_OK) return false;
+
+        adc_digi_pattern_config_t pattern = {};
+        pattern.atten = ADC_ATTEN_DB_11;
+        pattern.channel = channel;
+        pattern.unit = 0;  // ADC1
+        pattern.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+
+        adc_digi_configuration_t config = {};
+        config.conv_limit_en = true;  // Obrigatório no ESP32 (ADC via I2S)
+        config.conv_limit_num = 250;
+        config.pattern_num = 1;
+        config.adc_pattern = &pattern;
+        config.sample_freq_hz = SAMPLE_RATE_HZ;
+        config.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+        config.format = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+        if (adc_digi_controller_configure(&config) != ESP_OK) return false;
+        if (adc_digi_start() != ESP_OK) return false;
+
+        return xTaskCreatePinnedToCore(adcTask, "adc", TASK_STACK, nullptr,
+                                       TASK_PRIORITY, nullptr, TASK_CORE) == pdPASS;
+    }
+
+    float voltage()
+    {
+        return filteredPin * Config::Hardware::ADC_MULTIPLIER;
+    }
+
+    float pinVoltage()
+    {
+        return filteredPin;
+    }
+
+    uint16_t raw()
+    {
+        return lastRaw;
+    }
+
+    const Stats &stats()
+    {
+        return adcStats;
+    }
+}
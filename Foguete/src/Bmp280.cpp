@@ -0,0 +1,114 @@
+/**
+ * @file Bmp280.cpp
+ * @brief Implementação do driver enxuto do BMP280
+ * @version 1.0
+ * @date Outubro/2026
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include "Bmp280.h"
+
+namespace
+{
+    // Mapa de registradores (BMP280 datasheet, seção 4.2)
+    constexpr uint8_t REG_CALIB = 0x88;
+    constexpr uint8_t REG_CHIP_ID = 0xD0;
+    constexpr uint8_t REG_CTRL_MEAS = 0xF4;
+    constexpr uint8_t REG_CONFIG = 0xF5;
+    constexpr uint8_t REG_PRESS_MSB = 0xF7;
+
+    constexpr uint8_t CHIP_ID = 0x58;
+    constexpr size_t CALIB_SIZE = 24;
+    constexpr size_t DATA_SIZE = 6;
+
+    constexpr uint8_t OSRS_T_X2 = 0x02;
+    constexpr uint8_t OSRS_P_X16 = 0x05;
+    constexpr uint8_t MODE_NORMAL = 0x03;
+    constexpr uint8_t FILTER_X16 = 0x04;
+
+    /// @brief Duração típica de uma conversão com oversampling x2/x16 (µs)
+    /// @details 1 ms + 2 ms * 2 + 2 ms * 16 + 0,5 ms (seção 3.8.1), a base
+    /// da tabela de ODR do datasheet (seção 3.8.2). Com o máximo (43,2 ms)
+    /// nenhum standby acima de 0,5 ms caberia em 100 ms e o sensor
+    /// converteria a cada ~44 ms; uma conversão mais lenta que a típica só
+    /// adia uma leitura, que read() marca como não nova
+    constexpr uint32_t MEASUREMENT_US = 37500;
+
+    inline uint16_t le16(const uint8_t *p) { return static_cast<uint16_t>(p[0] | (p[1] << 8)); }
+}
+
+constexpr uint32_t Bmp280::STANDBY_US[8];
+
+Bmp280::Bmp280(TwoWire &wire) : wire_(wire)
+{
+}
+
+bool Bmp280::begin(uint8_t address, uint32_t acquisitionPeriodMs)
+{
+    address_ = address;
+
+    uint8_t id = 0;
+    if (!readRegisters(REG_CHIP_ID, &id, 1) || id != CHIP_ID) return false;
+
+    uint8_t raw[CALIB_SIZE];
+    if (!readRegisters(REG_CALIB, raw, CALIB_SIZE)) return false;
+    calib_.t1 = le16(raw + 0);
+    calib_.t2 = static_cast<int16_t>(le16(raw + 2));
+    calib_.t3 = static_cast<int16_t>(le16(raw + 4));
+    calib_.p1 = le16(raw + 6);
+    calib_.p2 = static_cast<int16_t>(le16(raw + 8));
+    calib_.p3 = static_cast<int16_t>(le16(raw + 10));
+    calib_.p4 = static_cast<int16_t>(le16(raw + 12));
+    calib_.p5 = static_cast<int16_t>(le16(raw + 14));
+    calib_.p6 = static_cast<int16_t>(le16(raw + 16));
+    calib_.p7 = static_cast<int16_t>(le16(raw + 18));
+    calib_.p8 = static_cast<int16_t>(le16(raw + 20));
+    calib_.p9 = static_cast<int16_t>(le16(raw + 22));
+
+    uint8_t standby = standbyFor(MEASUREMENT_US, acquisitionPeriodMs * 1000UL);
+    outputPeriodUs_ = MEASUREMENT_US + STANDBY_US[standby];
+    lastAdcT_ = lastAdcP_ = -1;
+
+    // O registrador config só é aceito fora do modo normal: escreve antes de ctrl_meas
+    return writeRegister(REG_CONFIG, static_cast<uint8_t>((standby << 5) | (FILTER_X16 << 2))) &&
+           writeRegister(REG_CTRL_MEAS, static_cast<uint8_t>((OSRS_T_X2 << 5) | (OSRS_P_X16 << 2) | MODE_NORMAL));
+}
+
+bool Bmp280::read(BaroSample &out)
+{
+    uint8_t data[DATA_SIZE];
+    if (!readRegisters(REG_PRESS_MSB, data, DATA_SIZE)) return false;
+
+    int32_t adcP = (static_cast<int32_t>(data[0]) << 12) | (data[1] << 4) | (data[2] >> 4);
+    int32_t adcT = (static_cast<int32_t>(data[3]) << 12) | (data[4] << 4) | (data[5] >> 4);
+
+    // Com o filtro IIR ativo, duas conversões seguidas praticamente nunca
+    // produzem o mesmo par bruto: valores idênticos indicam leitura repetida
+    out.fresh = adcP != lastAdcP_ || adcT != lastAdcT_;
+    lastAdcP_ = adcP;
+    lastAdcT_ = adcT;
+
+    int32_t tFine;
+    out.temperature = compensateTemperature(adcT, calib_, tFine);
+    out.pressure = compensatePressure(adcP, calib_, tFine);
+    return true;
+}
+
+bool Bmp280::writeRegister(uint8_t reg, uint8_t value)
+{
+    wire_.beginTransmission(address_);
+    wire_.write(reg);
+    wire_.write(value);
+    return wire_.endTransmission() == 0;
+}
+
+bool Bmp280::readRegisters(uint8_t reg, uint8_t *buffer, size_t len)
+{
+    wire_.beginTransmission(address_);
+    wire_.write(reg);
+    if (wire_.endTransmission(false) != 0) return false;
+    if (wire_.requestFrom(static_cast<uint16_t>(address_), len, true) != len) return false;
+    return wire_.readBytes(buffer, len) == len;
+}
@@ -0,0 +1,174 @@
+/**
+ * @file Download.cpp
+ * @brief Implementação do envio do arquivo de voo
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * O Transfer::Sender e o arquivo aberto pertencem à tarefa da
+ * transferência; o callback de recepção só produz na fila.
+ */
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <string.h>
+
+#include "Config.h"
+#include "Download.h"
+#include "Log.h"
+#include "Recorder.h"
+
+namespace Download
+{
+    namespace
+    {
+        /// @brief Pedidos e ACKs já filtrados pelo MAC da Base
+        BaseLink *inbox = nullptr;
+        TaskHandle_t taskHandle = nullptr;
+
+        /// @brief Arquivo servido; usado apenas pela tarefa
+        File file;
+        char name[32] = "";
+
+        bool sendMessage(const uint8_t *message, size_t len, void *)
+        {
+            return send(message, len);
+        }
+
+        size_t readFile(uint32_t offset, uint8_t *out, size_t len, void *)
+        {
+            if (!file || !file.seek(offset)) return 0;
+            return file.read(out, len);
+        }
+
+        Transfer::Sender transfer(sendMessage, readFile, nullptr, Config::Download::WINDOW,
+                                  Config::Download::RETRY_TIMEOUT * 1000UL,
+                                  Config::Download::IDLE_TIMEOUT * 1000UL);
+
+        /**
+         * @brief Abre o arquivo de voo de maior número com conteúdo
+         *
+         * @details Os nomes têm o número com zeros à esquerda, então a
+         * ordem alfabética é a ordem dos voos.
+         */
+        bool openLatest()
+        {
+            if (file) file.close();
+            name[0] = '\0';
+
+            const size_t prefix = strlen(Config::Recorder::FILE_PREFIX);
+            File root = LittleFS.open("/");
+            if (!root || !root.isDirectory()) return false;
+
+            for (File entry = root.openNextFile(); entry; entry = root.openNextFile()) {
+                const char *path = entry.path();
+                if (entry.isDirectory() || entry.size() == 0 ||
+                    strncmp(path, Config::Recorder::FILE_PREFIX, prefix) != 0)
+                    continue;
+                if (strcmp(path, name) > 0) {
+                    strncpy(name, path, sizeof(name) - 1);
+                    name[sizeof(name) - 1] = '\0';
+                }
+            }
+            root.close();
+
+            if (name[0] == '\0') return false;
+            file = LittleFS.open(name, FILE_READ);
+            return static_cast<bool>(file);
+        }
+
+        /// @brief Atende um pedido da Base
+        void handleRequest(uint8_t session, uint32_t nowUs)
+        {
+            if (Recorder::state() == Recorder::RECORDING) {
+                transfer.begin(session, Transfer::BUSY, 0, "", nowUs);
+                return;
+            }
+            // Pedido repetido da mesma sessão: o Sender só repete o INFO
+            if (transfer.active()) {
+                transfer.begin(session, Transfer::OK, static_cast<uint32_t>(file.size()), name, nowUs);
+                return;
+            }
+            if (!openLatest()) {
+                transfer.begin(session, Transfer::NO_FILE, 0, "", nowUs);
+                LOG_WARN("Download: nenhum arquivo de voo");
+                return;
+            }
+            transfer.begin(session, Transfer::OK, static_cast<uint32_t>(file.size()), name, nowUs);
+            LOG_INFO("Download: enviando %s (%lu bytes)", name, (unsigned long)file.size());
+        }
+
+        /**
+         * @brief Tarefa da transferência
+         *
+         * @details Sem transferência, dorme até chegar um pedido; com
+         * ela, acorda a cada envio concluído ou a cada
+         * Config::Download::POLL_INTERVAL para os tempos limite.
+         */
+        void downloadTask(void *)
+        {
+            bool wasActive = false;
+
+            for (;;) {
+                ulTaskNotifyTake(pdTRUE, transfer.busy() ? pdMS_TO_TICKS(Config::Download::POLL_INTERVAL)
+                                                         : portMAX_DELAY);
+                const uint32_t nowUs = micros();
+
+                BaseLink::Message message;
+                while (inbox->popTransfer(message)) {
+                    uint8_t session;
+                    if (Transfer::parseRequest(message.data, message.length, session)) {
+                        handleRequest(session, nowUs);
+                    } else {
+                        transfer.receive(message.data, message.length, nowUs);
+                    }
+                }
+
+                // O voo tem prioridade: a Base desiste por tempo e pede de novo depois
+                if (transfer.active() && Recorder::state() == Recorder::RECORDING) continue;
+
+                const size_t pending = inFlight();
+                const size_t budget = pending < Config::Download::MAX_IN_FLIGHT
+                                          ? Config::Download::MAX_IN_FLIGHT - pending : 0;
+                transfer.poll(nowUs, budget);
+
+                if (wasActive && !transfer.active()) {
+                    file.close();
+                    if (transfer.complete()) {
+                        LOG_INFO("Download: %s entregue", name);
+                        Recorder::delivered(name);
+                    } else {
+                        LOG_WARN("Download: %s abandonado em %lu/%lu pedacos", name,
+                                 (unsigned long)transfer.acknowledged(), (unsigned long)transfer.chunks());
+                    }
+                }
+                wasActive = transfer.active();
+            }
+        }
+    }
+
+    bool start(BaseLink &link)
+    {
+        inbox = &link;
+        return xTaskCreatePinnedToCore(downloadTask, "download", Config::Download::TASK_STACK, nullptr,
+                                       Config::Download::TASK_PRIORITY, &taskHandle,
+                                       Config::Download::TASK_CORE) == pdPASS;
+    }
+
+    void notify()
+    {
+        if (taskHandle != nullptr) xTaskNotifyGive(taskHandle);
+    }
+
+    void wake()
+    {
+        if (taskHandle != nullptr && transfer.busy()) xTaskNotifyGive(taskHandle);
+    }
+
+    const Transfer::Sender &sender()
+    {
+        return transfer;
+    }
+}
@@ -0,0 +1,143 @@
+/**
+ * @file FlightState.cpp
+ * @brief Implementação da máquina de estados das fases de voo
+ * @version 1.0
+ * @date Outubro/2026
+ */
+
+// Roda na taxa do IMU junto com a fusão: nada de double
+#pragma GCC diagnostic error "-Wdouble-promotion"
+#pragma GCC diagnostic error "-Wfloat-conversion"
+
+#include "Config.h"
+#include "FastMath.h"
+#include "FlightState.h"
+
+bool FlightDetector::update(uint32_t timestampUs, const float acc[3], const float up[3],
+                            float baroAltitude, bool baroFresh, FlightEvent &event)
+{
+    using namespace Config::Flight;
+    constexpr float g = Config::Sensors::GRAVITY;
+
+    const float accNorm = FastMath::sqrt(acc[0] * acc[0] + acc[1] * acc[1] + acc[2] * acc[2]);
+
+    // A referência parte da primeira conversão do barômetro, que pode não
+    // vir na primeira amostra
+    if (baroFresh && !groundSet_) {
+        groundSet_ = true;
+        ground_ = baroAltitude;
+    }
+
+    if (!initialized_) {
+        initialized_ = true;
+        lastUs_ = phaseStartUs_ = timestampUs;
+        return false;
+    }
+    const float dt = static_cast<float>(timestampUs - lastUs_) * 1e-6f;
+    lastUs_ = timestampUs;
+
+    // Aceleração vertical no referencial da rampa, sem a gravidade
+    const float verticalAcc = acc[0] * up[0] + acc[1] * up[1] + acc[2] * up[2] - g;
+
+    // Na rampa a velocidade é nula por definição e a altitude de
+    // referência acompanha lentamente a deriva do barômetro. Durante a
+    // confirmação do lançamento o movimento já é integrado, para que a
+    // propulsão comece com a velocidade ganha nesse intervalo
+    if (phase_ == FlightPhase::PAD) {
+        const bool launching = accNorm > LAUNCH_ACCEL_G * g;
+        if (!launching) {
+            if (baroFresh) ground_ += GROUND_TRACKING_GAIN * (baroAltitude - ground_);
+            height_ = speed_ = maxHeight_ = 0.0f;
+        } else {
+            height_ += speed_ * dt + 0.5f * verticalAcc * dt * dt;
+            speed_ += verticalAcc * dt;
+            if (height_ > maxHeight_) maxHeight_ = height_;
+        }
+
+        if (held(launching, timestampUs, LAUNCH_HOLD_US)) {
+            enter(FlightPhase::BOOST, sinceUs_, event);
+            return true;
+        }
+        return false;
+    }
+
+    // Predição com a aceleração vertical; correção com o barômetro
+    height_ += speed_ * dt + 0.5f * verticalAcc * dt * dt;
+    speed_ += verticalAcc * dt;
+    if (baroFresh) {
+        float residual = (baroAltitude - ground_) - height_;
+        height_ += ALTITUDE_GAIN * residual;
+        speed_ += SPEED_GAIN * residual;
+    }
+    if (height_ > maxHeight_) maxHeight_ = height_;
+
+    switch (phase_) {
+        case FlightPhase::BOOST:
+            // Fim da propulsão: o foguete passa a desacelerar
+            if (held(verticalAcc < 0.0f, timestampUs, BURNOUT_HOLD_US)) {
+                enter(FlightPhase::COAST, sinceUs_, event);
+                return true;
+            }
+            if (timestampUs - phaseStartUs_ > MAX_BOOST_US) {
+                enter(FlightPhase::COAST, timestampUs, event);
+                return true;
+            }
+            return false;
+
+        case FlightPhase::COAST:
+            // Velocidade vertical cruzando zero; o barômetro confirma se a
+            // estimativa inercial se atrasar
+            if (speed_ <= 0.0f || height_ < maxHeight_ - APOGEE_DROP_M) {
+                enter(FlightPhase::APOGEE, timestampUs, event);
+                return true;
+            }
+            return false;
+
+        case FlightPhase::APOGEE:
+            enter(FlightPhase::DESCENT, timestampUs, event);
+            return true;
+
+        case FlightPhase::DESCENT: {
+            bool still = FastMath::absf(speed_) < LANDED_SPEED &&
+                         FastMath::absf(accNorm - g) < LANDED_ACCEL_TOLERANCE_G * g;
+            if (held(still, timestampUs, LANDED_HOLD_US)) {
+                enter(FlightPhase::LANDED, sinceUs_, event);
+                return true;
+            }
+            return false;
+        }
+
+        default:
+            return false;
+    }
+}
+
+void FlightDetector::reset()
+{
+    *this = FlightDetector();
+}
+
+bool FlightDetector::held(bool condition, uint32_t nowUs, uint32_t holdUs)
+{
+    if (!condition) {
+        holding_ = false;
+        return false;
+    }
+    if (!holding_) {
+        holding_ = true;
+        sinceUs_ = nowUs;
+    }
+    return nowUs - sinceUs_ >= holdUs;
+}
+
+void FlightDetector::enter(FlightPhase phase, uint32_t timestampUs, FlightEvent &event)
+{
+    phase_ = phase;
+    phaseStartUs_ = timestampUs;
+    holding_ = false;
+
+    event.phase = phase;
+    event.timestampUs = timestampUs;
+    event.altitude = height_;
+    event.verticalSpeed = speed_;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file Fusion.cpp
+ * @brief Implementação da fusão sensorial em precisão simples
+ * @version 1.0
+ * @date Outubro/2026
+ */
+
+// Caminho crítico: a FPU do ESP32 só opera em float, então qualquer
+// double implícito neste arquivo é rejeitado na compilação; as diretivas
+// vêm antes dos #include para valerem também em FastMath.h e Ahrs.h
+#pragma GCC diagnostic error "-Wdouble-promotion"
+#pragma GCC diagnostic error "-Wfloat-conversion"
+
+#include <math.h>
+
+#include "Ahrs.h"
+#include "Config.h"
+#include "FastMath.h"
+#include "Fusion.h"
+
+namespace Fusion
+{
+    namespace
+    {
+        Ahrs ahrs(Config::Sensors::AHRS_KP, Config::Sensors::AHRS_KI,
+                  Config::Sensors::AHRS_ACCEL_GATE);
+        FlightDetector flight;
+        uint32_t lastUpdateUs = 0;
+        bool initialized = false;
+
+        float lastPressure = 0.0f;
+        float lastAltitude = 0.0f;
+    }
+
+    void toSi(const ImuSample &raw, ImuReading &out)
+    {
+        using namespace Config::Sensors;
+        constexpr float accScale = GRAVITY / ACCEL_LSB_PER_G;
+        constexpr float gyroScale = FastMath::DEG_TO_RAD_F / GYRO_LSB_PER_DPS;
+
+        for (int axis = 0; axis < 3; axis++) {
+            out.acc[axis] = static_cast<float>(raw.acc[axis]) * accScale;
+            out.gyro[axis] = static_cast<float>(raw.gyro[axis]) * gyroScale;
+        }
+        out.temp = static_cast<float>(raw.temp) * (1.0f / 340.0f) + 36.53f;  // Fórmula do datasheet
+    }
+
+    bool update(const RawSample &sample, FusedSample &out)
+    {
+        using namespace Config::Sensors;
+        toSi(sample.imu, out.imu);
+
+        if (!initialized) {
+            initialized = true;
+            lastUpdateUs = sample.timestampUs;
+            ahrs.align(out.imu.acc);  // Parte da vertical medida, sem transitório
+            return false;
+        }
+        float dt = static_cast<float>(sample.timestampUs - lastUpdateUs) * 1e-6f;
+        lastUpdateUs = sample.timestampUs;
+        if (dt > AHRS_MAX_DT) dt = AHRS_MAX_DT;
+
+        ahrs.update(out.imu.gyro, out.imu.acc, dt);
+        const float *q = ahrs.quaternion();
+        for (int i = 0; i < 4; i++) out.quaternion[i] = q[i];
+        ahrs.angles(out.pitch, out.roll, out.yaw);
+        ahrs.gyroBias(out.gyroBias);
+
+        // Amostras sem conversão nova do barômetro repetem o valor anterior
+        out.baroFresh = sample.baro.fresh;
+        if (sample.baro.fresh) {
+            lastPressure = static_cast<float>(sample.baro.pressure) * (1.0f / 25600.0f);  // Q24.8 Pa -> hPa
+            lastAltitude = 44330.0f * (1.0f - powf(lastPressure / SEA_LEVEL_PRESSURE, 0.1903f));
+        }
+        out.pressure = lastPressure;
+        out.altitude = lastAltitude;
+
+        out.timestampUs = sample.timestampUs;
+
+        float up[3];
+        ahrs.up(up);
+        out.hasEvent = flight.update(sample.timestampUs, out.imu.acc, up,
+                                     lastAltitude, sample.baro.fresh, out.event);
+        out.phase = flight.phase();
+        out.verticalSpeed = flight.verticalSpeed();
+        return true;
+    }
+
+    void reset()
+    {
+        ahrs = Ahrs(Config::Sensors::AHRS_KP, Config::Sensors::AHRS_KI,
+                    Config::Sensors::AHRS_ACCEL_GATE);
+        flight.reset();
+        lastUpdateUs = 0;
+        initialized = false;
+        lastPressure = lastAltitude = 0.0f;
+    }
+}
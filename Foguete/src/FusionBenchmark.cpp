@@ -0,0 +1,94 @@
+/**
+ * @file FusionBenchmark.cpp
+ * @brief Micro-benchmark da fusão: filtro original em double contra AHRS em float
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Mantém uma cópia do passo de fusão original (atan2/sqrt/pow em double,
+ * constantes 180.0/PI e /1000.0) apenas como referência de desempenho.
+ * Fica fora de Fusion.cpp justamente por usar double.
+ */
+
+#include <Arduino.h>
+
+#include "Config.h"
+#include "Fusion.h"
+
+namespace
+{
+    constexpr uint32_t ITERATIONS = 1000;
+
+    /// @brief Coeficiente do antigo filtro complementar
+    constexpr float LEGACY_ALPHA = 0.98f;
+
+    /// @brief Passo de fusão como era antes da camada em float
+    float legacyStep(const ImuReading &imu, unsigned long currentTime, float &pitch, float &roll)
+    {
+        static unsigned long lastUpdateTime = 0;
+        float accPitch = atan2(imu.acc[1], sqrt(pow(imu.acc[0], 2) + pow(imu.acc[2], 2))) * 180.0 / PI;
+        float accRoll = atan2(-imu.acc[0], imu.acc[2]) * 180.0 / PI;
+
+        float dt = (currentTime - lastUpdateTime) / 1000.0;
+        lastUpdateTime = currentTime;
+
+        const float alpha = LEGACY_ALPHA;
+        pitch = alpha * (pitch + imu.gyro[0] * dt * RAD_TO_DEG) + (1 - alpha) * accPitch;
+        roll = alpha * (roll + imu.gyro[1] * dt * RAD_TO_DEG) + (1 - alpha) * accRoll;
+        return pitch + roll;
+    }
+
+    /// @brief Amostra sintética com leve variação a cada iteração
+    void syntheticSample(uint32_t i, RawSample &sample)
+    {
+        sample = {};
+        sample.imu.acc[0] = static_cast<int16_t>(120 + (i & 31));
+        sample.imu.acc[1] = static_cast<int16_t>(-250 + (i & 15));
+        sample.imu.acc[2] = static_cast<int16_t>(4096 - (i & 63));
+        sample.imu.gyro[0] = static_cast<int16_t>(30 - (i & 7));
+        sample.imu.gyro[1] = static_cast<int16_t>(-12 + (i & 3));
+        sample.imu.gyro[2] = 5;
+        sample.timestampUs = 1000 + i * 1000;
+    }
+}
+
+namespace Fusion
+{
+    void runBenchmark()
+    {
+        RawSample sample;
+        ImuReading imu;
+        FusedSample fused;
+        volatile float sink = 0.0f;
+
+        // Referência: caminho original em double
+        float pitch = 0.0f, roll = 0.0f;
+        uint32_t legacyCycles = 0;
+        for (uint32_t i = 0; i < ITERATIONS; i++) {
+            syntheticSample(i, sample);
+            toSi(sample.imu, imu);
+            uint32_t start = ESP.getCycleCount();
+            sink = legacyStep(imu, sample.timestampUs / 1000, pitch, roll);
+            legacyCycles += ESP.getCycleCount() - start;
+        }
+
+        // Caminho atual em float: conversão para SI e filtro de Mahony
+        reset();
+        uint32_t floatCycles = 0;
+        for (uint32_t i = 0; i < ITERATIONS; i++) {
+            syntheticSample(i, sample);
+            uint32_t start = ESP.getCycleCount();
+            update(sample, fused);
+            floatCycles += ESP.getCycleCount() - start;
+            sink = fused.pitch + fused.roll;
+        }
+        reset();
+        (void)sink;
+
+        const uint32_t floatPerStep = floatCycles / ITERATIONS;
+        const uint32_t budget = Config::Sensors::FUSION_CYCLE_BUDGET;
+        Serial.printf("Fusao: double=%lu ciclos/passo, float=%lu ciclos/passo (orcamento %lu, %s)\n",
+                      (unsigned long)(legacyCycles / ITERATIONS),
+                      (unsigned long)floatPerStep, (unsigned long)budget,
+                      floatPerStep <= budget ? "ok" : "EXCEDIDO");
+    }
+}
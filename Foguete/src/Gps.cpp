@@ -0,0 +1,319 @@
+/**
+ * @file Gps.cpp
+ * @brief Implementação da tarefa do GPS
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Roda no PRO_CPU, com prioridade abaixo da transmissão; a fila de
+ * posições até a fusão é SPSC, como as demais filas do pipeline.
+ *
+ * No modo UBX a tarefa primeiro reconfigura o receptor (porta, taxa de
+ * navegação e mensagens) e só passa a decodificar binário se cada passo
+ * for confirmado com ACK; caso contrário restaura o NMEA a 9600 baud.
+ */
+
+#include <Arduino.h>
+#include <TinyGPS++.h>
+#include <driver/uart.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+
+#include "Config.h"
+#include "Gps.h"
+#include "Log.h"
+#include "SpscQueue.h"
+#include "Ubx.h"
+
+namespace Gps
+{
+    namespace
+    {
+        constexpr uart_port_t PORT = static_cast<uart_port_t>(Config::Hardware::GPS_UART);
+
+        /// @brief Decodificador NMEA; acessado apenas pela tarefa do GPS
+        TinyGPSPlus parser;
+
+        /// @brief Decodificador UBX; acessado apenas pela tarefa do GPS
+        UbxParser ubx;
+
+        /// @brief Indica se o receptor aceitou o modo binário
+        volatile bool binary = false;
+
+        /// @brief Eventos do driver da UART (dados, transbordos)
+        QueueHandle_t uartQueue = nullptr;
+
+        /// @brief Posições: tarefa do GPS -> fusão
+        SpscQueue<Fix, Config::Gps::FIX_QUEUE_DEPTH> fixQueue;
+
+        Stats gpsStats = {};
+
+        /// @brief Entrega uma posição à fusão com o instante atual
+        void publish(const GPSData &data)
+        {
+            Fix fix;
+            fix.data = data;
+            fix.timestampUs = static_cast<uint32_t>(esp_timer_get_time());
+            fixQueue.push(fix);
+            gpsStats.fixes = gpsStats.fixes + 1;
+        }
+
+        /// @brief Publica a posição se a última sentença NMEA a atualizou
+        void publishIfUpdated()
+        {
+            if (!parser.location.isUpdated()) return;
+
+            Fix fix;
+            fix.data.latitude = parser.location.lat();   // lat() limpa isUpdated()
+            fix.data.longitude = parser.location.lng();
+            fix.data.altitude = parser.altitude.meters();
+            fix.data.day = parser.date.day();
+            fix.data.month = parser.date.month();
+            fix.data.year = parser.date.year();
+            fix.data.hour = parser.time.hour();
+            fix.data.minute = parser.time.minute();
+            fix.data.second = parser.time.second();
+            fix.data.fixAge = 0;
+            fix.data.hdop = parser.hdop.isValid() ? static_cast<float>(parser.hdop.hdop()) : 0.0f;
+            fix.data.satellites = parser.satellites.isValid()
+                                      ? static_cast<uint8_t>(parser.satellites.value())
+                                      : 0;
+            publish(fix.data);
+        }
+
+        /// @brief Grava um inteiro little-endian de 16 bits
+        void put16(uint8_t *p, uint16_t value)
+        {
+            p[0] = static_cast<uint8_t>(value);
+            p[1] = static_cast<uint8_t>(value >> 8);
+        }
+
+        /// @brief Grava um inteiro little-endian de 32 bits
+        void put32(uint8_t *p, uint32_t value)
+        {
+            for (int i = 0; i < 4; i++) p[i] = static_cast<uint8_t>(value >> (8 * i));
+        }
+
+        /// @brief Monta e envia um quadro UBX ao receptor
+        void sendUbx(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t len)
+        {
+            uint8_t frame[UbxParser::MAX_PAYLOAD + UbxParser::FRAME_OVERHEAD];
+            size_t n = UbxParser::frame(msgClass, msgId, payload, len, frame);
+            uart_write_bytes(PORT, frame, n);
+        }
+
+        /**
+         * @brief Envia uma mensagem de configuração e espera a resposta
+         * @retval true ACK-ACK recebido dentro de Config::Gps::ACK_TIMEOUT_MS
+         * @retval false ACK-NAK ou nenhuma resposta
+         */
+        bool configure(uint8_t msgId, const uint8_t *payload, uint16_t len)
+        {
+            sendUbx(UbxParser::CLASS_CFG, msgId, payload, len);
+
+            uint8_t buffer[64];
+            const TickType_t start = xTaskGetTickCount();
+            const TickType_t timeout = pdMS_TO_TICKS(Config::Gps::ACK_TIMEOUT_MS);
+            while (xTaskGetTickCount() - start < timeout) {
+                int n = uart_read_bytes(PORT, buffer, sizeof(buffer), pdMS_TO_TICKS(10));
+                if (n > 0) ubx.feed(buffer, static_cast<size_t>(n));
+
+                UbxParser::Ack ack;
+                while (ubx.takeAck(ack)) {
+                    if (ack.msgClass == UbxParser::CLASS_CFG && ack.msgId == msgId)
+                        return ack.accepted;
+                }
+            }
+            return false;
+        }
+
+        /// @brief Ativa uma mensagem NAV a cada época na porta atual (CFG-MSG)
+        bool enableNav(uint8_t msgId)
+        {
+            const uint8_t payload[3] = {UbxParser::CLASS_NAV, msgId, 1};
+            return configure(UbxParser::CFG_MSG, payload, sizeof(payload));
+        }
+
+        /**
+         * @brief Configura a UART1 do receptor (CFG-PRT) e acompanha a velocidade
+         *
+         * @details O receptor troca de velocidade antes de responder, então
+         * o ACK desta mensagem não é confiável; a confirmação vem da
+         * mensagem seguinte, já na nova velocidade.
+         */
+        void configurePort(uint32_t baudRate, uint16_t outProtocols)
+        {
+            uint8_t payload[20] = {};
+            payload[0] = 1;                     // UART1 do receptor
+            put32(payload + 4, 0x000008D0);     // 8N1
+            put32(payload + 8, baudRate);
+            put16(payload + 12, 0x0003);        // Entrada: UBX + NMEA
+            put16(payload + 14, outProtocols);
+            sendUbx(UbxParser::CLASS_CFG, UbxParser::CFG_PRT, payload, sizeof(payload));
+
+            uart_wait_tx_done(PORT, pdMS_TO_TICKS(100));
+            vTaskDelay(pdMS_TO_TICKS(100));
+            uart_set_baudrate(PORT, baudRate);
+            uart_flush_input(PORT);
+        }
+
+        /// @brief Ajusta o período de navegação (CFG-RATE)
+        bool configureRate(uint16_t periodMs)
+        {
+            uint8_t payload[6];
+            put16(payload, periodMs);
+            put16(payload + 2, 1);  // Uma solução por medida
+            put16(payload + 4, 1);  // Referência de tempo GPS
+            return configure(UbxParser::CFG_RATE, payload, sizeof(payload));
+        }
+
+        /// @brief Volta o receptor ao NMEA a 1 Hz e 9600 baud
+        void restoreNmea()
+        {
+            configureRate(1000);
+            configurePort(Config::Gps::BAUD_RATE, 0x0002);
+        }
+
+        /**
+         * @brief Passa o receptor para UBX binário
+         *
+         * @details Tenta NAV-PVT; receptores sem essa mensagem (NEO-6)
+         * respondem NAK e recebem NAV-POSLLH, NAV-SOL e NAV-TIMEUTC.
+         * NAV-DOP é opcional e fornece o HDOP.
+         *
+         * @retval true Receptor em UBX na taxa configurada
+         * @retval false Algum passo não foi confirmado; NMEA restaurado
+         */
+        bool configureUbx()
+        {
+            using namespace Config::Gps;
+            configurePort(UBX_BAUD_RATE, 0x0001);
+
+            bool ok = configureRate(static_cast<uint16_t>(1000U / UBX_RATE_HZ));
+            if (ok) {
+                enableNav(UbxParser::NAV_DOP);
+                ok = enableNav(UbxParser::NAV_PVT) ||
+                     (enableNav(UbxParser::NAV_POSLLH) && enableNav(UbxParser::NAV_SOL) &&
+                      enableNav(UbxParser::NAV_TIMEUTC));
+            }
+            if (!ok) restoreNmea();
+            return ok;
+        }
+
+        /// @brief Entrega um bloco recebido ao decodificador ativo
+        void decode(const uint8_t *data, size_t len)
+        {
+            if (binary) {
+                ubx.feed(data, len);
+                GPSData fix;
+                if (ubx.takeFix(fix)) publish(fix);
+                gpsStats.sentences = ubx.frames();
+                gpsStats.checksumErrors = ubx.errors();
+                return;
+            }
+
+            for (size_t i = 0; i < len; i++) {
+                if (parser.encode(static_cast<char>(data[i]))) {
+                    gpsStats.sentences = gpsStats.sentences + 1;
+                    publishIfUpdated();
+                }
+            }
+            gpsStats.checksumErrors = parser.failedChecksum();
+        }
+
+        /**
+         * @brief Tarefa do GPS
+         *
+         * @details Dorme na fila de eventos da UART. Cada evento de dados
+         * é lido sem espera e entregue ao decodificador ativo; as
+         * posições são publicadas ao fim de cada sentença ou época.
+         */
+        void gpsTask(void *)
+        {
+            uint8_t buffer[Config::Gps::READ_CHUNK];
+            uart_event_t event;
+
+            if (Config::Gps::USE_UBX) {
+                binary = configureUbx();
+                LOG_INFO("GPS: %s", binary ? "UBX binario" : "UBX sem resposta, usando NMEA");
+                xQueueReset(uartQueue);  // Eventos da configuração já foram consumidos
+            }
+
+            for (;;) {
+                if (xQueueReceive(uartQueue, &event, portMAX_DELAY) != pdTRUE) continue;
+
+                switch (event.type) {
+                    case UART_DATA: {
+                        size_t remaining = event.size;
+                        while (remaining > 0) {
+                            size_t chunk = remaining < sizeof(buffer) ? remaining : sizeof(buffer);
+                            int n = uart_read_bytes(PORT, buffer, chunk, 0);
+                            if (n <= 0) break;
+                            remaining -= static_cast<size_t>(n);
+                            decode(buffer, static_cast<size_t>(n));
+                        }
+                        break;
+                    }
+
+                    case UART_FIFO_OVF:
+                    case UART_BUFFER_FULL:
+                        // Dados perdidos: descarta o restante e ressincroniza
+                        // na próxima sentença
+                        gpsStats.overruns = gpsStats.overruns + 1;
+                        uart_flush_input(PORT);
+                        xQueueReset(uartQueue);
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+        }
+    }
+
+    bool start()
+    {
+        using namespace Config::Gps;
+
+        uart_config_t config = {};
+        config.baud_rate = static_cast<int>(BAUD_RATE);
+        config.data_bits = UART_DATA_8_BITS;
+        config.parity = UART_PARITY_DISABLE;
+        config.stop_bits = UART_STOP_BITS_1;
+        config.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+        config.source_clk = UART_SCLK_APB;
+
+        if (uart_param_config(PORT, &config) != ESP_OK) return false;
+        if (uart_set_pin(PORT, Config::Hardware::GPS_TX, Config::Hardware::GPS_RX,
+                         UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE) != ESP_OK)
+            return false;
+        if (uart_driver_install(PORT, RX_BUFFER_SIZE, 0, EVENT_QUEUE_DEPTH, &uartQueue, 0) != ESP_OK)
+            return false;
+
+        return xTaskCreatePinnedToCore(gpsTask, "gps", Config::Tasks::GPS_STACK, nullptr,
+                                       Config::Tasks::GPS_PRIORITY, nullptr,
+                                       Config::Tasks::COMM_CORE) == pdPASS;
+    }
+
+    bool poll(Fix &fix)
+    {
+        bool updated = false;
+        Fix item;
+        while (fixQueue.pop(item)) {
+            fix = item;
+            updated = true;
+        }
+        return updated;
+    }
+
+    const Stats &stats()
+    {
+        return gpsStats;
+    }
+
+    bool usingUbx()
+    {
+        return binary;
+    }
+}
@@ -0,0 +1,314 @@
+/**
+ * @file Log.cpp
+ * @brief Implementação do registro assíncrono
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * O buffer é a fila limitada de Vyukov: cada posição tem um número de
+ * sequência que diz se está livre para o produtor da volta atual ou
+ * pronta para o consumidor. Produtores concorrentes (tarefas nos dois
+ * núcleos) disputam apenas o índice de escrita, com compare-exchange; a
+ * tarefa de esvaziamento é o único consumidor.
+ */
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <stdarg.h>
+#include <string.h>
+
+#include "Log.h"
+
+namespace Log
+{
+    namespace
+    {
+        constexpr size_t SLOTS = Config::Log::SLOTS;
+        constexpr uint32_t MASK = SLOTS - 1U;
+        static_assert(SLOTS >= 2 && (SLOTS & MASK) == 0, "Config::Log::SLOTS deve ser potencia de 2");
+        static_assert(RECORD_BYTES <= UINT8_MAX, "O tamanho do registro vai em um byte");
+
+        struct Record {
+            uint32_t timestampUs;
+            const char *format;  ///< Modo binário: identifica o formato
+            uint8_t level;
+            uint8_t length;
+            char data[RECORD_BYTES];
+        };
+
+        /**
+         * @brief Posição do buffer
+         *
+         * @details sequence guarda o número de sequência menos o índice da
+         * posição, para que o buffer zerado já comece válido: 0 significa
+         * "livre para a escrita de número igual ao índice".
+         */
+        struct Slot {
+            std::atomic<uint32_t> sequence;
+            Record record;
+        };
+
+        Slot ring[SLOTS];
+        std::atomic<uint32_t> head{0};
+        uint32_t tail = 0;  ///< Só a tarefa de esvaziamento usa
+
+        std::atomic<uint32_t> written{0};
+        std::atomic<uint32_t> dropped{0};
+        std::atomic<uint32_t> truncated{0};
+
+        /**
+         * @brief Grava os argumentos de @p format sem formatá-los
+         * @return Bytes usados em @p out; para no primeiro que não couber
+         */
+        size_t packArguments(const char *format, va_list args, char *out, size_t capacity, bool &cut)
+        {
+            size_t used = 0;
+            cut = false;
+
+            auto put = [&](const void *value, size_t size) {
+                if (used + size > capacity) {
+                    cut = true;
+                    return false;
+                }
+                memcpy(out + used, value, size);
+                used += size;
+                return true;
+            };
+            auto putInt = [&](int32_t value) { return put(&value, sizeof(value)); };
+
+            for (const char *p = strchr(format, '%'); p != nullptr && !cut; p = strchr(p, '%')) {
+                p++;
+                if (*p == '%') {
+                    p++;
+                    continue;
+                }
+                while (*p != '\0' && strchr("-+ #0", *p) != nullptr) p++;
+                if (*p == '*') {
+                    putInt(va_arg(args, int));
+                    p++;
+                }
+                while (*p >= '0' && *p <= '9') p++;
+                if (*p == '.') {
+                    p++;
+                    if (*p == '*') {
+                        putInt(va_arg(args, int));
+                        p++;
+                    }
+                    while (*p >= '0' && *p <= '9') p++;
+                }
+
+                int longs = 0;
+                bool sized = false;
+                for (; *p != '\0' && strchr("hlLjzt", *p) != nullptr; p++) {
+                    if (*p == 'l') longs++;
+                    if (*p == 'z' || *p == 't' || *p == 'j') sized = true;
+                }
+
+                switch (*p) {
+                    case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+                        if (longs >= 2) {
+                            const long long value = va_arg(args, long long);
+                            put(&value, sizeof(value));
+                        } else if (longs == 1) {
+                            putInt(static_cast<int32_t>(va_arg(args, long)));
+                        } else if (sized) {
+                            putInt(static_cast<int32_t>(va_arg(args, size_t)));
+                        } else {
+                            putInt(va_arg(args, int));
+                        }
+                        break;
+                    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+                        const double value = va_arg(args, double);
+                        put(&value, sizeof(value));
+                        break;
+                    }
+                    case 's': {
+                        const char *text = va_arg(args, const char *);
+                        size_t length = text != nullptr ? strlen(text) : 0;
+                        if (length > UINT8_MAX) length = UINT8_MAX;
+                        if (used + 1 + length > capacity) {
+                            length = used + 1 < capacity ? capacity - used - 1 : 0;
+                            cut = true;
+                        }
+                        if (used < capacity) {
+                            out[used++] = static_cast<char>(length);
+                            memcpy(out + used, text, length);
+                            used += length;
+                        }
+                        break;
+                    }
+                    case 'p':
+                        putInt(static_cast<int32_t>(reinterpret_cast<uintptr_t>(va_arg(args, void *))));
+                        break;
+                    default:
+                        return used;  // Conversão desconhecida: o host mostra o resto cru
+                }
+            }
+            return used;
+        }
+
+        bool pop(Record &out)
+        {
+            Slot &slot = ring[tail & MASK];
+            const uint32_t sequence = slot.sequence.load(std::memory_order_acquire) + (tail & MASK);
+            if (static_cast<int32_t>(sequence - (tail + 1U)) < 0) return false;
+
+            out = slot.record;
+            slot.sequence.store(tail + SLOTS - (tail & MASK), std::memory_order_release);
+            tail++;
+            return true;
+        }
+
+        /// @brief Formatos já enviados por extenso no modo binário
+        const char *knownFormats[Config::Log::FORMAT_CACHE] = {};
+        size_t nextFormat = 0;
+
+        template <typename T>
+        void emit(const T &value)
+        {
+            Serial.write(reinterpret_cast<const uint8_t *>(&value), sizeof(value));
+        }
+
+        void emitBinary(const Record &record)
+        {
+            const uint32_t id = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(record.format));
+            bool known = false;
+            for (size_t i = 0; i < Config::Log::FORMAT_CACHE && !known; i++)
+                known = knownFormats[i] == record.format;
+
+            if (!known) {
+                size_t length = strlen(record.format);
+                if (length > UINT8_MAX) length = UINT8_MAX;
+                Serial.write(BINARY_SYNC);
+                Serial.write('S');
+                emit(id);
+                Serial.write(static_cast<uint8_t>(length));
+                Serial.write(reinterpret_cast<const uint8_t *>(record.format), length);
+                knownFormats[nextFormat] = record.format;
+                nextFormat = (nextFormat + 1) % Config::Log::FORMAT_CACHE;
+            }
+
+            Serial.write(BINARY_SYNC);
+            Serial.write('R');
+            emit(record.timestampUs);
+            Serial.write(record.level);
+            emit(id);
+            Serial.write(record.length);
+            Serial.write(reinterpret_cast<const uint8_t *>(record.data), record.length);
+        }
+
+        void emitDropped(uint32_t total)
+        {
+            if (Config::Log::BINARY) {
+                Serial.write(BINARY_SYNC);
+                Serial.write('D');
+                emit(total);
+            } else {
+                Serial.printf("W log: %lu mensagens descartadas no total\n", (unsigned long)total);
+            }
+        }
+
+        /**
+         * @brief Tarefa de esvaziamento
+         *
+         * @details Única que escreve na serial depois de start(); o
+         * bloqueio da UART fica todo aqui.
+         */
+        void drainTask(void *)
+        {
+            static Record record;
+            uint32_t reported = 0;
+
+            for (;;) {
+                while (pop(record)) {
+                    if (Config::Log::BINARY) {
+                        emitBinary(record);
+                    } else {
+                        Serial.write(levelTag(static_cast<Level>(record.level)));
+                        Serial.write(' ');
+                        Serial.write(reinterpret_cast<const uint8_t *>(record.data), record.length);
+                        Serial.write('\n');
+                    }
+                }
+
+                const uint32_t lost = dropped.load(std::memory_order_relaxed);
+                if (lost != reported) {
+                    reported = lost;
+                    emitDropped(lost);
+                }
+                vTaskDelay(pdMS_TO_TICKS(Config::Log::DRAIN_INTERVAL));
+            }
+        }
+    }
+
+    bool start()
+    {
+        return xTaskCreatePinnedToCore(drainTask, "log", Config::Log::TASK_STACK, nullptr,
+                                       Config::Log::TASK_PRIORITY, nullptr,
+                                       Config::Log::TASK_CORE) == pdPASS;
+    }
+
+    void write(Level level, const char *format, ...)
+    {
+        // Reserva uma posição: disputa só o índice de escrita
+        uint32_t position = head.load(std::memory_order_relaxed);
+        Slot *slot;
+        for (;;) {
+            slot = &ring[position & MASK];
+            const uint32_t sequence = slot->sequence.load(std::memory_order_acquire) + (position & MASK);
+            const int32_t difference = static_cast<int32_t>(sequence - position);
+            if (difference == 0) {
+                if (head.compare_exchange_weak(position, position + 1U, std::memory_order_relaxed))
+                    break;
+            } else if (difference < 0) {
+                dropped.fetch_add(1, std::memory_order_relaxed);  // Cheio
+                return;
+            } else {
+                position = head.load(std::memory_order_relaxed);
+            }
+        }
+
+        Record &record = slot->record;
+        record.timestampUs = static_cast<uint32_t>(micros());
+        record.format = format;
+        record.level = level;
+
+        va_list args;
+        va_start(args, format);
+        bool cut;
+        if (Config::Log::BINARY) {
+            record.length = static_cast<uint8_t>(packArguments(format, args, record.data, RECORD_BYTES, cut));
+        } else {
+            const int length = vsnprintf(record.data, RECORD_BYTES, format, args);
+            cut = length >= static_cast<int>(RECORD_BYTES);
+            record.length = static_cast<uint8_t>(length < 0 ? 0 : cut ? RECORD_BYTES - 1 : length);
+        }
+        va_end(args);
+
+        if (cut) truncated.fetch_add(1, std::memory_order_relaxed);
+        written.fetch_add(1, std::memory_order_relaxed);
+        slot->sequence.store(position + 1U - (position & MASK), std::memory_order_release);
+    }
+
+    Stats stats()
+    {
+        Stats s;
+        s.written = written.load(std::memory_order_relaxed);
+        s.dropped = dropped.load(std::memory_order_relaxed);
+        s.truncated = truncated.load(std::memory_order_relaxed);
+        return s;
+    }
+
+    char levelTag(Level level)
+    {
+        switch (level) {
+            case ERROR: return 'E';
+            case WARN:  return 'W';
+            case INFO:  return 'I';
+            case DEBUG: return 'D';
+            default:    return '?';
+        }
+    }
+}
@@ -0,0 +1,168 @@
+/**
+ * @file Mpu6050.cpp
+ * @brief Implementação do driver enxuto do MPU6050
+ * @version 1.1
+ * @date Outubro/2026
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include "Config.h"
+#include "Mpu6050.h"
+
+namespace
+{
+    // Mapa de registradores (MPU-6000/6050 Register Map, rev. 4.2)
+    constexpr uint8_t REG_SMPLRT_DIV = 0x19;
+    constexpr uint8_t REG_CONFIG = 0x1A;
+    constexpr uint8_t REG_GYRO_CONFIG = 0x1B;
+    constexpr uint8_t REG_ACCEL_CONFIG = 0x1C;
+    constexpr uint8_t REG_FIFO_EN = 0x23;
+    constexpr uint8_t REG_INT_PIN_CFG = 0x37;
+    constexpr uint8_t REG_INT_ENABLE = 0x38;
+    constexpr uint8_t REG_INT_STATUS = 0x3A;
+    constexpr uint8_t REG_ACCEL_XOUT_H = 0x3B;
+    constexpr uint8_t REG_USER_CTRL = 0x6A;
+    constexpr uint8_t REG_PWR_MGMT_1 = 0x6B;
+    constexpr uint8_t REG_FIFO_COUNTH = 0x72;
+    constexpr uint8_t REG_FIFO_R_W = 0x74;
+    constexpr uint8_t REG_WHO_AM_I = 0x75;
+
+    constexpr uint8_t WHO_AM_I_VALUE = 0x68;
+    constexpr uint8_t PWR_MGMT_1_RESET = 0x80;
+    constexpr uint8_t PWR_MGMT_1_CLK_PLL_XGYRO = 0x01;
+    constexpr uint8_t GYRO_CONFIG_500DPS = 0x08;   // FS_SEL = 1
+    constexpr uint8_t ACCEL_CONFIG_8G = 0x10;      // AFS_SEL = 2
+
+    constexpr uint8_t FIFO_EN_ALL = 0xF8;   // TEMP | XG | YG | ZG | ACCEL
+    constexpr uint8_t USER_CTRL_FIFO_EN = 0x40;
+    constexpr uint8_t USER_CTRL_FIFO_RESET = 0x04;
+    constexpr uint8_t INT_STATUS_FIFO_OFLOW = 0x10;
+    constexpr uint8_t INT_PIN_CFG_RD_CLEAR = 0x10;   // Pulso ativo alto, limpa em qualquer leitura
+    constexpr uint8_t INT_ENABLE_DATA_RDY = 0x01;
+
+    /// @brief DLPF de 188 Hz: mantém a taxa base do giroscópio em 1 kHz
+    constexpr uint8_t DLPF_CFG_188HZ = 0x01;
+
+    /// @brief DLPF de 21 Hz, usado no modo POLLED
+    constexpr uint8_t DLPF_CFG_21HZ = 0x04;
+
+    /// @brief Taxa base de saída com o DLPF habilitado (Hz)
+    constexpr uint16_t GYRO_OUTPUT_RATE = 1000;
+}
+
+Mpu6050::Mpu6050(TwoWire &wire, uint8_t address)
+    : wire_(wire), address_(address)
+{
+}
+
+bool Mpu6050::begin()
+{
+    uint8_t id = 0;
+    if (!readRegisters(REG_WHO_AM_I, &id, 1) || id != WHO_AM_I_VALUE) return false;
+
+    if (!writeRegister(REG_PWR_MGMT_1, PWR_MGMT_1_RESET)) return false;
+    delay(100);  // Tempo de reinicialização dos registradores
+
+    return writeRegister(REG_PWR_MGMT_1, PWR_MGMT_1_CLK_PLL_XGYRO) &&
+           writeRegister(REG_ACCEL_CONFIG, ACCEL_CONFIG_8G) &&
+           writeRegister(REG_GYRO_CONFIG, GYRO_CONFIG_500DPS) &&
+           writeRegister(REG_CONFIG, DLPF_CFG_21HZ) &&
+           writeRegister(REG_SMPLRT_DIV, 0);
+}
+
+bool Mpu6050::beginFifo(uint16_t sampleRateHz)
+{
+    bool ok = configureRate(sampleRateHz) &&
+              writeRegister(REG_FIFO_EN, FIFO_EN_ALL);
+    if (!ok) return false;
+
+    resetFifo();
+    overflows_ = 0;
+    return true;
+}
+
+bool Mpu6050::beginDataReady(uint16_t sampleRateHz)
+{
+    return configureRate(sampleRateHz) &&
+           writeRegister(REG_FIFO_EN, 0) &&
+           writeRegister(REG_USER_CTRL, 0) &&
+           writeRegister(REG_INT_PIN_CFG, INT_PIN_CFG_RD_CLEAR) &&
+           writeRegister(REG_INT_ENABLE, INT_ENABLE_DATA_RDY);
+}
+
+bool Mpu6050::readSample(ImuSample &out)
+{
+    uint8_t frame[FRAME_SIZE];
+    if (!readRegisters(REG_ACCEL_XOUT_H, frame, FRAME_SIZE)) return false;
+    return decode(frame, FRAME_SIZE, &out, 1) == 1;
+}
+
+size_t Mpu6050::drainFifo(ImuSample *out, size_t max, uint32_t nowUs)
+{
+    uint8_t status = 0;
+    if (!readRegisters(REG_INT_STATUS, &status, 1)) return 0;
+    if (status & INT_STATUS_FIFO_OFLOW) {
+        overflows_++;
+        resetFifo();
+        return 0;
+    }
+
+    uint8_t countBytes[2];
+    if (!readRegisters(REG_FIFO_COUNTH, countBytes, 2)) return 0;
+    const size_t available = ((countBytes[0] << 8) | countBytes[1]) / FRAME_SIZE;
+    const size_t frames = min(available, max);
+
+    // Rajadas limitadas ao buffer da biblioteca Wire, sempre em quadros inteiros
+    constexpr size_t framesPerBurst = Config::Sensors::I2C_BURST_BYTES / FRAME_SIZE;
+    uint8_t burst[framesPerBurst * FRAME_SIZE];
+
+    size_t total = 0;
+    while (total < frames) {
+        size_t n = min(frames - total, framesPerBurst);
+        if (!readRegisters(REG_FIFO_R_W, burst, n * FRAME_SIZE)) break;
+        total += decode(burst, n * FRAME_SIZE, out + total, n);
+    }
+
+    // Os quadros que ficaram no FIFO são mais novos que os lidos: a âncora
+    // é o último quadro lido, e não o instante da leitura
+    const uint32_t newestUs = nowUs - static_cast<uint32_t>(available - total) * periodUs_;
+    stamp(out, total, newestUs, periodUs_, lastTimestampUs_);
+    return total;
+}
+
+bool Mpu6050::configureRate(uint16_t sampleRateHz)
+{
+    sampleRateHz = constrain<uint16_t>(sampleRateHz, 4, GYRO_OUTPUT_RATE);
+    uint8_t divider = static_cast<uint8_t>(GYRO_OUTPUT_RATE / sampleRateHz - 1);
+    periodUs_ = 1000000UL * (divider + 1) / GYRO_OUTPUT_RATE;
+
+    return writeRegister(REG_CONFIG, DLPF_CFG_188HZ) &&
+           writeRegister(REG_SMPLRT_DIV, divider);
+}
+
+bool Mpu6050::writeRegister(uint8_t reg, uint8_t value)
+{
+    wire_.beginTransmission(address_);
+    wire_.write(reg);
+    wire_.write(value);
+    return wire_.endTransmission() == 0;
+}
+
+bool Mpu6050::readRegisters(uint8_t reg, uint8_t *buffer, size_t len)
+{
+    wire_.beginTransmission(address_);
+    wire_.write(reg);
+    if (wire_.endTransmission(false) != 0) return false;
+    if (wire_.requestFrom(static_cast<uint16_t>(address_), len, true) != len) return false;
+    return wire_.readBytes(buffer, len) == len;
+}
+
+void Mpu6050::resetFifo()
+{
+    writeRegister(REG_USER_CTRL, 0);
+    writeRegister(REG_USER_CTRL, USER_CTRL_FIFO_RESET);
+    writeRegister(REG_USER_CTRL, USER_CTRL_FIFO_EN);
+    lastTimestampUs_ = 0;
+}
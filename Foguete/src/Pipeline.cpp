@@ -0,0 +1,325 @@
+/**
+ * @file Pipeline.cpp
+ * @brief Implementação das tarefas FreeRTOS do pipeline de telemetria
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Aquisição e fusão rodam no APP_CPU; transmissão e registro no PRO_CPU.
+ * As filas SPSC carregam os dados e as notificações de tarefa apenas
+ * acordam o consumidor, sem nenhum mutex no caminho dos sensores.
+ */
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_timer.h>
+
+#include "Config.h"
+#include "Log.h"
+#include "Pipeline.h"
+#include "SpscQueue.h"
+
+namespace Pipeline
+{
+    namespace
+    {
+        /// @brief Amostras brutas: aquisição -> fusão
+        SpscQueue<RawSample, Config::Tasks::RAW_QUEUE_DEPTH> rawQueue;
+
+        /// @brief Pacotes fundidos: fusão -> transmissão
+        SpscQueue<SensorData, Config::Tasks::TX_QUEUE_DEPTH> txQueue;
+
+        /// @brief Pacotes fundidos: fusão -> registro
+        SpscQueue<SensorData, Config::Tasks::QUEUE_DEPTH> logQueue;
+
+        /// @brief Instantes de disparo: ISR/timer -> aquisição
+        SpscQueue<uint32_t, Config::Tasks::TRIGGER_QUEUE_DEPTH> triggerQueue;
+
+        /// @brief Estatísticas de cada estágio
+        StageStats stageStats[STAGE_COUNT] = {};
+
+        /// @brief Estatísticas de jitter da aquisição disparada
+        JitterStats jitterStats = {};
+
+        TaskHandle_t acquisitionHandle = nullptr;
+        TaskHandle_t fusionHandle = nullptr;
+        TaskHandle_t loggingHandle = nullptr;
+
+        /// @brief Contabiliza o tempo gasto em um item do estágio
+        void account(Stage stage, uint32_t startMicros)
+        {
+            uint32_t elapsed = micros() - startMicros;
+            StageStats &s = stageStats[stage];
+            s.processed = s.processed + 1;
+            s.totalMicros = s.totalMicros + elapsed;
+            if (elapsed > s.maxMicros) s.maxMicros = elapsed;
+        }
+
+        /// @brief Tempo atual em µs, na mesma base dos timestamps das amostras
+        inline uint32_t nowMicros()
+        {
+            return static_cast<uint32_t>(esp_timer_get_time());
+        }
+
+        /// @brief Entrega um lote à fusão e contabiliza o estágio
+        void publish(const RawSample *batch, size_t count)
+        {
+            for (size_t i = 0; i < count; i++)
+                rawQueue.push(batch[i]);
+            if (count > 0) {
+                stageStats[ACQUISITION].dropped = rawQueue.dropped();
+                xTaskNotifyGive(fusionHandle);
+            }
+        }
+
+        /// @brief Mede o desvio do intervalo entre disparos em relação ao nominal
+        void accountJitter(uint32_t timestampUs, uint32_t periodUs)
+        {
+            static uint32_t previousUs = 0;
+            if (previousUs != 0) {
+                int32_t deviation = static_cast<int32_t>(timestampUs - previousUs - periodUs);
+                uint32_t absDeviation = deviation < 0 ? -deviation : deviation;
+                jitterStats.intervals = jitterStats.intervals + 1;
+                jitterStats.sumDeviationUs = jitterStats.sumDeviationUs + absDeviation;
+                if (absDeviation > jitterStats.maxDeviationUs)
+                    jitterStats.maxDeviationUs = absDeviation;
+            }
+            previousUs = timestampUs;
+        }
+
+        /**
+         * @brief Tarefa de aquisição
+         *
+         * @details Nos modos POLLED e FIFO roda em período fixo com
+         * vTaskDelayUntil, portanto a taxa de amostragem não depende dos
+         * estágios seguintes; no modo FIFO cada ciclo entrega um lote.
+         * Nos modos DATA_READY e TIMER a tarefa dorme até um disparo e
+         * usa como timestamp o instante capturado no próprio disparo.
+         */
+        void acquisitionTask(void *)
+        {
+            using Config::Sensors::ImuMode;
+            constexpr ImuMode mode = Config::Sensors::IMU_MODE;
+            static RawSample batch[Config::Tasks::ACQUISITION_BATCH];
+
+            if (mode == ImuMode::DATA_READY || mode == ImuMode::TIMER) {
+                const uint32_t periodUs = 1000000UL / Config::Sensors::IMU_SAMPLE_RATE;
+
+                for (;;) {
+                    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+                    // Se a tarefa atrasou, os registradores só têm a amostra
+                    // mais recente: as anteriores são contadas como perdidas
+                    uint32_t triggerUs = 0;
+                    uint32_t pending = 0;
+                    uint32_t timestampUs;
+                    while (triggerQueue.pop(timestampUs)) {
+                        triggerUs = timestampUs;
+                        pending++;
+                    }
+                    if (pending == 0) continue;
+                    if (pending > 1) jitterStats.missed = jitterStats.missed + (pending - 1);
+
+                    uint32_t start = micros();
+                    accountJitter(triggerUs, periodUs * pending);
+                    publish(batch, acquire(batch, 1, triggerUs));
+                    account(ACQUISITION, start);
+                }
+            }
+
+            const uint32_t periodMs = mode == ImuMode::FIFO
+                                          ? Config::Timing::FIFO_DRAIN_INTERVAL
+                                          : Config::Timing::SENSOR_READ_INTERVAL;
+            const TickType_t period = pdMS_TO_TICKS(periodMs);
+            TickType_t lastWake = xTaskGetTickCount();
+
+            for (;;) {
+                vTaskDelayUntil(&lastWake, period);
+                uint32_t start = micros();
+                publish(batch, acquire(batch, Config::Tasks::ACQUISITION_BATCH, nowMicros()));
+                account(ACQUISITION, start);
+            }
+        }
+
+        /**
+         * @brief Tarefa de fusão sensorial
+         *
+         * @details Acorda a cada lote novo e processa todas as amostras
+         * na taxa do IMU. O resultado vai para a fila de transmissão a
+         * cada sampleInterval() (decidido pelo controle de taxa) e para a
+         * fila de registro a cada Config::Timing::LOG_INTERVAL.
+         */
+        void fusionTask(void *)
+        {
+            const uint32_t logIntervalUs = Config::Timing::LOG_INTERVAL * 1000UL;
+            uint32_t lastTxUs = 0;
+            uint32_t lastLogUs = 0;
+            RawSample sample;
+            SensorData data;
+
+            for (;;) {
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+                while (rawQueue.pop(sample)) {
+                    uint32_t start = micros();
+                    if (fuse(sample, data)) {
+                        const uint32_t txIntervalUs = sampleInterval();
+                        const uint32_t sinceTxUs = sample.timestampUs - lastTxUs;
+                        if (sinceTxUs >= txIntervalUs) {
+                            // Mantém a cadência média mesmo que o IMU não caia
+                            // exatamente no instante; após um buraco, recomeça
+                            lastTxUs = sinceTxUs < 2U * txIntervalUs ? lastTxUs + txIntervalUs
+                                                                    : sample.timestampUs;
+                            txQueue.push(data);
+                            stageStats[FUSION].dropped = txQueue.dropped();
+                        }
+
+                        if (sample.timestampUs - lastLogUs >= logIntervalUs) {
+                            lastLogUs = sample.timestampUs;
+                            logQueue.push(data);
+                            stageStats[LOGGING].dropped = logQueue.dropped();
+                            xTaskNotifyGive(loggingHandle);
+                        }
+                    }
+                    account(FUSION, start);
+                }
+            }
+        }
+
+        /**
+         * @brief Tarefa de transmissão
+         *
+         * @details A cada período retira da fila as amostras acumuladas
+         * e as entrega juntas a transmit(), que as empacota em um único
+         * quadro. As que não couberem ficam para o período seguinte, à
+         * frente das novas.
+         */
+        void transmissionTask(void *)
+        {
+            TickType_t lastWake = xTaskGetTickCount();
+            static SensorData batch[Config::Tasks::TX_QUEUE_DEPTH];
+            size_t pending = 0;
+
+            for (;;) {
+                vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(frameInterval()));
+
+                size_t count = pending;
+                while (count < Config::Tasks::TX_QUEUE_DEPTH && txQueue.pop(batch[count]))
+                    count++;
+                if (count == 0) continue;
+
+                uint32_t start = micros();
+                size_t sent = transmit(batch, count);
+                pending = count - sent;
+                memmove(batch, batch + sent, pending * sizeof(SensorData));
+                account(TRANSMISSION, start);
+            }
+        }
+
+        /// @brief Imprime as estatísticas de vazão de todos os estágios
+        void reportStats()
+        {
+            LOG_INFO("===== PIPELINE =====");
+            for (uint8_t i = 0; i < STAGE_COUNT; i++) {
+                const StageStats &s = stageStats[i];
+                uint32_t avg = s.processed ? s.totalMicros / s.processed : 0;
+                LOG_INFO("%-12s itens=%lu descartes=%lu medio=%luus max=%luus",
+                         stageName(static_cast<Stage>(i)),
+                         (unsigned long)s.processed, (unsigned long)s.dropped,
+                         (unsigned long)avg, (unsigned long)s.maxMicros);
+            }
+            if (jitterStats.intervals > 0) {
+                LOG_INFO("jitter       medio=%luus max=%luus perdidas=%lu",
+                         (unsigned long)(jitterStats.sumDeviationUs / jitterStats.intervals),
+                         (unsigned long)jitterStats.maxDeviationUs,
+                         (unsigned long)jitterStats.missed);
+            }
+            LOG_INFO("====================");
+        }
+
+        /**
+         * @brief Tarefa de registro
+         *
+         * @details Menor prioridade do sistema: imprime os pacotes no
+         * console e, periodicamente, as estatísticas do pipeline e do rádio.
+         */
+        void loggingTask(void *)
+        {
+            const TickType_t reportPeriod = pdMS_TO_TICKS(Config::Timing::STATS_REPORT_INTERVAL);
+            TickType_t lastReport = xTaskGetTickCount();
+            SensorData data;
+
+            for (;;) {
+                ulTaskNotifyTake(pdTRUE, reportPeriod);
+
+                while (logQueue.pop(data)) {
+                    uint32_t start = micros();
+                    log(data);
+                    account(LOGGING, start);
+                }
+
+                if (xTaskGetTickCount() - lastReport >= reportPeriod) {
+                    lastReport = xTaskGetTickCount();
+                    reportStats();
+                    report();
+                }
+            }
+        }
+    }
+
+    bool start()
+    {
+        using namespace Config::Tasks;
+
+        // Os consumidores são criados antes dos produtores para que os
+        // handles usados nas notificações já sejam válidos
+        bool ok = true;
+        ok &= xTaskCreatePinnedToCore(loggingTask, "logging", LOGGING_STACK, nullptr,
+                                      LOGGING_PRIORITY, &loggingHandle, COMM_CORE) == pdPASS;
+        ok &= xTaskCreatePinnedToCore(transmissionTask, "transmission", TRANSMISSION_STACK, nullptr,
+                                      TRANSMISSION_PRIORITY, nullptr, COMM_CORE) == pdPASS;
+        ok &= xTaskCreatePinnedToCore(fusionTask, "fusion", FUSION_STACK, nullptr,
+                                      FUSION_PRIORITY, &fusionHandle, SENSOR_CORE) == pdPASS;
+        if (!ok) return false;
+
+        return xTaskCreatePinnedToCore(acquisitionTask, "acquisition", ACQUISITION_STACK, nullptr,
+                                       ACQUISITION_PRIORITY, &acquisitionHandle, SENSOR_CORE) == pdPASS;
+    }
+
+    const StageStats &stats(Stage stage)
+    {
+        return stageStats[stage];
+    }
+
+    const JitterStats &jitter()
+    {
+        return jitterStats;
+    }
+
+    void trigger(uint32_t timestampUs)
+    {
+        if (acquisitionHandle == nullptr) return;
+        triggerQueue.push(timestampUs);
+        xTaskNotifyGive(acquisitionHandle);
+    }
+
+    void IRAM_ATTR triggerFromISR(uint32_t timestampUs)
+    {
+        if (acquisitionHandle == nullptr) return;
+        BaseType_t higherPriorityWoken = pdFALSE;
+        triggerQueue.push(timestampUs);
+        vTaskNotifyGiveFromISR(acquisitionHandle, &higherPriorityWoken);
+        if (higherPriorityWoken) portYIELD_FROM_ISR();
+    }
+
+    const char *stageName(Stage stage)
+    {
+        switch (stage) {
+            case ACQUISITION:  return "aquisicao";
+            case FUSION:       return "fusao";
+            case TRANSMISSION: return "transmissao";
+            case LOGGING:      return "registro";
+            default:           return "?";
+        }
+    }
+}
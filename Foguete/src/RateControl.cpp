@@ -0,0 +1,86 @@
+/**
+ * @file RateControl.cpp
+ * @brief Implementação do controle adaptativo da taxa de envio
+ * @version 1.0
+ * @date Outubro/2026
+ */
+
+#include "Config.h"
+#include "RateControl.h"
+
+static_assert(Config::RateControl::MIN_INTERVAL > Config::RateControl::DECREASE_STEP,
+              "O passo não pode levar o período abaixo de zero");
+
+RateController::RateController()
+{
+    apply(Config::Timing::TRANSMISSION_INTERVAL);
+}
+
+void RateController::queueFull()
+{
+    queueFull_ = true;
+}
+
+void RateController::update(uint32_t deliveredTotal, uint32_t failedTotal)
+{
+    using namespace Config::RateControl;
+
+    // A fila cheia é sinal de congestionamento local: recua sem esperar a janela
+    if (queueFull_) {
+        queueFull_ = false;
+        restartWindow(deliveredTotal, failedTotal);
+        apply(frameIntervalMs_ * QUEUE_FULL_BACKOFF_PCT / 100U);
+        return;
+    }
+
+    // Contadores recomeçados pela origem: a janela recomeça com eles
+    if (deliveredTotal < windowDelivered_ || failedTotal < windowFailed_) {
+        restartWindow(deliveredTotal, failedTotal);
+        return;
+    }
+
+    const uint32_t delivered = deliveredTotal - windowDelivered_;
+    const uint32_t total = delivered + (failedTotal - windowFailed_);
+    if (total < WINDOW) return;
+
+    const uint8_t pct = static_cast<uint8_t>(delivered * 100U / total);
+    deliveryPct_ = pct;
+    restartWindow(deliveredTotal, failedTotal);
+
+    if (pct < POOR_DELIVERY_PCT) {
+        apply(frameIntervalMs_ * LOSS_BACKOFF_PCT / 100U);
+    } else if (pct >= GOOD_DELIVERY_PCT) {
+        apply(frameIntervalMs_ - DECREASE_STEP);
+    }
+}
+
+RadioData RateController::state() const
+{
+    RadioData state;
+    state.frameIntervalMs = static_cast<uint16_t>(frameIntervalMs_);
+    state.batchSize = batchSize_;
+    state.deliveryPct = deliveryPct_;
+    return state;
+}
+
+void RateController::apply(uint32_t intervalMs)
+{
+    using namespace Config::RateControl;
+
+    if (intervalMs < MIN_INTERVAL) intervalMs = MIN_INTERVAL;
+    if (intervalMs > MAX_INTERVAL) intervalMs = MAX_INTERVAL;
+
+    uint32_t batch = intervalMs / Config::Timing::TELEMETRY_SAMPLE_INTERVAL;
+    if (batch > MAX_BATCH) batch = MAX_BATCH;
+    if (batch == 0) batch = 1;
+
+    frameIntervalMs_ = intervalMs;
+    batchSize_ = static_cast<uint8_t>(batch);
+    sampleIntervalUs_ = intervalMs * 1000UL / batch;
+}
+
+void RateController::restartWindow(uint32_t delivered, uint32_t failed)
+{
+    windowDelivered_ = delivered;
+    windowFailed_ = failed;
+}
@@ -0,0 +1,398 @@
+/**
+ * @file Recorder.cpp
+ * @brief Implementação do gravador de voo
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * O anel de pré-disparo e os buffers pertencem à fusão até a entrega.
+ * Os dois buffers são usados em alternância: a fusão preenche um e o
+ * entrega publicando o número de bytes em pending; a tarefa do gravador
+ * escreve o buffer e zera pending para devolvê-lo. Como a entrega e a
+ * devolução seguem sempre a mesma ordem, cada lado só precisa saber qual
+ * é o seu próximo buffer.
+ *
+ * O LittleFS é copy-on-write: reescrever o meio de um arquivo copia todo
+ * o restante dele, e cada bloco é apagado só quando alocado. Por isso o
+ * arquivo não é preenchido nem apagado antecipadamente; o espaço é
+ * reservado na abertura (limite calculado a partir do espaço livre) e o
+ * arquivo só cresce por acréscimo de blocos inteiros.
+ *
+ * A etapa é atômica porque, além da fusão, a tarefa do download a muda
+ * ao rearmar o gravador (delivered()); o arquivo novo é preparado antes
+ * de a etapa passar a ARMED.
+ */
+
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <math.h>
+#include <string.h>
+
+#include "Config.h"
+#include "FlightState.h"
+#include "Log.h"
+#include "Recorder.h"
+
+namespace Recorder
+{
+    namespace
+    {
+        constexpr size_t BUFFER_BYTES = Config::Recorder::BUFFER_BYTES;
+        static_assert(BUFFER_BYTES % Config::Recorder::BLOCK_BYTES == 0,
+                      "O buffer deve ter um número inteiro de blocos da flash");
+        static_assert(BUFFER_BYTES % RECORD_BYTES == 0, "O buffer deve ter um número inteiro de registros");
+
+        constexpr size_t RING_RECORDS = Config::Recorder::PRETRIGGER_RECORDS;
+
+        /**
+         * @brief Buffer de gravação
+         */
+        struct Buffer {
+            uint8_t data[BUFFER_BYTES];
+
+            /// @brief Bytes entregues à tarefa do gravador; 0 = livre para a fusão
+            std::atomic<uint32_t> pending;
+
+            /// @brief Sincronizar o arquivo depois de escrever este buffer
+            bool sync;
+
+            /// @brief Último buffer do voo: fechar o arquivo depois dele
+            bool last;
+        };
+
+        Buffer buffers[2];
+
+        /// @brief Arquivo do voo; usado apenas pela tarefa do gravador depois de start()
+        File file;
+        char name[32] = "";
+        TaskHandle_t writerHandle = nullptr;
+
+        Stats recorderStats = {};
+        std::atomic<State> current{OFF};
+
+        /// @name Estado da fusão
+        /// @{
+        FlightRecord ring[RING_RECORDS];
+        size_t ringFirst = 0;        ///< Amostra mais antiga do anel
+        size_t ringCount = 0;
+        RecorderHeader header = {};
+        size_t active = 0;           ///< Buffer sendo preenchido
+        size_t fill = 0;             ///< Bytes no buffer ativo
+        size_t capacity = 0;         ///< Bytes restantes no arquivo, incluindo o buffer ativo
+        uint8_t lastPhase = 0;
+        uint32_t lastRecordedUs = 0; ///< Carimbo da última amostra gravada
+        bool syncPending = false;    ///< Mudança de fase ainda não entregue
+        bool finishing = false;      ///< Falta entregar o último buffer
+        /// @}
+
+        /**
+         * @brief Entrega o buffer ativo à tarefa do gravador
+         * @retval false O outro buffer ainda está sendo escrito
+         */
+        bool handOff()
+        {
+            Buffer &next = buffers[active ^ 1U];
+            if (next.pending.load(std::memory_order_acquire) != 0) return false;
+
+            Buffer &filled = buffers[active];
+            filled.sync = syncPending || finishing;
+            filled.last = finishing;
+            filled.pending.store(static_cast<uint32_t>(fill), std::memory_order_release);
+            xTaskNotifyGive(writerHandle);
+
+            active ^= 1U;
+            fill = 0;
+            syncPending = false;
+            if (finishing) current = DONE;
+            return true;
+        }
+
+        /// @brief Acrescenta @p size bytes ao buffer ativo (cabem sempre)
+        void append(const void *bytes, size_t size)
+        {
+            memcpy(buffers[active].data + fill, bytes, size);
+            fill += size;
+            capacity -= size;
+        }
+
+        /**
+         * @brief Coloca uma amostra no anel
+         *
+         * @details Armado, o anel cheio esquece a amostra mais antiga;
+         * gravando, descarta a nova, pois as antigas ainda vão para a flash.
+         */
+        void push(const FlightRecord &entry)
+        {
+            if (ringCount == RING_RECORDS) {
+                if (current == RECORDING) {
+                    recorderStats.dropped = recorderStats.dropped + 1;
+                    return;
+                }
+                ringFirst = (ringFirst + 1U) % RING_RECORDS;
+                ringCount--;
+            }
+            ring[(ringFirst + ringCount) % RING_RECORDS] = entry;
+            ringCount++;
+        }
+
+        /**
+         * @brief Move amostras do anel para os buffers e entrega os prontos
+         *
+         * @details Move no máximo Config::Recorder::PUMP_RECORDS por
+         * chamada, para limitar o tempo tomado da fusão enquanto o anel
+         * esvazia. As mudanças de fase são vistas aqui, na ordem do
+         * arquivo, para que a sincronização venha logo depois delas.
+         */
+        void pump()
+        {
+            size_t moved = 0;
+            while (current == RECORDING) {
+                // Buffer cheio, mudança de fase ou fim: entrega antes de continuar
+                if (fill == BUFFER_BYTES || syncPending || finishing) {
+                    if (!handOff()) return;
+                    continue;
+                }
+                if (ringCount == 0 || moved == Config::Recorder::PUMP_RECORDS) return;
+
+                const FlightRecord &entry = ring[ringFirst];
+                if (recorderStats.recorded > 0) {
+                    const uint32_t gap = entry.timestampUs - lastRecordedUs;
+                    if (gap > Config::Recorder::GAP_US) recorderStats.gaps = recorderStats.gaps + 1;
+                    if (gap > recorderStats.maxGapUs) recorderStats.maxGapUs = gap;
+                }
+                lastRecordedUs = entry.timestampUs;
+                append(&entry, sizeof(entry));
+                ringFirst = (ringFirst + 1U) % RING_RECORDS;
+                ringCount--;
+                moved++;
+                recorderStats.recorded = recorderStats.recorded + 1;
+
+                if (entry.phase != lastPhase) {
+                    lastPhase = entry.phase;
+                    syncPending = true;
+                }
+                if (capacity == 0 || entry.phase == static_cast<uint8_t>(FlightPhase::LANDED))
+                    finishing = true;
+            }
+        }
+
+        /// @brief Sai da rampa: o arquivo começa pela amostra mais antiga do anel
+        void trigger(uint32_t timestampUs)
+        {
+            header.startUs = ring[ringFirst].timestampUs;
+            header.triggerUs = timestampUs;
+            append(&header, sizeof(header));
+            current = RECORDING;
+            LOG_INFO("Gravador: disparo com %lu ms de pre-disparo",
+                     (unsigned long)((timestampUs - header.startUs) / 1000U));
+        }
+
+        /// @brief Converte graus em centésimos de grau, saturando em int16_t
+        int16_t centiDegrees(float degrees)
+        {
+            const float value = roundf(degrees * 100.0f);
+            if (value > INT16_MAX) return INT16_MAX;
+            if (value < INT16_MIN) return INT16_MIN;
+            return static_cast<int16_t>(value);
+        }
+
+        /**
+         * @brief Tarefa do gravador
+         *
+         * @details Dorme até receber um buffer; o tempo de escrita inclui
+         * os apagamentos de setor que o LittleFS fizer.
+         */
+        void writerTask(void *)
+        {
+            size_t next = 0;
+
+            for (;;) {
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+                for (;;) {
+                    Buffer &buffer = buffers[next];
+                    const uint32_t length = buffer.pending.load(std::memory_order_acquire);
+                    if (length == 0) break;
+
+                    const uint32_t start = micros();
+                    const size_t written = file.write(buffer.data, length);
+                    if (written != length) recorderStats.writeErrors = recorderStats.writeErrors + 1;
+                    recorderStats.bytesWritten = recorderStats.bytesWritten + written;
+
+                    if (buffer.sync) {
+                        file.flush();
+                        recorderStats.syncs = recorderStats.syncs + 1;
+                    }
+                    if (buffer.last) {
+                        file.close();
+                        LOG_INFO("Gravador: %s fechado com %lu bytes", name,
+                                 (unsigned long)recorderStats.bytesWritten);
+                    }
+
+                    const uint32_t elapsed = micros() - start;
+                    if (elapsed > recorderStats.maxWriteUs) recorderStats.maxWriteUs = elapsed;
+
+                    buffer.pending.store(0, std::memory_order_release);
+                    next ^= 1U;
+                }
+            }
+        }
+
+        /// @brief Escolhe o primeiro nome de arquivo ainda não usado
+        bool chooseName()
+        {
+            for (unsigned long index = 1; index < 1000000UL; index++) {
+                snprintf(name, sizeof(name), "%s%06lu.bin", Config::Recorder::FILE_PREFIX, index);
+                if (!LittleFS.exists(name)) return true;
+            }
+            name[0] = '\0';
+            return false;
+        }
+
+        /**
+         * @brief Apaga os arquivos de voo vazios
+         *
+         * @details Sobram de boots que não saíram da rampa. Um por vez,
+         * para não apagar durante a listagem do diretório.
+         */
+        void removeEmpty()
+        {
+            const size_t prefix = strlen(Config::Recorder::FILE_PREFIX);
+            for (;;) {
+                char path[sizeof(name)] = "";
+                File root = LittleFS.open("/");
+                if (!root || !root.isDirectory()) return;
+                for (File entry = root.openNextFile(); entry; entry = root.openNextFile()) {
+                    if (!entry.isDirectory() && entry.size() == 0 &&
+                        strncmp(entry.path(), Config::Recorder::FILE_PREFIX, prefix) == 0) {
+                        strncpy(path, entry.path(), sizeof(path) - 1);
+                        break;
+                    }
+                }
+                root.close();
+                if (path[0] == '\0' || !LittleFS.remove(path)) return;
+                recorderStats.removed = recorderStats.removed + 1;
+            }
+        }
+
+        /**
+         * @brief Cria o arquivo do voo e arma o gravador
+         * @retval false Sem espaço para Config::Recorder::MIN_FILE_BYTES; fica em FAILED
+         */
+        bool prepare()
+        {
+            // O LittleFS precisa de alguns blocos livres para metadados
+            const size_t total = LittleFS.totalBytes();
+            const size_t used = LittleFS.usedBytes();
+            const size_t margin = Config::Recorder::FREE_BLOCKS * Config::Recorder::BLOCK_BYTES;
+            size_t available = total > used + margin ? total - used - margin : 0;
+            if (available > Config::Recorder::MAX_FILE_BYTES) available = Config::Recorder::MAX_FILE_BYTES;
+            available -= available % BUFFER_BYTES;
+
+            if (available >= Config::Recorder::MIN_FILE_BYTES && chooseName()) {
+                file = LittleFS.open(name, FILE_WRITE);
+                if (file) {
+                    capacity = available;
+                    current = ARMED;
+                    return true;
+                }
+            }
+            name[0] = '\0';
+            current = FAILED;
+            return false;
+        }
+    }
+
+    bool start()
+    {
+        current = FAILED;
+        if (!LittleFS.begin(true)) return false;
+
+        if (xTaskCreatePinnedToCore(writerTask, "gravador", Config::Recorder::TASK_STACK, nullptr,
+                                    Config::Recorder::TASK_PRIORITY, &writerHandle,
+                                    Config::Recorder::TASK_CORE) != pdPASS) {
+            return false;
+        }
+
+        header.magic = RECORDER_MAGIC;
+        header.recordBytes = RECORD_BYTES;
+        header.sampleRate = Config::Sensors::IMU_SAMPLE_RATE;
+        header.accelLsbPerG = Config::Sensors::ACCEL_LSB_PER_G;
+        header.gyroLsbPerDps = Config::Sensors::GYRO_LSB_PER_DPS;
+
+        removeEmpty();
+        return prepare();
+    }
+
+    void delivered(const char *path)
+    {
+        if (current != FAILED || writerHandle == nullptr) return;
+        if (!LittleFS.remove(path)) return;
+        recorderStats.removed = recorderStats.removed + 1;
+
+        if (prepare()) {
+            LOG_INFO("Gravador: %s entregue e apagado, armado em %s", path, name);
+        } else {
+            LOG_WARN("Gravador: %s entregue e apagado, ainda sem espaco", path);
+        }
+    }
+
+    void record(const RawSample &sample, const SensorData &data)
+    {
+        const State now = current;
+        if (now != ARMED && now != RECORDING) return;
+
+        FlightRecord entry;
+        entry.timestampUs = sample.timestampUs;
+        memcpy(entry.acc, sample.imu.acc, sizeof(entry.acc));
+        memcpy(entry.gyro, sample.imu.gyro, sizeof(entry.gyro));
+        entry.temp = sample.imu.temp;
+        entry.pitch = centiDegrees(data.acelerometro.pitch);
+        entry.roll = centiDegrees(data.acelerometro.roll);
+        entry.phase = data.phase;
+        entry.flags = sample.baro.fresh ? RECORD_BARO_FRESH : 0;
+        entry.pressure = sample.baro.pressure;
+        entry.temperature = sample.baro.temperature;
+
+        push(entry);
+
+        if (current == ARMED && entry.phase != static_cast<uint8_t>(FlightPhase::PAD))
+            trigger(entry.timestampUs);
+        if (current == RECORDING) pump();
+    }
+
+    State state()
+    {
+        return current;
+    }
+
+    bool fault()
+    {
+        return current == FAILED || recorderStats.writeErrors != 0;
+    }
+
+    const char *stateName(State state)
+    {
+        switch (state) {
+            case OFF:       return "desligado";
+            case ARMED:     return "armado";
+            case RECORDING: return "gravando";
+            case DONE:      return "encerrado";
+            case FAILED:    return "falha";
+            default:        return "?";
+        }
+    }
+
+    const char *fileName()
+    {
+        return name;
+    }
+
+    const Stats &stats()
+    {
+        return recorderStats;
+    }
+}
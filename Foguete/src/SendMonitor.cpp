@@ -0,0 +1,70 @@
+/**
+ * @file SendMonitor.cpp
+ * @brief Implementação dos contadores e da latência dos envios ESP-NOW
+ * @version 1.0
+ * @date Outubro/2026
+ */
+
+#include "SendMonitor.h"
+
+namespace
+{
+    /// @brief Limite da primeira faixa; cada faixa seguinte dobra
+    constexpr uint32_t FIRST_BUCKET_US = 250U;
+
+    static_assert((SEND_IN_FLIGHT & (SEND_IN_FLIGHT - 1)) == 0, "SEND_IN_FLIGHT deve ser potencia de 2");
+}
+
+void SendMonitor::begin(uint32_t nowUs)
+{
+    sentUs_[queued_ & (SEND_IN_FLIGHT - 1)].store(nowUs, std::memory_order_relaxed);
+}
+
+void SendMonitor::commit()
+{
+    queued_++;
+    committed_.store(queued_, std::memory_order_relaxed);
+}
+
+void SendMonitor::completed(bool delivered, uint32_t nowUs)
+{
+    const uint32_t latency = nowUs - sentUs_[completions_ & (SEND_IN_FLIGHT - 1)].load(std::memory_order_relaxed);
+    completions_++;
+
+    size_t bucket = 0;
+    for (uint32_t limit = FIRST_BUCKET_US; bucket < SEND_LATENCY_BUCKETS - 1 && latency >= limit; limit <<= 1)
+        bucket++;
+
+    histogram_[bucket].fetch_add(1, std::memory_order_relaxed);
+    sumLatencyUs_.fetch_add(latency, std::memory_order_relaxed);
+    // Único escritor: ler e gravar o máximo não perde atualizações
+    if (latency > maxLatencyUs_.load(std::memory_order_relaxed))
+        maxLatencyUs_.store(latency, std::memory_order_relaxed);
+    lastCompletionUs_.store(nowUs, std::memory_order_relaxed);
+    (delivered ? delivered_ : failed_).fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t SendMonitor::inFlight() const
+{
+    // O callback pode contar um envio antes de commit(): nunca negativo
+    const uint32_t completed = delivered_.load(std::memory_order_relaxed) + failed_.load(std::memory_order_relaxed);
+    const int32_t pending = static_cast<int32_t>(committed_.load(std::memory_order_relaxed) - completed);
+    return pending > 0 ? static_cast<uint32_t>(pending) : 0;
+}
+
+void SendMonitor::snapshot(Snapshot &out) const
+{
+    out.queued = committed_.load(std::memory_order_relaxed);
+    out.delivered = delivered_.load(std::memory_order_relaxed);
+    out.failed = failed_.load(std::memory_order_relaxed);
+    out.lastCompletionUs = lastCompletionUs_.load(std::memory_order_relaxed);
+    out.maxLatencyUs = maxLatencyUs_.load(std::memory_order_relaxed);
+    out.sumLatencyUs = sumLatencyUs_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < SEND_LATENCY_BUCKETS; i++)
+        out.histogram[i] = histogram_[i].load(std::memory_order_relaxed);
+}
+
+uint32_t SendMonitor::bucketLimitUs(size_t bucket)
+{
+    return bucket < SEND_LATENCY_BUCKETS - 1 ? FIRST_BUCKET_US << bucket : UINT32_MAX;
+}
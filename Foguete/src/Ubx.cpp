@@ -0,0 +1,285 @@
+/**
+ * @file Ubx.cpp
+ * @brief Implementação do decodificador UBX
+ * @version 1.0
+ * @date Outubro/2026
+ */
+
+#include <cstring>
+
+#include "Ubx.h"
+
+namespace
+{
+    constexpr uint8_t SYNC_CHAR_1 = 0xB5;
+    constexpr uint8_t SYNC_CHAR_2 = 0x62;
+
+    /// @name Tamanhos das cargas úteis decodificadas
+    /// @{
+    /// NAV-PVT tem 84 bytes no u-blox 7 (protocolo 14) e 92 do M8 em
+    /// diante; os campos lidos ficam nos 84 comuns
+    constexpr uint16_t LEN_PVT_MIN = 84;
+    constexpr uint16_t LEN_POSLLH = 28;
+    constexpr uint16_t LEN_DOP = 18;
+    constexpr uint16_t LEN_SOL = 52;
+    constexpr uint16_t LEN_TIMEUTC = 20;
+    constexpr uint16_t LEN_ACK = 2;
+    /// @}
+
+    /// @name Leitura little-endian direto do quadro
+    /// @{
+    inline uint16_t u16(const uint8_t *p)
+    {
+        return static_cast<uint16_t>(p[0] | (p[1] << 8));
+    }
+
+    inline uint32_t u32(const uint8_t *p)
+    {
+        return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+               (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+    }
+
+    inline int32_t i32(const uint8_t *p)
+    {
+        return static_cast<int32_t>(u32(p));
+    }
+    /// @}
+
+    /// @brief Tipos de fix com posição: 2D, 3D e GNSS + navegação estimada
+    inline bool hasPosition(uint8_t fixType, uint8_t flags)
+    {
+        return (flags & 0x01) && fixType >= 2 && fixType <= 4;
+    }
+}
+
+void UbxParser::feed(const uint8_t *data, size_t len)
+{
+    size_t i = 0;
+    while (i < len) {
+        // Quadro inteiro dentro do bloco: valida e decodifica no lugar
+        if (state_ == SYNC1 && len - i >= FRAME_OVERHEAD &&
+            data[i] == SYNC_CHAR_1 && data[i + 1] == SYNC_CHAR_2) {
+            const uint16_t payloadLen = u16(data + i + 4);
+            const size_t total = payloadLen + FRAME_OVERHEAD;
+            if (len - i >= total) {
+                uint8_t a, b;
+                checksum(data + i + 2, payloadLen + 4u, a, b);
+                if (a == data[i + 6 + payloadLen] && b == data[i + 7 + payloadLen]) {
+                    frames_++;
+                    dispatch(data[i + 2], data[i + 3], data + i + 6, payloadLen);
+                    i += total;
+                } else {
+                    errors_++;
+                    i++;  // Ressincroniza a partir do byte seguinte
+                }
+                continue;
+            }
+        }
+        step(data[i++]);
+    }
+}
+
+void UbxParser::step(uint8_t byte)
+{
+    switch (state_) {
+        case SYNC1:
+            if (byte == SYNC_CHAR_1) state_ = SYNC2;
+            return;
+
+        case SYNC2:
+            if (byte == SYNC_CHAR_2) {
+                state_ = CLASS;
+                ckA_ = ckB_ = 0;
+            } else if (byte != SYNC_CHAR_1) {
+                state_ = SYNC1;
+            }
+            return;
+
+        case CLASS:
+        case ID:
+        case LENGTH1:
+        case LENGTH2:
+            header_[state_ - CLASS] = byte;
+            ckA_ += byte;
+            ckB_ += ckA_;
+            if (state_ == LENGTH2) {
+                length_ = u16(header_ + 2);
+                index_ = 0;
+                if (length_ > MAX_PAYLOAD) {
+                    errors_++;  // Não cabe no buffer; nenhuma mensagem útil é tão longa
+                    state_ = SYNC1;
+                    return;
+                }
+                state_ = length_ > 0 ? PAYLOAD : CK_A;
+            } else {
+                state_ = static_cast<State>(state_ + 1);
+            }
+            return;
+
+        case PAYLOAD:
+            buffer_[index_++] = byte;
+            ckA_ += byte;
+            ckB_ += ckA_;
+            if (index_ >= length_) state_ = CK_A;
+            return;
+
+        case CK_A:
+            if (byte == ckA_) {
+                state_ = CK_B;
+            } else {
+                errors_++;
+                state_ = SYNC1;
+            }
+            return;
+
+        case CK_B:
+            state_ = SYNC1;
+            if (byte != ckB_) {
+                errors_++;
+                return;
+            }
+            frames_++;
+            dispatch(header_[0], header_[1], buffer_, length_);
+            return;
+    }
+}
+
+void UbxParser::dispatch(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t len)
+{
+    if (msgClass == CLASS_NAV) {
+        switch (msgId) {
+            case NAV_PVT:
+                if (len >= LEN_PVT_MIN) decodePvt(payload);
+                break;
+            case NAV_POSLLH:
+                if (len == LEN_POSLLH) decodePosllh(payload);
+                break;
+            case NAV_SOL:
+                if (len == LEN_SOL) decodeSol(payload);
+                break;
+            case NAV_TIMEUTC:
+                if (len == LEN_TIMEUTC) decodeTimeUtc(payload);
+                break;
+            case NAV_DOP:
+                if (len == LEN_DOP) hdop_ = static_cast<float>(u16(payload + 12)) * 0.01f;
+                break;
+            default:
+                break;
+        }
+    } else if (msgClass == CLASS_ACK && len == LEN_ACK) {
+        ack_.msgClass = payload[0];
+        ack_.msgId = payload[1];
+        ack_.accepted = msgId == ACK_ACK;
+        ackReady_ = true;
+    }
+}
+
+void UbxParser::decodePvt(const uint8_t *p)
+{
+    if (!hasPosition(p[20], p[21])) return;
+
+    fix_.year = u16(p + 4);
+    fix_.month = p[6];
+    fix_.day = p[7];
+    fix_.hour = p[8];
+    fix_.minute = p[9];
+    fix_.second = p[10];
+    fix_.longitude = i32(p + 24) * 1e-7;
+    fix_.latitude = i32(p + 28) * 1e-7;
+    fix_.altitude = i32(p + 36) * 1e-3;  // hMSL, mm
+    fix_.satellites = p[23];
+    fix_.hdop = hdop_;
+    fix_.fixAge = 0;
+    fixReady_ = true;
+}
+
+void UbxParser::decodePosllh(const uint8_t *p)
+{
+    enterEpoch(u32(p));
+    pending_.longitude = i32(p + 4) * 1e-7;
+    pending_.latitude = i32(p + 8) * 1e-7;
+    pending_.altitude = i32(p + 16) * 1e-3;  // hMSL, mm
+    completePart(PART_POSLLH);
+}
+
+void UbxParser::decodeSol(const uint8_t *p)
+{
+    enterEpoch(u32(p));
+    epochFixOk_ = hasPosition(p[10], p[11]);
+    pending_.satellites = p[47];
+    completePart(PART_SOL);
+}
+
+void UbxParser::decodeTimeUtc(const uint8_t *p)
+{
+    enterEpoch(u32(p));
+    pending_.year = u16(p + 12);
+    pending_.month = p[14];
+    pending_.day = p[15];
+    pending_.hour = p[16];
+    pending_.minute = p[17];
+    pending_.second = p[18];
+    completePart(PART_TIMEUTC);
+}
+
+void UbxParser::enterEpoch(uint32_t iTow)
+{
+    if (iTow == epochTow_) return;
+    epochTow_ = iTow;
+    epochParts_ = 0;
+    epochFixOk_ = false;
+}
+
+void UbxParser::completePart(uint8_t part)
+{
+    epochParts_ |= part;
+    if (epochParts_ != PART_ALL) return;
+
+    epochParts_ = 0;
+    if (!epochFixOk_) return;
+    fix_ = pending_;
+    fix_.hdop = hdop_;
+    fix_.fixAge = 0;
+    fixReady_ = true;
+}
+
+bool UbxParser::takeFix(GPSData &out)
+{
+    if (!fixReady_) return false;
+    fixReady_ = false;
+    out = fix_;
+    return true;
+}
+
+bool UbxParser::takeAck(Ack &out)
+{
+    if (!ackReady_) return false;
+    ackReady_ = false;
+    out = ack_;
+    return true;
+}
+
+size_t UbxParser::frame(uint8_t msgClass, uint8_t msgId, const uint8_t *payload,
+                        uint16_t len, uint8_t *out)
+{
+    out[0] = SYNC_CHAR_1;
+    out[1] = SYNC_CHAR_2;
+    out[2] = msgClass;
+    out[3] = msgId;
+    out[4] = static_cast<uint8_t>(len & 0xFF);
+    out[5] = static_cast<uint8_t>(len >> 8);
+    if (len > 0) memcpy(out + 6, payload, len);
+    checksum(out + 2, len + 4u, out[6 + len], out[7 + len]);
+    return len + FRAME_OVERHEAD;
+}
+
+void UbxParser::checksum(const uint8_t *data, size_t len, uint8_t &ckA, uint8_t &ckB)
+{
+    uint8_t a = 0, b = 0;
+    for (size_t i = 0; i < len; i++) {
+        a += data[i];
+        b += a;
+    }
+    ckA = a;
+    ckB = b;
+}
@@ -11,72 +11,71 @@
  * 
  * @note Projeto Integrador 1 - Engenharia
  */
- #include <Adafruit_MPU6050.h>
- #include <Adafruit_Sensor.h>
  #include <Wire.h>
  #include <esp_now.h>
  #include <WiFi.h>
  #include <esp_wifi.h>
- #include <Adafruit_BMP280.h>
- #include <TinyGPS++.h>
+ #include <esp_timer.h>
+ #include <freertos/semphr.h>
 
  #include <Config.h>
  #include <Structs.h>
+ #include <Pipeline.h>
+ #include <Mpu6050.h>
+ #include <Bmp280.h>
+ #include <Fusion.h>
+ #include <Gps.h>
+ #include <Battery.h>
+ #include <FlightState.h>
+ #include <Telemetry.h>
+ #include <Fec.h>
+ #include <RateControl.h>
+ #include <SendMonitor.h>
+ #include <Recorder.h>
+ #include <BaseLink.h>
+ #include <Download.h>
+ #include <Log.h>
+ #include <SpscQueue.h>
  
- // Constantes de configuração
- /** @brief Intervalo de leitura dos sensores (ms) */
- const unsigned long SENSOR_READ_INTERVAL = 100;   // 10 Hz
- 
- /** @brief Intervalo de transmissão de dados (ms) */
- const unsigned long TRANSMISSION_INTERVAL = 500;  // 2 Hz
- 
- /** @brief Coeficiente do filtro complementar para fusão sensorial */
- const float COMPLEMENTARY_FILTER_ALPHA = 0.98;
 
+ // Declaração de objetos globais
+ /** @brief Objeto para comunicação com o sensor MPU6050 */
+ Mpu6050 mpu(Wire);
 
-const float VREF = 3.3;  // Tensão de referência do ADC (ESP32 usa 3.3V)
+ /** @brief Timer periódico que dispara a aquisição no modo TIMER */
+ esp_timer_handle_t sampleTimer = nullptr;
+ 
+ /** @brief Objeto para comunicação com o sensor BMP280 */
+ Bmp280 bmp(Wire);
+ 
+ /** @brief Último pacote de telemetria produzido pela fusão */
+ SensorData sensorData = {};
 
-/** 
- * @brief Timestamp da última leitura de sensor
- * @details Utilizado para controlar a taxa de amostragem dos sensores
- * @see SENSOR_READ_INTERVAL
- */
-unsigned long lastSensorReadTime = 0;
+ /** @brief Transições de fase de voo: fusão -> registro */
+ SpscQueue<FlightEvent, Config::Flight::EVENT_QUEUE_DEPTH> flightEvents;
 
-/** 
- * @brief Timestamp da última transmissão de dados
- * @details Controla a frequência de envio dos pacotes de telemetria
- * @see TRANSMISSION_INTERVAL
- */
-unsigned long lastTransmissionTime = 0;
+ static_assert(Config::Sensors::SEA_LEVEL_PRESSURE == Telemetry::SEA_LEVEL_PRESSURE,
+               "A Base recalcula a altitude com Telemetry::SEA_LEVEL_PRESSURE");
+ static_assert(Config::RateControl::MAX_BATCH <= Telemetry::MAX_FRAME_SAMPLES,
+               "As amostras de um período de transmissão devem caber em um quadro");
+ static_assert(Config::RateControl::MAX_BATCH * 2U <= Config::Tasks::TX_QUEUE_DEPTH,
+               "A fila de transmissão deve guardar um período mais as sobras do anterior");
+ static_assert(Config::RateControl::MAX_INTERVAL <= 255U * Telemetry::RADIO_INTERVAL_SCALE,
+               "O período deve caber em StreamHeader::frameInterval");
+ static_assert(2U * ((Config::EspNow::FEC_GROUP ? 2U : 1U) + Config::Download::MAX_IN_FLIGHT) <= SEND_IN_FLIGHT,
+               "O monitor de envios deve acompanhar dois períodos de telemetria e transferência");
 
-/** 
- * @brief Ângulos de inclinação calculados
- * 
- * @details Armazena os ângulos de pitch e roll obtidos 
- * através do filtro complementar
- * 
- * @var pitch Ângulo de arfagem (rotação no eixo Y)
- * @var roll Ângulo de rolamento (rotação no eixo X)
- * 
- * @note Valores em graus
- * @see updateSensorData()
- */
-float pitch = 0.0, roll = 0.0;
+ /** @brief Ajusta o período de transmissão à entrega medida pela Base */
+ RateController rateController;
 
+ /** @brief Relatórios de enlace e pedidos da Base (callback do WiFi -> transmissão e download) */
+ BaseLink baseLink;
 
- // Declaração de objetos globais
- /** @brief Objeto para comunicação com o sensor MPU6050 */
- Adafruit_MPU6050 mpu;
- 
- /** @brief Objeto para comunicação com o sensor BMP280 */
- Adafruit_BMP280 bmp;
- 
- /** @brief Objeto para comunicação com o GPS NEO06MV2 */
- TinyGPSPlus gps;
+ /** @brief Contadores e latência dos envios (callback do WiFi -> transmissão e registro) */
+ SendMonitor sendMonitor;
 
- /** @brief Estrutura global para armazenamento de dados de telemetria */
- SensorData sensorData = {};
+ /** @brief Serializa sendFrame() entre a transmissão e a transferência do arquivo de voo */
+ SemaphoreHandle_t sendLock = nullptr;
 
  /** 
  * @brief Declarações de Funções do Sistema de Telemetria
@@ -98,41 +97,6 @@ float pitch = 0.0, roll = 0.0;
  */
 void setupSensors();
 
-/**
- * @brief Atualiza os dados dos sensores
- * 
- * @details Realiza leitura dos sensores, aplica filtros 
- * e preenche a estrutura de dados de telemetria
- * 
- * @note Limita a taxa de amostragem para evitar sobrecarga
- * @see SENSOR_READ_INTERVAL
- * @see SensorData
- */
-void updateSensorData();
-
-/**
- * @brief Transmite dados de telemetria
- * 
- * @details Envia pacote de dados via protocolo ESP-NOW
- * para o endereço de broadcast
- * 
- * @note Limita a taxa de transmissão
- * @see TRANSMISSION_INTERVAL
- * @see Config::EspNow::broadcastAddress
- */
-void transmitData();
-
-/**
- * @brief Imprime dados de telemetria para depuração
- * 
- * @details Exibe informações detalhadas dos sensores 
- * no console serial
- * 
- * @note Útil para desenvolvimento e testes
- * @note Não afeta o funcionamento do sistema
- */
-void debugPrintData();
-
 /**
  * @brief Trata erros de comunicação ESP-NOW
  * 
@@ -146,35 +110,46 @@ void debugPrintData();
  */
 void handleCommunicationErrors(esp_err_t result);
 
+/**
+ * @brief Envia um quadro ao receptor, registrando-o no sendMonitor
+ * 
+ * @param data Quadro a enviar
+ * @param len Tamanho do quadro
+ * @return Código retornado por esp_now_send()
+ * @note Chamada pela transmissão e pela transferência do arquivo de
+ * voo; os erros são tratados por quem chama
+ */
+esp_err_t sendFrame(const uint8_t *data, size_t len);
+
  /**
   * @brief Callback para status de envio de dados via ESP-NOW
   * 
   * @param mac_addr Endereço MAC do dispositivo de destino
   * @param status Status do envio (sucesso ou falha)
   * 
-  * @note Função chamada após cada tentativa de transmissão
+  * @note Roda na tarefa do WiFi após cada envio: só atualiza contadores
+  * atômicos, sem impressão. O relatório sai em Pipeline::report().
   */
  void onDataSent(const uint8_t *mac_addr, esp_now_send_status_t status) {
-     char macStr[18];
-     snprintf(macStr, sizeof(macStr), "%02X:%02X:%02X:%02X:%02X:%02X",
-              mac_addr[0], mac_addr[1], mac_addr[2], 
-              mac_addr[3], mac_addr[4], mac_addr[5]);
-     
-     Serial.printf("Transmissao para %s: %s\n", 
-                   macStr, 
-                   status == ESP_NOW_SEND_SUCCESS ? "SUCESSO" : "FALHA");
+     sendMonitor.completed(status == ESP_NOW_SEND_SUCCESS,
+                           static_cast<uint32_t>(esp_timer_get_time()));
+     Download::wake();
  }
- /**
- * @brief Gera nome de arquivo de log único
- * @return String com nome do arquivo de log
- */
-String generateLogFilename() {
-  unsigned long timestamp = millis() / 1000;
-  char buffer[32];
-  snprintf(buffer, sizeof(buffer), "/flight_log_%06lu.csv", timestamp);
-  return String(buffer);
-}
 
+ /**
+  * @brief Callback para recebimento de dados via ESP-NOW
+  * 
+  * @param mac_addr Endereço MAC do remetente
+  * @param data Mensagem recebida
+  * @param len Tamanho da mensagem
+  * 
+  * @note A Base fala com o foguete para devolver a contagem do enlace,
+  * que vai para a transmissão, e para pedir o arquivo de voo, que vai
+  * para a fila da transferência
+  */
+ void onDataRecv(const uint8_t *mac_addr, const uint8_t *data, int len) {
+     if (baseLink.receive(mac_addr, data, len) == BaseLink::TRANSFER) Download::notify();
+ }
 
  /**
   * @brief Configura a comunicação ESP-NOW
@@ -194,6 +169,7 @@ String generateLogFilename() {
     }
 
     esp_now_register_send_cb(onDataSent);
+    esp_now_register_recv_cb(onDataRecv);
 
     // Configuração de peer
     esp_now_peer_info_t peerInfo = {};
@@ -202,13 +178,14 @@ String generateLogFilename() {
     peerInfo.encrypt = false;
 
     if (esp_now_add_peer(&peerInfo) != ESP_OK) {
-        Serial.println("Falha ao adicionar peer");
+        LOG_ERROR("Falha ao adicionar peer");
     }
 }
  /**
   * @brief Tenta inicializar o sensor BMP280 nos dois endereços possíveis
   * 
-  * @details Configura BMP280 para os endereços 0x76 e 0x77
+  * @details Configura BMP280 para os endereços 0x76 e 0x77, com a
+  * taxa de saída ajustada ao período de leitura dos sensores lentos
   * 
   * @retval true Se o sensor for inicializado com sucesso
   * @retval false Se o sensor falhar na inicialização
@@ -217,10 +194,10 @@ String generateLogFilename() {
   */
 bool initBMP280() {
     // Tenta endereço padrão 0x76
-    if (bmp.begin(0x76)) return true;
+    if (bmp.begin(0x76, Config::Timing::SENSOR_READ_INTERVAL)) return true;
     
     // Tenta endereço alternativo 0x77
-    if (bmp.begin(0x77)) return true;
+    if (bmp.begin(0x77, Config::Timing::SENSOR_READ_INTERVAL)) return true;
     
     return false;
 }
@@ -240,109 +217,182 @@ bool initBMP280() {
         Serial.println("Falha na conexao com MPU6050");
         while(1) delay(10);
     }
-    mpu.setAccelerometerRange(MPU6050_RANGE_8_G);
-    mpu.setGyroRange(MPU6050_RANGE_500_DEG);
-    mpu.setFilterBandwidth(MPU6050_BAND_21_HZ);
-    analogReadResolution(12); // Resolução de 12 bits para ADC
+
+    using Config::Sensors::ImuMode;
+    bool imuOk = true;
+    switch (Config::Sensors::IMU_MODE) {
+        case ImuMode::FIFO:
+            imuOk = mpu.beginFifo(Config::Sensors::IMU_SAMPLE_RATE);
+            break;
+        case ImuMode::DATA_READY:
+        case ImuMode::TIMER:
+            imuOk = mpu.beginDataReady(Config::Sensors::IMU_SAMPLE_RATE);
+            break;
+        default:
+            break;
+    }
+    if (!imuOk) {
+        Serial.println("Falha ao configurar modo de aquisicao do MPU6050");
+        while(1) delay(10);
+    }
+    // Tensão da bateria: ADC contínuo por DMA; não é crítico para o voo
+    if (!Battery::start()) {
+        Serial.println("Falha ao iniciar o ADC continuo");
+    }
     // Inicialização do BMP280
     if (!initBMP280()) {
         Serial.println("Falha na conexao com BMP280");
         while(1) delay(10);
     }
-
-    // Configurações padrão do BMP280
-    bmp.setSampling(Adafruit_BMP280::MODE_NORMAL,     // Modo de operação
-                    Adafruit_BMP280::SAMPLING_X2,     // Oversampling de temperatura 
-                    Adafruit_BMP280::SAMPLING_X16,    // Oversampling de pressão
-                    Adafruit_BMP280::FILTER_X16,      // Filtro
-                    Adafruit_BMP280::STANDBY_MS_500); // Tempo de espera
+    Serial.printf("BMP280: periodo de saida %lu us\n", (unsigned long)bmp.outputPeriodUs());
 }
  
  /**
-  * @brief Atualiza os dados dos sensores
+  * @brief Lê os sensores lentos (BMP280)
   * 
-  * @details Realiza leitura dos sensores, aplica filtro complementar 
-  * e preenche a estrutura de dados de telemetria
+  * @details Limitada a Config::Timing::SENSOR_READ_INTERVAL; entre
+  * leituras as amostras do IMU reutilizam os últimos valores, com 
+  * baro.fresh falso para que os estágios seguintes ignorem repetições.
+  * Uma leitura nova continua marcada como fresh até seguir em alguma
+  * amostra, mesmo que o ciclo em que foi lida não produza nenhuma.
   * 
-  * @note Limita a taxa de amostragem para evitar sobrecarga
+  * @param consume Entrega a leitura nova: as próximas chamadas a repetem
+  * com baro.fresh falso
+  * @return Leitura mais recente do BMP280
   */
- void updateSensorData() {
-    unsigned long currentTime = millis();
+ BaroSample readSlowSensors(bool consume) {
+    static uint32_t lastReadTime = 0;
+    static BaroSample baro = {};
 
-    int leituraADC = analogRead(Config::Hardware::ADC_PIN);
-    float tensaoPino = (leituraADC / 4095.0) * VREF;
-    float tensaoReal = tensaoPino * Config::Hardware::ADC_MULTIPLIER;
-    sensorData.tensao.voltage_rocket = tensaoReal;
-
-    // Limita a taxa de leitura
-    if (currentTime - lastSensorReadTime < SENSOR_READ_INTERVAL) return;
-    
-    lastSensorReadTime = currentTime;
+    uint32_t currentTime = millis();
+    if (lastReadTime == 0 || currentTime - lastReadTime >= Config::Timing::SENSOR_READ_INTERVAL) {
+        lastReadTime = currentTime;
 
-    // Leitura do MPU6050
-    sensors_event_t a, g, temp;
-    mpu.getEvent(&a, &g, &temp);
+        // Leitura do BMP280: uma rajada, compensação única
+        BaroSample reading;
+        if (bmp.read(reading) && reading.fresh) baro = reading;
+    }
 
-    // Cálculo de ângulos com filtro complementar
-    float accPitch = atan2(a.acceleration.y, sqrt(pow(a.acceleration.x, 2) + pow(a.acceleration.z, 2))) * 180.0 / PI;
-    float accRoll = atan2(-a.acceleration.x, a.acceleration.z) * 180.0 / PI;
+    const BaroSample current = baro;
+    if (consume) baro.fresh = false;
+    return current;
+}
 
-    static unsigned long lastUpdateTime = 0;
-    if (lastUpdateTime == 0) {
-        lastUpdateTime = currentTime;
-        return; // Ignora primeira leitura
+ /**
+  * @brief Estágio de aquisição: lê todos os sensores
+  * 
+  * @details Executado pela tarefa de aquisição. No modo FIFO esvazia o 
+  * FIFO do MPU6050 e devolve todas as amostras acumuladas; nos demais 
+  * modos faz uma única rajada de 14 bytes. As leituras ficam em 
+  * contagens inteiras; a conversão para SI é feita na fusão.
+  * 
+  * @param samples Vetor de amostras brutas a ser preenchido
+  * @param max Capacidade de @p samples
+  * @param timestampUs Instante do disparo (âncora do lote no modo FIFO)
+  * @return Número de amostras produzidas
+  */
+ size_t Pipeline::acquire(RawSample *samples, size_t max, uint32_t timestampUs) {
+    using Config::Sensors::ImuMode;
+
+    if (Config::Sensors::IMU_MODE == ImuMode::FIFO) {
+        static ImuSample imuBatch[Config::Tasks::ACQUISITION_BATCH];
+        size_t count = mpu.drainFifo(imuBatch, min(max, Config::Tasks::ACQUISITION_BATCH), timestampUs);
+
+        // A leitura nova do barômetro segue só na primeira amostra do lote;
+        // num lote vazio ela fica para o próximo
+        const BaroSample baro = readSlowSensors(count > 0);
+        for (size_t i = 0; i < count; i++) {
+            samples[i].baro = baro;
+            samples[i].baro.fresh = baro.fresh && i == 0;
+            samples[i].imu = imuBatch[i];
+            samples[i].timestampUs = imuBatch[i].timestampUs;
+        }
+        return count;
     }
-    float dt = (currentTime - lastUpdateTime) / 1000.0;
-    lastUpdateTime = currentTime;
 
-    pitch = COMPLEMENTARY_FILTER_ALPHA * (pitch + g.gyro.x * dt * RAD_TO_DEG) + 
-            (1 - COMPLEMENTARY_FILTER_ALPHA) * accPitch;
-    roll = COMPLEMENTARY_FILTER_ALPHA * (roll + g.gyro.y * dt * RAD_TO_DEG) + 
-           (1 - COMPLEMENTARY_FILTER_ALPHA) * accRoll;
+    if (max == 0) return 0;
+    RawSample &sample = samples[0];
+    const bool ok = mpu.readSample(sample.imu);
+    sample.baro = readSlowSensors(ok);
+    sample.timestampUs = timestampUs;
+    return ok ? 1 : 0;
+}
+
+ /**
+  * @brief Estágio de fusão: estima a orientação na taxa do IMU
+  * 
+  * @details Delega a conversão para SI e o filtro de Mahony a 
+  * Fusion::update() e monta o pacote de telemetria; pitch e roll
+  * são derivados do quatérnio. Toda amostra vai para o gravador de voo
+  * 
+  * @param sample Amostra bruta vinda da aquisição
+  * @param out Pacote de telemetria resultante
+  * @retval false Na primeira amostra, usada apenas como referência de dt
+  */
+ bool Pipeline::fuse(const RawSample &sample, SensorData &out) {
+    FusedSample fused;
+    if (!Fusion::update(sample, fused)) return false;
+
+    if (fused.hasEvent) flightEvents.push(fused.event);
 
     // Preenchimento da estrutura de dados
+    const ImuReading &imu = fused.imu;
     sensorData.acelerometro = {
-        a.acceleration.x, a.acceleration.y, a.acceleration.z,
-        g.gyro.x, g.gyro.y, g.gyro.z,
-        temp.temperature,
-        pitch, roll
+        imu.acc[0], imu.acc[1], imu.acc[2],
+        imu.gyro[0], imu.gyro[1], imu.gyro[2],
+        imu.temp,
+        fused.pitch, fused.roll
     };
 
-    // Leitura do BMP280
-    sensorData.altimetro = {
-        bmp.readPressure() / 100.0f,  // Pressão em hPa
-        bmp.readAltitude(1013.25)     // Altitude baseada na pressão ao nível do mar
-    };
+    // Amostras sem conversão nova do barômetro repetem o valor anterior
+    if (fused.baroFresh) {
+        sensorData.altimetro = {
+            fused.pressure,
+            fused.altitude
+        };
+    }
 
-    sensorData.timestamp = currentTime;
-
-    sensorData.gps = {
-        gps.location.lat(),
-        gps.location.lng(),
-        gps.altitude.meters(),
-        gps.date.year(),
-        gps.date.month(),
-        gps.date.day(),
-        gps.time.hour(),
-        gps.time.minute(),
-        gps.time.second()
-    };
+    sensorData.tensao.voltage_rocket = Battery::voltage();
+
+    sensorData.timestampUs = fused.timestampUs;
+    sensorData.phase = static_cast<uint8_t>(fused.phase);
+    sensorData.radio = rateController.state();
+    sensorData.status = Recorder::fault() ? Telemetry::STATUS_RECORDER_FAULT : 0;
+
+    // A tarefa do GPS só publica posições atualizadas; entre elas o
+    // pacote repete a última, com a idade crescendo
+    static Gps::Fix fix = {};
+    static bool hasFix = false;
+    if (Gps::poll(fix)) hasFix = true;
+
+    sensorData.gps = fix.data;
+    sensorData.gps.fixAge = hasFix ? (sample.timestampUs - fix.timestampUs) / 1000
+                                   : Gps::NO_FIX_AGE;
+
+    out = sensorData;
+    Recorder::record(sample, out);
+    return true;
 }
 
  /**
-  * @brief Transmite dados de telemetria via ESP-NOW
+  * @brief Estágio de transmissão: envia telemetria via ESP-NOW
   * 
-  * @details Envia pacote de dados para o endereço de broadcast
+  * @details Comprime as amostras em um quadro de fluxo
+  * (Telemetry::StreamEncoder), da mais antiga para a mais nova, e o envia
+  * para o endereço de broadcast. A cada Config::EspNow::FEC_GROUP quadros
+  * envia também o quadro de paridade do grupo (Telemetry::FecEncoder)
   * 
-  * @note Limita a taxa de transmissão
+  * @param samples Amostras acumuladas desde o último envio
+  * @param count Número de amostras
+  * @return Amostras que entraram no quadro
+  * @note A taxa é controlada pela tarefa de transmissão, no período
+  * decidido pelo rateController
+  * @see Config::RateControl
   */
-void transmitData() {
-    unsigned long currentTime = millis();
-    
-    // Limita a taxa de transmissão
-    if (currentTime - lastTransmissionTime < TRANSMISSION_INTERVAL) return;
-    
-    lastTransmissionTime = currentTime;
+size_t Pipeline::transmit(const SensorData *samples, size_t count) {
+    static Telemetry::StreamEncoder encoder(Config::EspNow::KEYFRAME_INTERVAL,
+                                            Config::EspNow::FEC_GROUP);
+    static Telemetry::FecEncoder fec(Config::EspNow::FEC_GROUP);
 
     // Verifica se o peer existe antes de enviar
     if (!esp_now_is_peer_exist(Config::EspNow::broadcastAddress)) {
@@ -352,18 +402,136 @@ void transmitData() {
         peerInfo.encrypt = false;
 
         if (esp_now_add_peer(&peerInfo) != ESP_OK) {
-            Serial.println("Falha ao adicionar peer para transmissão");
-            return;
+            LOG_ERROR("Falha ao adicionar peer para transmissao");
+            return count;  // Descarta: amostras velhas não valem a espera
         }
     }
 
-    esp_err_t result = esp_now_send(
-        Config::EspNow::broadcastAddress, 
-        reinterpret_cast<uint8_t*>(&sensorData), 
-        sizeof(SensorData)
-    );
+    // O envio a um endereço de grupo não tem ACK: a entrega é a que a Base
+    // relata. Sem relatório novo, os totais ficam e só a fila cheia age
+    static Telemetry::LinkReport link = {};
+    Telemetry::LinkReport report;
+    while (baseLink.popReport(report)) link = report;
+    rateController.update(link.received, link.lost);
+
+    // Sem um quadro perdido, a Base não decodifica o fluxo até o próximo keyframe
+    const uint32_t failed = sendMonitor.failed();
+    static uint32_t lastFailed = 0;
+    static uint32_t lastLost = 0;
+    if (failed != lastFailed || link.lost > lastLost) {
+        encoder.forceKeyframe();
+    }
+    lastFailed = failed;
+    lastLost = link.lost;
 
+    uint8_t frame[Telemetry::MAX_FRAME_BYTES];
+    size_t packed = 0;
+    size_t length = encoder.encode(samples, count, frame, packed);
+
+    esp_err_t result = sendFrame(frame, length);
     handleCommunicationErrors(result);
+    if (result != ESP_OK) encoder.forceKeyframe();
+
+    // O grupo inclui também os quadros que falharam: a paridade ainda os recupera
+    uint8_t parity[Telemetry::MAX_FRAME_BYTES];
+    size_t parityLength = 0;
+    if (fec.add(frame, length, parity, parityLength)) {
+        handleCommunicationErrors(sendFrame(parity, parityLength));
+    }
+    return packed;
+}
+
+esp_err_t sendFrame(const uint8_t *data, size_t len) {
+    // sendMonitor.begin()/commit() esperam um único chamador por vez
+    xSemaphoreTake(sendLock, portMAX_DELAY);
+
+    // Além de SEND_IN_FLIGHT, o instante de um envio ainda sem callback seria sobrescrito
+    if (sendMonitor.inFlight() >= SEND_IN_FLIGHT) {
+        xSemaphoreGive(sendLock);
+        return ESP_ERR_ESPNOW_NO_MEM;
+    }
+
+    // O callback pode rodar antes de esp_now_send() retornar
+    sendMonitor.begin(static_cast<uint32_t>(esp_timer_get_time()));
+    esp_err_t result = esp_now_send(Config::EspNow::broadcastAddress, data, len);
+    if (result == ESP_OK) sendMonitor.commit();
+
+    xSemaphoreGive(sendLock);
+    return result;
+}
+
+/**
+ * @brief Envia uma mensagem da transferência do arquivo de voo
+ * 
+ * @details Sem tratamento de erro: uma recusa (fila cheia) só adia o
+ * pedaço, e não deve espaçar a telemetria como em Pipeline::transmit()
+ */
+bool Download::send(const uint8_t *message, size_t len) {
+    return sendFrame(message, len) == ESP_OK;
+}
+
+size_t Download::inFlight() {
+    return sendMonitor.inFlight();
+}
+
+/**
+ * @brief Relatório periódico do rádio, impresso pela tarefa de registro
+ * 
+ * @details Contadores de envio, histograma da latência entre
+ * esp_now_send() e o callback de conclusão e contadores do gravador,
+ * da transferência do arquivo de voo e do registro
+ */
+void Pipeline::report() {
+    SendMonitor::Snapshot s;
+    sendMonitor.snapshot(s);
+    const uint32_t completed = s.delivered + s.failed;
+
+    LOG_INFO("===== RADIO =====");
+    LOG_INFO("envios=%lu entregues=%lu falhas=%lu pendentes=%lu ultimo=%lums atras",
+             (unsigned long)s.queued, (unsigned long)s.delivered, (unsigned long)s.failed,
+             (unsigned long)(s.queued - completed),
+             (unsigned long)((static_cast<uint32_t>(esp_timer_get_time()) - s.lastCompletionUs) / 1000U));
+    LOG_INFO("latencia media=%luus max=%luus | quadro a cada %lums, %u amostras",
+             (unsigned long)(completed ? s.sumLatencyUs / completed : 0),
+             (unsigned long)s.maxLatencyUs,
+             (unsigned long)rateController.frameIntervalMs(),
+             (unsigned)rateController.state().batchSize);
+    for (size_t i = 0; i + 1 < SEND_LATENCY_BUCKETS; i++) {
+        LOG_INFO("  <%6luus %lu",
+                 (unsigned long)SendMonitor::bucketLimitUs(i), (unsigned long)s.histogram[i]);
+    }
+    LOG_INFO("  >=%5luus %lu",
+             (unsigned long)SendMonitor::bucketLimitUs(SEND_LATENCY_BUCKETS - 2),
+             (unsigned long)s.histogram[SEND_LATENCY_BUCKETS - 1]);
+    const Recorder::Stats &recorder = Recorder::stats();
+    LOG_INFO("gravador: %s amostras=%lu descartadas=%lu kB=%lu syncs=%lu erros=%lu escrita max=%luus",
+             Recorder::stateName(Recorder::state()),
+             (unsigned long)recorder.recorded, (unsigned long)recorder.dropped,
+             (unsigned long)(recorder.bytesWritten / 1024U), (unsigned long)recorder.syncs,
+             (unsigned long)recorder.writeErrors, (unsigned long)recorder.maxWriteUs);
+    LOG_INFO("gravador: lacunas=%lu (max %luus) arquivos apagados=%lu",
+             (unsigned long)recorder.gaps, (unsigned long)recorder.maxGapUs,
+             (unsigned long)recorder.removed);
+    const Transfer::Sender &download = Download::sender();
+    if (download.chunks() > 0) {
+        const Transfer::Sender::Stats &d = download.stats();
+        LOG_INFO("download: %lu/%lu pedacos reenvios=%lu (tempo %lu) acks=%lu recusas=%lu",
+                 (unsigned long)download.acknowledged(), (unsigned long)download.chunks(),
+                 (unsigned long)d.retransmitted, (unsigned long)d.timeouts,
+                 (unsigned long)d.acks, (unsigned long)d.refused);
+    }
+    const Log::Stats log = Log::stats();
+    LOG_INFO("log: mensagens=%lu descartadas=%lu cortadas=%lu",
+             (unsigned long)log.written, (unsigned long)log.dropped, (unsigned long)log.truncated);
+    LOG_INFO("=================");
+}
+
+uint32_t Pipeline::frameInterval() {
+    return rateController.frameIntervalMs();
+}
+
+uint32_t Pipeline::sampleInterval() {
+    return rateController.sampleIntervalUs();
 }
  
  /**
@@ -376,55 +544,127 @@ void transmitData() {
  void handleCommunicationErrors(esp_err_t result) {
     switch(result) {
         case ESP_OK:
-            Serial.println("ENVIADO com sucesso");
-            break;
+            break;  // Contabilizado em sendMonitor e impresso em Pipeline::report()
         case ESP_ERR_ESPNOW_NOT_INIT:
-            Serial.println("ESP-NOW nao inicializado");
+            LOG_ERROR("ESP-NOW nao inicializado");
             setupEspNow();
             break;
         case ESP_ERR_ESPNOW_ARG:
-            Serial.println("Argumento invalido");
+            LOG_ERROR("Argumento invalido");
             break;
         case ESP_ERR_ESPNOW_NO_MEM:
-            Serial.println("Sem memoria");
+            LOG_WARN("Sem memoria");
+            rateController.queueFull();
             break;
         default:
-            Serial.printf("Erro desconhecido: %d\n", result);
+            LOG_ERROR("Erro desconhecido: %d", result);
     }
 }
  
  /**
-  * @brief Imprime dados de telemetria para depuração
+  * @brief Estágio de registro: imprime telemetria para depuração
   * 
   * @details Exibe informações detalhadas dos sensores no console serial
   * 
-  * @note Útil para desenvolvimento e testes
+  * @param data Pacote produzido pela fusão
+  * @note Roda na tarefa de menor prioridade e não atrasa a aquisição
   */
- void debugPrintData() {
-    Serial.println("===== TELEMETRIA =====");
-    Serial.printf("Aceleracao: X=%.2f, Y=%.2f, Z=%.2f m/s²\n", 
-        sensorData.acelerometro.accX, 
-        sensorData.acelerometro.accY, 
-        sensorData.acelerometro.accZ);
+ void Pipeline::log(const SensorData &data) {
+    FlightEvent event;
+    while (flightEvents.pop(event)) {
+        LOG_INFO(">>> EVENTO: %s em %lu us (altitude=%.1f m, velocidade=%.1f m/s)",
+            Telemetry::phaseName(static_cast<uint8_t>(event.phase)),
+            (unsigned long)event.timestampUs,
+            event.altitude,
+            event.verticalSpeed);
+    }
+
+    LOG_DEBUG("===== TELEMETRIA =====");
+    LOG_DEBUG("Fase: %s", Telemetry::phaseName(data.phase));
+    LOG_DEBUG("Radio: quadro a cada %u ms, %u amostras, entrega %u%%",
+        (unsigned)data.radio.frameIntervalMs,
+        (unsigned)data.radio.batchSize,
+        (unsigned)data.radio.deliveryPct);
+    LOG_DEBUG("Aceleracao: X=%.2f, Y=%.2f, Z=%.2f m/s²", 
+        data.acelerometro.accX, 
+        data.acelerometro.accY, 
+        data.acelerometro.accZ);
     
-    Serial.printf("Giroscopio: X=%.2f, Y=%.2f, Z=%.2f rad/s\n", 
-        sensorData.acelerometro.gyroX, 
-        sensorData.acelerometro.gyroY, 
-        sensorData.acelerometro.gyroZ);
-
-    Serial.printf("Orientacao: Pitch=%.2f°, Roll=%.2f°\n", 
-        sensorData.acelerometro.pitch, 
-        sensorData.acelerometro.roll);
-
-    Serial.printf("Temperatura: %.2f °C\n", sensorData.acelerometro.temp);
-    Serial.printf("Pressao: %.2f hPa\n", sensorData.altimetro.pressure);
-    Serial.printf("Altitude: %.2f m\n", sensorData.altimetro.altitude);
-    Serial.printf("Timestamp: %lu ms\n", sensorData.timestamp);
-    Serial.println("====================\n");
+    LOG_DEBUG("Giroscopio: X=%.2f, Y=%.2f, Z=%.2f rad/s", 
+        data.acelerometro.gyroX, 
+        data.acelerometro.gyroY, 
+        data.acelerometro.gyroZ);
+
+    LOG_DEBUG("Orientacao: Pitch=%.2f°, Roll=%.2f°", 
+        data.acelerometro.pitch, 
+        data.acelerometro.roll);
+
+    LOG_DEBUG("Temperatura: %.2f °C", data.acelerometro.temp);
+    LOG_DEBUG("Pressao: %.2f hPa", data.altimetro.pressure);
+    LOG_DEBUG("Altitude: %.2f m", data.altimetro.altitude);
+    if (data.gps.fixAge != Gps::NO_FIX_AGE) {
+        LOG_DEBUG("GPS: %.6f, %.6f (idade=%lu ms, HDOP=%.1f, satelites=%u)",
+            data.gps.latitude,
+            data.gps.longitude,
+            (unsigned long)data.gps.fixAge,
+            data.gps.hdop,
+            (unsigned)data.gps.satellites);
+    } else {
+        LOG_DEBUG("GPS: sem posicao");
+    }
+    LOG_DEBUG("Timestamp: %lu ms", (unsigned long)(data.timestampUs / 1000));
+    if (Config::Sensors::IMU_MODE == Config::Sensors::ImuMode::FIFO)
+        LOG_DEBUG("Estouros do FIFO: %lu", (unsigned long)mpu.overflows());
+    LOG_DEBUG("====================");
 }
  
 
 
+/**
+ * @brief Interrupção do pino INT do MPU6050 (modo DATA_READY)
+ * 
+ * @details Captura o instante da amostra o mais cedo possível; a leitura
+ * I2C é feita depois, pela tarefa de aquisição.
+ */
+void IRAM_ATTR onImuDataReady() {
+  Pipeline::triggerFromISR(static_cast<uint32_t>(esp_timer_get_time()));
+}
+
+/**
+ * @brief Callback do esp_timer periódico (modo TIMER)
+ */
+void onSampleTimer(void *) {
+  Pipeline::trigger(static_cast<uint32_t>(esp_timer_get_time()));
+}
+
+/**
+ * @brief Inicia a fonte de disparo da aquisição
+ * 
+ * @details Só tem efeito nos modos DATA_READY e TIMER; deve ser chamada
+ * depois de Pipeline::start(), quando a tarefa de aquisição já existe.
+ */
+void startSampleTrigger() {
+  using Config::Sensors::ImuMode;
+
+  if (Config::Sensors::IMU_MODE == ImuMode::DATA_READY) {
+      pinMode(Config::Hardware::MPU_INT_PIN, INPUT);
+      attachInterrupt(digitalPinToInterrupt(Config::Hardware::MPU_INT_PIN), onImuDataReady, RISING);
+  } else if (Config::Sensors::IMU_MODE == ImuMode::TIMER) {
+      const esp_timer_create_args_t args = {
+          .callback = onSampleTimer,
+          .arg = nullptr,
+          .dispatch_method = ESP_TIMER_TASK,
+          .name = "amostragem",
+          .skip_unhandled_events = true
+      };
+      if (esp_timer_create(&args, &sampleTimer) != ESP_OK ||
+          esp_timer_start_periodic(sampleTimer, 1000000ULL / Config::Sensors::IMU_SAMPLE_RATE) != ESP_OK) {
+          Serial.println("Erro ao iniciar timer de amostragem");
+          ESP.restart();
+      }
+  }
+}
+
 /**
  * @brief Configuração do sistema de telemetria
  */
@@ -432,8 +672,15 @@ void setup() {
   Serial.begin(Config::Hardware::BAUD_RATE);
   while (!Serial) delay(10);
 
+  // As mensagens de configuração abaixo seguem síncronas: algumas
+  // precedem um ESP.restart() e se perderiam no buffer
+  if (!Log::start()) {
+      Serial.println("Erro ao criar a tarefa de registro");
+  }
+
   // Inicialização do barramento I2C
   Wire.begin();
+  Wire.setClock(Config::Hardware::I2C_CLOCK);
   
   // Configurações de rede e comunicação
   WiFi.mode(WIFI_STA);
@@ -447,20 +694,46 @@ void setup() {
       ESP.restart();
   }
 
+  sendLock = xSemaphoreCreateMutex();
   setupEspNow();
   // Inicialização dos sensores
   setupSensors();
+  if (Config::Sensors::RUN_FUSION_BENCHMARK) Fusion::runBenchmark();
+
+  // O gravador também não: sem ele resta a telemetria, que avisa a Base
+  if (Recorder::start()) {
+      Serial.printf("Gravador: %s\n", Recorder::fileName());
+  } else {
+      Serial.println("Gravador de voo sem espaco ou sem LittleFS: baixe o voo anterior pela Base");
+  }
+
+  // Envio do arquivo de voo à Base, sob pedido, depois do pouso
+  if (!Download::start(baseLink)) {
+      Serial.println("Erro ao criar a tarefa de download");
+  }
+
+  // O GPS não é crítico: sem ele o voo segue com a posição zerada
+  if (!Gps::start()) {
+      Serial.println("Erro ao inicializar o GPS");
+  }
+
+  // Inicialização das tarefas do pipeline
+  if (!Pipeline::start()) {
+      Serial.println("Erro ao criar tarefas do pipeline");
+      ESP.restart();
+  }
+  startSampleTrigger();
 
   Serial.println("Sistema de Telemetria Inicializado");
 }
 
 /**
  * @brief Laço principal de execução
+ * 
+ * @details Todo o trabalho é feito pelas tarefas do pipeline; 
+ * a tarefa do loop() do Arduino é encerrada.
  */
 void loop() {
-  updateSensorData();
-  transmitData();
-  debugPrintData();
-  delay(100);  // Pequeno atraso para estabilidade
+  vTaskDelete(nullptr);
 }
  
\ No newline at end of file
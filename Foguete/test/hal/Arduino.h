@@ -0,0 +1,142 @@
+/**
+ * @file Arduino.h
+ * @brief HAL simulada para compilar o firmware no host (Linux)
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Substitui o núcleo Arduino do ESP32 nos ambientes native do
+ * platformio.ini e nos programas de tools/: o tempo vem do relógio
+ * monotônico do host, contado a partir do primeiro uso, e a serial
+ * escreve na saída padrão.
+ *
+ * Só cobre o que os módulos compilados no host usam.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define IRAM_ATTR
+
+#define PI 3.1415926535897932384626433832795
+#define RAD_TO_DEG 57.295779513082320876798154814105
+
+using std::max;
+using std::min;
+
+template <typename T>
+inline T constrain(T value, T low, T high)
+{
+    return value < low ? low : (value > high ? high : value);
+}
+
+namespace Hal
+{
+    /// @brief Nanossegundos desde o boot (mesmo zero dos ticks)
+    inline int64_t uptimeNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - tickZero())
+            .count();
+    }
+
+    /// @brief Microssegundos desde o boot (mesmo zero dos ticks), em 64 bits
+    inline int64_t uptimeUs()
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - tickZero())
+            .count();
+    }
+}
+
+inline uint32_t micros()
+{
+    return static_cast<uint32_t>(Hal::uptimeUs());
+}
+
+inline uint32_t millis()
+{
+    return static_cast<uint32_t>(Hal::uptimeUs() / 1000);
+}
+
+inline void delay(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+inline void delayMicroseconds(uint32_t us)
+{
+    std::this_thread::sleep_for(std::chrono::microseconds(us));
+}
+
+/**
+ * @brief Contador de ciclos do ESP32 simulado
+ *
+ * @details Conta o tempo do host como se fossem ciclos de um núcleo a
+ * CPU_MHZ: serve para comparar caminhos entre si, não para prever o
+ * tempo no ESP32, cuja FPU e cache são bem mais lentas.
+ */
+class EspClass
+{
+public:
+    static constexpr uint32_t CPU_MHZ = 240;
+
+    uint32_t getCycleCount()
+    {
+        return static_cast<uint32_t>(Hal::uptimeNs() * CPU_MHZ / 1000);
+    }
+};
+
+/// @brief Sem estado: cada unidade de compilação tem a sua cópia
+static EspClass ESP __attribute__((unused));
+
+/// @brief Serial na saída padrão
+class HardwareSerial
+{
+public:
+    size_t write(uint8_t byte)
+    {
+        return fwrite(&byte, 1, 1, stdout);
+    }
+
+    size_t write(const uint8_t *data, size_t len)
+    {
+        return fwrite(data, 1, len, stdout);
+    }
+
+    size_t print(const char *text)
+    {
+        return fputs(text, stdout) < 0 ? 0 : strlen(text);
+    }
+
+    size_t println(const char *text = "")
+    {
+        return print(text) + write('\n');
+    }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        va_list args;
+        va_start(args, format);
+        const int length = vprintf(format, args);
+        va_end(args);
+        return length < 0 ? 0 : static_cast<size_t>(length);
+    }
+
+    explicit operator bool() const
+    {
+        return true;
+    }
+};
+
+/// @brief Sem estado: cada unidade de compilação tem a sua cópia
+static HardwareSerial Serial __attribute__((unused));
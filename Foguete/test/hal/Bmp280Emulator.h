@@ -0,0 +1,86 @@
+/**
+ * @file Bmp280Emulator.h
+ * @brief BMP280 emulado no nível de registrador, para o Wire.h simulado
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Vem com a calibração e as leituras brutas do exemplo do datasheet
+ * (seção 3.12), que compensam para 25,08 °C e 100653,27 Pa. Os
+ * registradores de dados (0xF7..0xFC) são trocados por setRaw(), como
+ * se o sensor tivesse terminado uma conversão.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <Wire.h>
+
+class Bmp280Emulator : public Hal::I2cDevice
+{
+public:
+    static constexpr uint8_t REG_CALIB = 0x88;
+    static constexpr uint8_t REG_CHIP_ID = 0xD0;
+    static constexpr uint8_t REG_CTRL_MEAS = 0xF4;
+    static constexpr uint8_t REG_CONFIG = 0xF5;
+    static constexpr uint8_t REG_PRESS_MSB = 0xF7;
+
+    /// @brief Leituras brutas do exemplo do datasheet
+    static constexpr int32_t EXAMPLE_ADC_T = 519888;
+    static constexpr int32_t EXAMPLE_ADC_P = 415148;
+
+    Bmp280Emulator()
+    {
+        memset(registers_, 0, sizeof(registers_));
+        registers_[REG_CHIP_ID] = 0x58;
+
+        const uint16_t calib[12] = {
+            27504, 26435, static_cast<uint16_t>(-1000),                   // T1..T3
+            36477, static_cast<uint16_t>(-10685), 3024, 2855, 140,        // P1..P5
+            static_cast<uint16_t>(-7), 15500, static_cast<uint16_t>(-14600), 6000  // P6..P9
+        };
+        for (size_t i = 0; i < 12; i++) {
+            registers_[REG_CALIB + 2 * i] = static_cast<uint8_t>(calib[i] & 0xFF);
+            registers_[REG_CALIB + 2 * i + 1] = static_cast<uint8_t>(calib[i] >> 8);
+        }
+        setRaw(EXAMPLE_ADC_T, EXAMPLE_ADC_P);
+    }
+
+    /// @brief Publica uma conversão nova (valores de 20 bits)
+    void setRaw(int32_t adcT, int32_t adcP)
+    {
+        put20(REG_PRESS_MSB, adcP);
+        put20(REG_PRESS_MSB + 3, adcT);
+    }
+
+    /// @brief Valor atual de um registrador
+    uint8_t registerValue(uint8_t reg) const
+    {
+        return registers_[reg];
+    }
+
+    void write(uint8_t reg, const uint8_t *data, size_t len) override
+    {
+        for (size_t i = 0; i < len; i++)
+            registers_[static_cast<uint8_t>(reg + i)] = data[i];
+    }
+
+    void read(uint8_t reg, uint8_t *buffer, size_t len) override
+    {
+        for (size_t i = 0; i < len; i++)
+            buffer[i] = registers_[static_cast<uint8_t>(reg + i)];
+    }
+
+private:
+    /// @brief Valor de 20 bits nos registradores msb, lsb e xlsb[7:4]
+    void put20(uint8_t reg, int32_t value)
+    {
+        registers_[reg] = static_cast<uint8_t>(value >> 12);
+        registers_[reg + 1] = static_cast<uint8_t>(value >> 4);
+        registers_[reg + 2] = static_cast<uint8_t>((value & 0x0F) << 4);
+    }
+
+    uint8_t registers_[256];
+};
@@ -0,0 +1,115 @@
+/**
+ * @file Mpu6050Emulator.h
+ * @brief MPU6050 emulado no nível de registrador, para o Wire.h simulado
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Cobre o que os drivers usam: WHO_AM_I, os registradores de saída de
+ * ACCEL_XOUT_H em diante, o FIFO (FIFO_COUNT, FIFO_R_W, reset pelo
+ * USER_CTRL) e o bit de estouro do INT_STATUS. Os demais registradores
+ * guardam o que for escrito. Os quadros entram no FIFO por pushFrame(),
+ * com o mesmo layout big-endian do sensor.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+
+#include <Wire.h>
+
+class Mpu6050Emulator : public Hal::I2cDevice
+{
+public:
+    static constexpr uint8_t REG_INT_STATUS = 0x3A;
+    static constexpr uint8_t REG_ACCEL_XOUT_H = 0x3B;
+    static constexpr uint8_t REG_USER_CTRL = 0x6A;
+    static constexpr uint8_t REG_FIFO_COUNTH = 0x72;
+    static constexpr uint8_t REG_FIFO_COUNTL = 0x73;
+    static constexpr uint8_t REG_FIFO_R_W = 0x74;
+    static constexpr uint8_t REG_WHO_AM_I = 0x75;
+
+    static constexpr uint8_t INT_STATUS_FIFO_OFLOW = 0x10;
+    static constexpr uint8_t USER_CTRL_FIFO_RESET = 0x04;
+    static constexpr size_t FIFO_CAPACITY = 1024;
+    static constexpr size_t FRAME_SIZE = 14;
+
+    Mpu6050Emulator()
+    {
+        memset(registers_, 0, sizeof(registers_));
+        registers_[REG_WHO_AM_I] = 0x68;
+    }
+
+    /// @brief Coloca um quadro no FIFO e nos registradores de saída
+    void pushFrame(const int16_t acc[3], int16_t temp, const int16_t gyro[3])
+    {
+        const int16_t words[7] = {acc[0], acc[1], acc[2], temp, gyro[0], gyro[1], gyro[2]};
+        for (size_t i = 0; i < 7; i++) {
+            const uint8_t high = static_cast<uint8_t>(static_cast<uint16_t>(words[i]) >> 8);
+            const uint8_t low = static_cast<uint8_t>(words[i] & 0xFF);
+            registers_[REG_ACCEL_XOUT_H + 2 * i] = high;
+            registers_[REG_ACCEL_XOUT_H + 2 * i + 1] = low;
+            if (fifo_.size() + 2 > FIFO_CAPACITY) {
+                // O sensor sobrescreve os bytes mais antigos e sinaliza o estouro
+                fifo_.pop_front();
+                fifo_.pop_front();
+                registers_[REG_INT_STATUS] |= INT_STATUS_FIFO_OFLOW;
+            }
+            fifo_.push_back(high);
+            fifo_.push_back(low);
+        }
+    }
+
+    /// @brief Bytes no FIFO
+    size_t fifoBytes() const
+    {
+        return fifo_.size();
+    }
+
+    /// @brief Valor atual de um registrador
+    uint8_t registerValue(uint8_t reg) const
+    {
+        return registers_[reg];
+    }
+
+    void write(uint8_t reg, const uint8_t *data, size_t len) override
+    {
+        for (size_t i = 0; i < len; i++, reg++) {
+            if (reg == REG_FIFO_R_W) continue;
+            registers_[reg] = data[i];
+            if (reg == REG_USER_CTRL && (data[i] & USER_CTRL_FIFO_RESET)) {
+                fifo_.clear();
+                registers_[reg] &= static_cast<uint8_t>(~USER_CTRL_FIFO_RESET);
+            }
+        }
+    }
+
+    void read(uint8_t reg, uint8_t *buffer, size_t len) override
+    {
+        for (size_t i = 0; i < len; i++) {
+            // FIFO_R_W não avança o endereço: a rajada inteira sai do FIFO
+            if (reg == REG_FIFO_R_W) {
+                buffer[i] = fifo_.empty() ? 0 : fifo_.front();
+                if (!fifo_.empty()) fifo_.pop_front();
+                continue;
+            }
+
+            if (reg == REG_FIFO_COUNTH) {
+                buffer[i] = static_cast<uint8_t>(fifo_.size() >> 8);
+            } else if (reg == REG_FIFO_COUNTL) {
+                buffer[i] = static_cast<uint8_t>(fifo_.size() & 0xFF);
+            } else {
+                buffer[i] = registers_[reg];
+                // INT_STATUS é limpo pela leitura
+                if (reg == REG_INT_STATUS) registers_[reg] = 0;
+            }
+            reg++;
+        }
+    }
+
+private:
+    uint8_t registers_[256];
+    std::deque<uint8_t> fifo_;
+};
@@ -0,0 +1,197 @@
+/**
+ * @file Wire.h
+ * @brief Barramento I2C simulado, com dispositivos emulados por registrador
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Cada endereço do barramento é atendido por um Hal::I2cDevice, que o
+ * teste implementa com o mapa de registradores do sensor. Os drivers
+ * rodam sem alteração: uma escrita é [registrador, dados...] e uma
+ * leitura é a escrita do registrador sem STOP seguida de requestFrom().
+ *
+ * O barramento conta transações e bytes trafegados, de onde sai o tempo
+ * que as mesmas operações levariam a um dado clock (9 bits por byte,
+ * mais endereço e START/STOP).
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace Hal
+{
+    /// @brief Dispositivo emulado em um endereço do barramento
+    class I2cDevice
+    {
+    public:
+        virtual ~I2cDevice() {}
+
+        /// @brief Escrita de @p len bytes a partir de @p reg
+        virtual void write(uint8_t reg, const uint8_t *data, size_t len) = 0;
+
+        /// @brief Leitura de @p len bytes a partir de @p reg
+        virtual void read(uint8_t reg, uint8_t *buffer, size_t len) = 0;
+    };
+}
+
+class TwoWire
+{
+public:
+    /// @brief Maior transferência aceita, como o buffer do núcleo do ESP32
+    static constexpr size_t BUFFER_LENGTH = 128;
+
+    /// @brief Endereços de 7 bits
+    static constexpr size_t ADDRESSES = 128;
+
+    TwoWire()
+    {
+        memset(devices_, 0, sizeof(devices_));
+    }
+
+    /// @brief Liga @p device ao endereço @p address (nullptr desliga)
+    void attach(uint8_t address, Hal::I2cDevice *device)
+    {
+        devices_[address & 0x7F] = device;
+    }
+
+    bool begin(int = -1, int = -1, uint32_t frequency = 0)
+    {
+        if (frequency != 0) clock_ = frequency;
+        return true;
+    }
+
+    bool setClock(uint32_t frequency)
+    {
+        clock_ = frequency;
+        return true;
+    }
+
+    uint32_t getClock() const
+    {
+        return clock_;
+    }
+
+    void beginTransmission(uint16_t address)
+    {
+        address_ = static_cast<uint8_t>(address & 0x7F);
+        txLength_ = 0;
+    }
+
+    size_t write(uint8_t byte)
+    {
+        if (txLength_ >= BUFFER_LENGTH) return 0;
+        tx_[txLength_++] = byte;
+        return 1;
+    }
+
+    size_t write(const uint8_t *data, size_t len)
+    {
+        size_t written = 0;
+        while (written < len && write(data[written]) == 1)
+            written++;
+        return written;
+    }
+
+    /**
+     * @brief Conclui a escrita
+     * @retval 0 Sucesso
+     * @retval 2 Ninguém respondeu no endereço (NACK)
+     */
+    uint8_t endTransmission(bool sendStop = true)
+    {
+        account(txLength_, sendStop);
+        Hal::I2cDevice *device = devices_[address_];
+        if (device == nullptr) return 2;
+        if (txLength_ == 0) return 0;
+
+        // Sem STOP, o registrador fica selecionado para a leitura seguinte
+        register_ = tx_[0];
+        if (txLength_ > 1) device->write(register_, tx_ + 1, txLength_ - 1);
+        return 0;
+    }
+
+    size_t requestFrom(uint16_t address, size_t len, bool sendStop = true)
+    {
+        rxLength_ = rxIndex_ = 0;
+        Hal::I2cDevice *device = devices_[address & 0x7F];
+        if (device == nullptr || len > BUFFER_LENGTH) return 0;
+
+        device->read(register_, rx_, len);
+        rxLength_ = len;
+        account(len, sendStop);
+        return len;
+    }
+
+    int available() const
+    {
+        return static_cast<int>(rxLength_ - rxIndex_);
+    }
+
+    int read()
+    {
+        return rxIndex_ < rxLength_ ? rx_[rxIndex_++] : -1;
+    }
+
+    size_t readBytes(uint8_t *buffer, size_t len)
+    {
+        size_t count = 0;
+        while (count < len && rxIndex_ < rxLength_)
+            buffer[count++] = rx_[rxIndex_++];
+        return count;
+    }
+
+    /// @brief Transações (cada endTransmission ou requestFrom)
+    uint32_t transactions() const
+    {
+        return transactions_;
+    }
+
+    /// @brief Bytes de registrador e de dados, sem o endereço
+    uint64_t bytes() const
+    {
+        return bytes_;
+    }
+
+    /// @brief Bits no fio, contando endereço, ACKs, START e STOP
+    uint64_t bits() const
+    {
+        return bits_;
+    }
+
+    /// @brief Tempo de barramento acumulado ao clock configurado (µs)
+    uint64_t busMicros() const
+    {
+        return bits_ * 1000000ULL / clock_;
+    }
+
+    void resetCounters()
+    {
+        transactions_ = 0;
+        bytes_ = 0;
+        bits_ = 0;
+    }
+
+private:
+    /// @brief Soma uma transação: START, endereço e @p len bytes de 9 bits
+    void account(size_t len, bool sendStop)
+    {
+        transactions_++;
+        bytes_ += len;
+        bits_ += 1 + 9 + 9ULL * len + (sendStop ? 1 : 0);
+    }
+
+    Hal::I2cDevice *devices_[ADDRESSES];
+    uint32_t clock_ = 100000;
+    uint8_t address_ = 0;
+    uint8_t register_ = 0;
+    uint8_t tx_[BUFFER_LENGTH];
+    size_t txLength_ = 0;
+    uint8_t rx_[BUFFER_LENGTH];
+    size_t rxLength_ = 0;
+    size_t rxIndex_ = 0;
+    uint32_t transactions_ = 0;
+    uint64_t bytes_ = 0;
+    uint64_t bits_ = 0;
+};
@@ -0,0 +1,16 @@
+/**
+ * @file esp_timer.h
+ * @brief Temporizador de alta resolução do ESP-IDF na HAL simulada
+ * @version 1.0
+ * @date Outubro/2026
+ */
+
+#pragma once
+
+#include <Arduino.h>
+
+/// @brief Microssegundos desde o boot, no mesmo relógio de micros()
+inline int64_t esp_timer_get_time()
+{
+    return Hal::uptimeUs();
+}
@@ -0,0 +1,31 @@
+/**
+ * @file FreeRTOS.h
+ * @brief Tipos e constantes do FreeRTOS para a HAL simulada no host
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Um tick vale 1 ms, como no ESP32 com o núcleo Arduino.
+ */
+
+#pragma once
+
+#include <cstdint>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdPASS 1
+#define pdFAIL 0
+
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY 0xFFFFFFFFU
+#define pdMS_TO_TICKS(ms) (static_cast<TickType_t>(ms))
+
+/// @brief Troca de contexto ao sair de uma ISR: no host não há ISR
+#define portYIELD_FROM_ISR() \
+    do {                     \
+    } while (0)
@@ -0,0 +1,126 @@
+/**
+ * @file task.h
+ * @brief Tarefas e notificações do FreeRTOS sobre std::thread
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Cada tarefa é uma thread do host; prioridade, pilha e núcleo são
+ * ignorados, então o escalonamento é o do Linux e não o preemptivo por
+ * prioridade do FreeRTOS. Basta para medir vazão e perdas dos estágios,
+ * não para reproduzir a disputa pelo núcleo.
+ *
+ * A notificação de tarefa é um contador protegido por mutex e variável
+ * de condição, com a mesma semântica de xTaskNotifyGive/ulTaskNotifyTake.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+#include "FreeRTOS.h"
+
+namespace Hal
+{
+    /// @brief Estado de uma tarefa simulada
+    struct Task {
+        std::mutex mutex;
+        std::condition_variable wake;
+        uint32_t notifications = 0;
+    };
+
+    /// @brief Tarefa associada à thread atual
+    inline Task *&current()
+    {
+        static thread_local Task *task = nullptr;
+        return task;
+    }
+
+    /// @brief Tarefa da thread atual; a thread principal ganha uma na primeira consulta
+    inline Task *self()
+    {
+        Task *&task = current();
+        if (task == nullptr) task = new Task();
+        return task;
+    }
+
+    /// @brief Relógio dos ticks, com o mesmo zero de Hal::boot()
+    inline std::chrono::steady_clock::time_point tickZero()
+    {
+        static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        return start;
+    }
+}
+
+typedef Hal::Task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+inline TickType_t xTaskGetTickCount()
+{
+    return static_cast<TickType_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - Hal::tickZero())
+            .count());
+}
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    return Hal::self();
+}
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t code, const char *, uint32_t, void *parameter,
+                                          UBaseType_t, TaskHandle_t *handle, BaseType_t)
+{
+    Hal::Task *task = new Hal::Task();
+    if (handle != nullptr) *handle = task;
+    std::thread([code, parameter, task]() {
+        Hal::current() = task;
+        code(parameter);
+    }).detach();
+    return pdPASS;
+}
+
+inline void vTaskDelay(TickType_t ticks)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ticks));
+}
+
+/// @brief Acorda em *previous + increment, medido no relógio dos ticks
+inline void vTaskDelayUntil(TickType_t *previous, TickType_t increment)
+{
+    *previous += increment;
+    std::this_thread::sleep_until(Hal::tickZero() + std::chrono::milliseconds(*previous));
+}
+
+inline BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    {
+        std::lock_guard<std::mutex> lock(task->mutex);
+        task->notifications++;
+    }
+    task->wake.notify_one();
+    return pdPASS;
+}
+
+inline void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higherPriorityTaskWoken)
+{
+    xTaskNotifyGive(task);
+    if (higherPriorityTaskWoken != nullptr) *higherPriorityTaskWoken = pdFALSE;
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks)
+{
+    Hal::Task *task = Hal::self();
+    std::unique_lock<std::mutex> lock(task->mutex);
+    const auto ready = [task]() { return task->notifications > 0; };
+    if (ticks == portMAX_DELAY) {
+        task->wake.wait(lock, ready);
+    } else if (!task->wake.wait_for(lock, std::chrono::milliseconds(ticks), ready)) {
+        return 0;
+    }
+    const uint32_t count = task->notifications;
+    task->notifications = clearOnExit ? 0 : count - 1;
+    return count;
+}
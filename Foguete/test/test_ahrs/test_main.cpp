@@ -0,0 +1,246 @@
+/**
+ * @file test_main.cpp
+ * @brief Exatidão do filtro de Mahony (Ahrs) sobre trajetórias reproduzidas
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Roda no host: pio test -e native -f test_ahrs
+ *
+ * Cada teste gera uma trajetória verdadeira em double (orientação
+ * integrada exatamente a partir da velocidade angular), sintetiza o que
+ * o MPU6050 mediria a 1 kHz — giroscópio com viés e ruído, acelerômetro
+ * com a força específica no corpo e ruído — e reproduz as medidas no
+ * filtro com os ganhos de Config::Sensors. O erro de inclinação é o
+ * ângulo entre a vertical verdadeira e Ahrs::up().
+ */
+
+#include <unity.h>
+
+#include <cmath>
+#include <cstdint>
+
+#include "Ahrs.h"
+#include "Config.h"
+
+namespace
+{
+    constexpr double DT = 0.001;
+    constexpr double G = Config::Sensors::GRAVITY;
+    constexpr double DEG = 180.0 / M_PI;
+
+    /// @brief Ruído reprodutível: soma de uniformes, aproximadamente gaussiano
+    class Noise
+    {
+    public:
+        explicit Noise(uint32_t seed) : state_(seed) {}
+
+        double next(double sigma)
+        {
+            double sum = 0.0;
+            for (int i = 0; i < 12; i++) {
+                state_ = state_ * 1664525U + 1013904223U;
+                sum += static_cast<double>(state_) / 4294967296.0;
+            }
+            return (sum - 6.0) * sigma;
+        }
+
+    private:
+        uint32_t state_;
+    };
+
+    /**
+     * @brief Orientação verdadeira e medidas sintéticas
+     *
+     * @details q leva do corpo à referência (w, x, y, z), como em Ahrs.
+     */
+    struct Replay {
+        double q[4] = {1.0, 0.0, 0.0, 0.0};
+        double bias[3] = {0.0, 0.0, 0.0};
+        double gyroNoise = 0.002;  // rad/s, ~0,1 °/s como o MPU6050 a 1 kHz
+        double accNoise = 0.04;    // m/s²
+        Noise noise{12345U};
+        Ahrs ahrs{Config::Sensors::AHRS_KP, Config::Sensors::AHRS_KI, Config::Sensors::AHRS_ACCEL_GATE};
+
+        /// @brief Vertical (para cima) da referência no corpo
+        void up(double out[3]) const
+        {
+            out[0] = 2.0 * (q[1] * q[3] - q[0] * q[2]);
+            out[1] = 2.0 * (q[0] * q[1] + q[2] * q[3]);
+            out[2] = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+        }
+
+        /// @brief Rotaciona a verdade por @p rate (rad/s, corpo) durante DT
+        void rotate(const double rate[3])
+        {
+            const double angle = std::sqrt(rate[0] * rate[0] + rate[1] * rate[1] + rate[2] * rate[2]) * DT;
+            if (angle == 0.0) return;
+            const double s = std::sin(angle / 2.0) / (angle / DT);
+            const double d[4] = {std::cos(angle / 2.0), rate[0] * s, rate[1] * s, rate[2] * s};
+            const double r[4] = {
+                q[0] * d[0] - q[1] * d[1] - q[2] * d[2] - q[3] * d[3],
+                q[0] * d[1] + q[1] * d[0] + q[2] * d[3] - q[3] * d[2],
+                q[0] * d[2] - q[1] * d[3] + q[2] * d[0] + q[3] * d[1],
+                q[0] * d[3] + q[1] * d[2] - q[2] * d[1] + q[3] * d[0],
+            };
+            for (int i = 0; i < 4; i++) q[i] = r[i];
+        }
+
+        /**
+         * @brief Um passo de 1 ms
+         * @param rate Velocidade angular verdadeira no corpo (rad/s)
+         * @param thrust Aceleração não gravitacional ao longo do eixo Z do corpo (m/s²)
+         * @param gravity Fração da gravidade que o acelerômetro mede (0 em queda livre)
+         */
+        void step(const double rate[3], double thrust = 0.0, double gravity = 1.0)
+        {
+            rotate(rate);
+            double v[3];
+            up(v);
+            float gyro[3], acc[3];
+            for (int i = 0; i < 3; i++) {
+                gyro[i] = static_cast<float>(rate[i] + bias[i] + noise.next(gyroNoise));
+                acc[i] = static_cast<float>(gravity * G * v[i] + (i == 2 ? thrust : 0.0) + noise.next(accNoise));
+            }
+            ahrs.update(gyro, acc, static_cast<float>(DT));
+        }
+
+        /// @brief Erro de inclinação atual (graus)
+        double tiltError() const
+        {
+            double truth[3];
+            up(truth);
+            float estimate[3];
+            ahrs.up(estimate);
+            // atan2(|t x e|, t . e) não perde precisão perto de zero nem
+            // depende de a estimativa em float ter norma exatamente 1
+            const double cross[3] = {truth[1] * estimate[2] - truth[2] * estimate[1],
+                                     truth[2] * estimate[0] - truth[0] * estimate[2],
+                                     truth[0] * estimate[1] - truth[1] * estimate[0]};
+            const double dot = truth[0] * estimate[0] + truth[1] * estimate[1] + truth[2] * estimate[2];
+            return std::atan2(std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]), dot) *
+                   DEG;
+        }
+
+        /// @brief Alinha o filtro pela primeira medida, como Fusion faz
+        void start()
+        {
+            double v[3];
+            up(v);
+            const float acc[3] = {static_cast<float>(G * v[0]), static_cast<float>(G * v[1]),
+                                  static_cast<float>(G * v[2])};
+            ahrs.align(acc);
+        }
+    };
+
+    const double STILL[3] = {0.0, 0.0, 0.0};
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/// @brief Parado e inclinado: o alinhamento já acerta a vertical
+void test_align_static_tilt()
+{
+    Replay r;
+    const double tilt[3] = {0.35, -0.2, 0.0};
+    for (int i = 0; i < 1000; i++) r.rotate(tilt);
+    r.start();
+    TEST_ASSERT_LESS_THAN_FLOAT(0.01, r.tiltError());
+
+    double worst = 0.0;
+    for (int i = 0; i < 10000; i++) {
+        r.step(STILL);
+        worst = std::fmax(worst, r.tiltError());
+    }
+    TEST_ASSERT_LESS_THAN_FLOAT(0.1, worst);
+}
+
+/// @brief Viés constante nos eixos horizontais converge e a inclinação não deriva
+void test_gyro_bias_converges()
+{
+    Replay r;
+    r.bias[0] = 0.02;   // ~1,1 °/s
+    r.bias[1] = -0.015;
+    r.start();
+
+    double worst = 0.0;
+    for (int i = 0; i < 120000; i++) {
+        r.step(STILL);
+        worst = std::fmax(worst, r.tiltError());
+    }
+    float bias[3];
+    r.ahrs.gyroBias(bias);
+    TEST_ASSERT_FLOAT_WITHIN(0.002, r.bias[0], bias[0]);
+    TEST_ASSERT_FLOAT_WITHIN(0.002, r.bias[1], bias[1]);
+    // Antes de o integrador convergir, o proporcional segura o erro em viés/kp
+    TEST_ASSERT_LESS_THAN_FLOAT(std::atan(0.025 / Config::Sensors::AHRS_KP) * DEG + 0.5, worst);
+    TEST_ASSERT_LESS_THAN_FLOAT(0.1, r.tiltError());
+}
+
+/// @brief Manobras rápidas nos três eixos, inclusive passando pela vertical
+void test_rotations_track_truth()
+{
+    Replay r;
+    r.bias[0] = 0.01;
+    r.start();
+
+    double worst = 0.0;
+    for (int i = 0; i < 20000; i++) {
+        const double t = i * DT;
+        const double rate[3] = {1.5 * std::sin(2.0 * M_PI * 0.3 * t), 1.0 * std::cos(2.0 * M_PI * 0.2 * t),
+                                2.0 * std::sin(2.0 * M_PI * 0.5 * t)};
+        r.step(rate);
+        worst = std::fmax(worst, r.tiltError());
+    }
+    TEST_ASSERT_LESS_THAN_FLOAT(1.5, worst);
+}
+
+/**
+ * @brief Perfil de foguete d'água: rampa, propulsão, voo quase vertical
+ *
+ * @details Na propulsão o acelerômetro mede 5 g e a correção tem de
+ * ficar desligada; com ela ligada a vertical seria puxada para o eixo do
+ * empuxo. Depois do corte o acelerômetro mede ~0 (queda livre) e o
+ * filtro continua só com o giroscópio.
+ */
+void test_boost_coasts_on_gyro()
+{
+    Replay r;
+    r.bias[0] = 0.01;
+    r.bias[1] = -0.01;
+    const double rampTilt[3] = {0.0, 0.26, 0.0};  // 15° de rampa
+    for (int i = 0; i < 1000; i++) r.rotate(rampTilt);
+    r.start();
+    for (int i = 0; i < 60000; i++) r.step(STILL);  // Espera na rampa: viés converge
+    const double beforeLaunch = r.tiltError();
+
+    double worst = 0.0;
+    for (int i = 0; i < 300; i++) {
+        const double pitchOver[3] = {0.3, -0.2, 6.0};  // Gira e arfa durante a propulsão
+        r.step(pitchOver, 4.0 * G);
+        worst = std::fmax(worst, r.tiltError());
+    }
+    for (int i = 0; i < 4000; i++) {
+        const double coast[3] = {0.05, 0.1, 3.0};
+        r.step(coast, 0.0, 0.0);  // Queda livre: o acelerômetro só vê ruído
+        worst = std::fmax(worst, r.tiltError());
+    }
+
+    TEST_ASSERT_LESS_THAN_FLOAT(0.3, beforeLaunch);
+    TEST_ASSERT_LESS_THAN_FLOAT(0.5, worst);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_align_static_tilt);
+    RUN_TEST(test_gyro_bias_converges);
+    RUN_TEST(test_rotations_track_truth);
+    RUN_TEST(test_boost_coasts_on_gyro);
+    return UNITY_END();
+}
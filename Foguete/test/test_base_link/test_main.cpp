@@ -0,0 +1,154 @@
+/**
+ * @file test_main.cpp
+ * @brief Filtro das mensagens da Base pelo remetente
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Roda no host: pio test -e native -f test_base_link
+ *
+ * A Base responde do seu MAC de estação, não do endereço de grupo da
+ * telemetria. O primeiro relatório ou pedido de arquivo fixa esse MAC;
+ * os relatórios seguintes devem chegar ao RateController e os pedidos
+ * e ACKs à fila do download, e os de outros rádios, não.
+ */
+
+#include <unity.h>
+
+#include <cstring>
+
+#include "BaseLink.h"
+#include "Config.h"
+#include "RateControl.h"
+#include "Telemetry.h"
+#include "Transfer.h"
+
+namespace
+{
+    const uint8_t BASE[6] = {0x24, 0x6F, 0x28, 0x11, 0x22, 0x33};
+    const uint8_t OTHER[6] = {0x24, 0x6F, 0x28, 0x44, 0x55, 0x66};
+
+    /// @brief Relatório como o montado pela Base
+    Telemetry::LinkReport report(uint32_t received, uint32_t lost)
+    {
+        Telemetry::LinkReport r = {};
+        r.version = Telemetry::LINK_REPORT_VERSION;
+        r.lastSequence = static_cast<uint16_t>(received + lost);
+        r.received = received;
+        r.lost = lost;
+        return r;
+    }
+
+    BaseLink::Route send(BaseLink &link, const uint8_t *mac, const Telemetry::LinkReport &r)
+    {
+        uint8_t bytes[sizeof(r)];
+        memcpy(bytes, &r, sizeof(r));
+        return link.receive(mac, bytes, sizeof(bytes));
+    }
+
+    /// @brief O que a transmissão faz a cada período
+    void drain(BaseLink &link, RateController &controller)
+    {
+        Telemetry::LinkReport r;
+        while (link.popReport(r)) controller.update(r.received, r.lost);
+    }
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_report_from_base_reaches_controller()
+{
+    BaseLink link;
+    RateController controller;
+    const uint32_t initial = controller.frameIntervalMs();
+
+    // Metade dos quadros perdida, janela após janela
+    uint32_t received = 0, lost = 0;
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL(BaseLink::REPORT, send(link, BASE, report(received, lost)));
+        drain(link, controller);
+        received += Config::RateControl::WINDOW / 2U;
+        lost += Config::RateControl::WINDOW / 2U;
+    }
+
+    TEST_ASSERT_TRUE(link.known());
+    TEST_ASSERT_EQUAL_MEMORY(BASE, link.address(), 6);
+    TEST_ASSERT_GREATER_THAN_UINT32(initial, controller.frameIntervalMs());
+    TEST_ASSERT_EQUAL_UINT8(50, controller.state().deliveryPct);
+}
+
+void test_report_from_other_radio_is_rejected()
+{
+    BaseLink link;
+    RateController controller;
+    TEST_ASSERT_EQUAL(BaseLink::REPORT, send(link, BASE, report(0, 0)));
+    drain(link, controller);
+    const uint32_t initial = controller.frameIntervalMs();
+
+    TEST_ASSERT_EQUAL(BaseLink::IGNORED, send(link, OTHER, report(0, 64)));
+    drain(link, controller);
+
+    TEST_ASSERT_EQUAL_UINT32(initial, controller.frameIntervalMs());
+    TEST_ASSERT_EQUAL_UINT32(1, link.rejected());
+    TEST_ASSERT_EQUAL_MEMORY(BASE, link.address(), 6);
+}
+
+void test_malformed_report_is_ignored()
+{
+    BaseLink link;
+    uint8_t bytes[sizeof(Telemetry::LinkReport)] = {};  // Versão errada
+    TEST_ASSERT_EQUAL(BaseLink::IGNORED, link.receive(BASE, bytes, sizeof(bytes)));
+    TEST_ASSERT_FALSE(link.known());
+    TEST_ASSERT_EQUAL(BaseLink::IGNORED, link.receive(BASE, bytes, 0));
+}
+
+void test_request_from_base_is_queued()
+{
+    BaseLink link;
+    const uint8_t request[2] = {Transfer::REQUEST, 7};
+    TEST_ASSERT_EQUAL(BaseLink::TRANSFER, link.receive(BASE, request, sizeof(request)));
+    TEST_ASSERT_TRUE(link.known());
+
+    const uint8_t ack[Transfer::MAX_CONTROL_BYTES] = {Transfer::ACK, 7};
+    TEST_ASSERT_EQUAL(BaseLink::TRANSFER, link.receive(BASE, ack, sizeof(ack)));
+
+    BaseLink::Message message;
+    TEST_ASSERT_TRUE(link.popTransfer(message));
+    TEST_ASSERT_EQUAL_UINT8(sizeof(request), message.length);
+    TEST_ASSERT_EQUAL_MEMORY(request, message.data, sizeof(request));
+    TEST_ASSERT_TRUE(link.popTransfer(message));
+    TEST_ASSERT_EQUAL_UINT8(sizeof(ack), message.length);
+    TEST_ASSERT_FALSE(link.popTransfer(message));
+
+    // Relatório da mesma Base segue aceito
+    TEST_ASSERT_EQUAL(BaseLink::REPORT, send(link, BASE, report(1, 0)));
+}
+
+void test_transfer_from_other_radio_is_rejected()
+{
+    BaseLink link;
+    const uint8_t request[2] = {Transfer::REQUEST, 1};
+    const uint8_t ack[2] = {Transfer::ACK, 1};
+
+    // Um ACK solto não apresenta a Base
+    TEST_ASSERT_EQUAL(BaseLink::IGNORED, link.receive(OTHER, ack, sizeof(ack)));
+    TEST_ASSERT_FALSE(link.known());
+
+    TEST_ASSERT_EQUAL(BaseLink::REPORT, send(link, BASE, report(0, 0)));
+    TEST_ASSERT_EQUAL(BaseLink::IGNORED, link.receive(OTHER, request, sizeof(request)));
+    TEST_ASSERT_EQUAL_UINT32(1, link.rejected());
+
+    BaseLink::Message message;
+    TEST_ASSERT_FALSE(link.popTransfer(message));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_report_from_base_reaches_controller);
+    RUN_TEST(test_report_from_other_radio_is_rejected);
+    RUN_TEST(test_malformed_report_is_ignored);
+    RUN_TEST(test_request_from_base_is_queued);
+    RUN_TEST(test_transfer_from_other_radio_is_rejected);
+    return UNITY_END();
+}
@@ -0,0 +1,110 @@
+/**
+ * @file test_main.cpp
+ * @brief Compensação inteira e leitura em rajada do BMP280
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Roda no host: pio test -e native -f test_bmp280
+ *
+ * Os valores esperados são o exemplo de cálculo do datasheet (seção
+ * 3.12), que também é o estado inicial do sensor emulado.
+ */
+
+#include <unity.h>
+
+#include <Bmp280Emulator.h>
+#include <Wire.h>
+
+#include "Bmp280.h"
+#include "Config.h"
+
+namespace
+{
+    TwoWire *wire;
+    Bmp280Emulator *sensor;
+    Bmp280 *bmp;
+}
+
+void setUp()
+{
+    wire = new TwoWire();
+    sensor = new Bmp280Emulator();
+    wire->attach(0x77, sensor);
+    bmp = new Bmp280(*wire);
+}
+
+void tearDown()
+{
+    delete bmp;
+    delete sensor;
+    delete wire;
+}
+
+/// @brief Só responde no endereço certo
+void test_begin_detects_address()
+{
+    TEST_ASSERT_FALSE(bmp->begin(0x76, 100));
+    TEST_ASSERT_TRUE(bmp->begin(0x77, 100));
+}
+
+/// @brief Exemplo do datasheet: 25,08 °C e 100653,27 Pa
+void test_datasheet_example()
+{
+    TEST_ASSERT_TRUE(bmp->begin(0x77, 100));
+    BaroSample s;
+    TEST_ASSERT_TRUE(bmp->read(s));
+    TEST_ASSERT_TRUE(s.fresh);
+    TEST_ASSERT_EQUAL_INT32(2508, s.temperature);
+    // O datasheet calcula o exemplo em ponto flutuante; a versão em 64 bits
+    // fica a 0,02 Pa (5 LSB em Q24.8) dele
+    TEST_ASSERT_UINT32_WITHIN(8, 25767236, s.pressure);
+}
+
+/// @brief Par bruto repetido não é conversão nova
+void test_repeated_reading_is_not_fresh()
+{
+    TEST_ASSERT_TRUE(bmp->begin(0x77, 100));
+    BaroSample s;
+    TEST_ASSERT_TRUE(bmp->read(s));
+    TEST_ASSERT_TRUE(bmp->read(s));
+    TEST_ASSERT_FALSE(s.fresh);
+
+    sensor->setRaw(Bmp280Emulator::EXAMPLE_ADC_T, Bmp280Emulator::EXAMPLE_ADC_P + 16);
+    TEST_ASSERT_TRUE(bmp->read(s));
+    TEST_ASSERT_TRUE(s.fresh);
+    TEST_ASSERT_LESS_THAN_UINT32(25767236, s.pressure);  // Mais contagens, menos pressão
+}
+
+/// @brief Standby escolhido para acompanhar o período de aquisição
+void test_begin_configures_standby()
+{
+    TEST_ASSERT_TRUE(bmp->begin(0x77, Config::Timing::SENSOR_READ_INTERVAL));
+    // 37,5 ms de conversão + 62,5 ms cabem nos 100 ms da aquisição
+    TEST_ASSERT_EQUAL_HEX8((0x01 << 5) | (0x04 << 2), sensor->registerValue(Bmp280Emulator::REG_CONFIG));
+    TEST_ASSERT_EQUAL_HEX8((0x02 << 5) | (0x05 << 2) | 0x03, sensor->registerValue(Bmp280Emulator::REG_CTRL_MEAS));
+    TEST_ASSERT_EQUAL_UINT32(100000, bmp->outputPeriodUs());
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(Config::Timing::SENSOR_READ_INTERVAL * 1000UL, bmp->outputPeriodUs());
+}
+
+/// @brief Maior standby cujo período de saída não passa do de aquisição
+void test_standby_for_periods()
+{
+    TEST_ASSERT_EQUAL(0, Bmp280::standbyFor(37500, 10000));    // Mais lento que a aquisição
+    TEST_ASSERT_EQUAL(0, Bmp280::standbyFor(37500, 99999));
+    TEST_ASSERT_EQUAL(1, Bmp280::standbyFor(37500, 100000));
+    TEST_ASSERT_EQUAL(1, Bmp280::standbyFor(37500, 162499));
+    TEST_ASSERT_EQUAL(2, Bmp280::standbyFor(37500, 162500));
+    TEST_ASSERT_EQUAL(4, Bmp280::standbyFor(37500, 1000000));
+    TEST_ASSERT_EQUAL(7, Bmp280::standbyFor(37500, 5000000));
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_begin_detects_address);
+    RUN_TEST(test_datasheet_example);
+    RUN_TEST(test_repeated_reading_is_not_fresh);
+    RUN_TEST(test_begin_configures_standby);
+    RUN_TEST(test_standby_for_periods);
+    return UNITY_END();
+}
@@ -0,0 +1,178 @@
+/**
+ * @file test_main.cpp
+ * @brief Decodificação e datação dos quadros do FIFO do MPU6050
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Roda no host: pio test -e native -f test_mpu6050_fifo
+ *
+ * O driver conversa com um MPU6050 emulado (test/hal/Mpu6050Emulator.h)
+ * pelo Wire.h simulado, sem nenhuma alteração no código do firmware.
+ */
+
+#include <unity.h>
+
+#include <Mpu6050Emulator.h>
+#include <Wire.h>
+
+#include "Config.h"
+#include "Mpu6050.h"
+
+namespace
+{
+    constexpr uint32_t PERIOD_US = 1000;
+
+    TwoWire *wire;
+    Mpu6050Emulator *sensor;
+    Mpu6050 *mpu;
+
+    /// @brief Quadro numerado: acc[0] = n identifica a ordem no FIFO
+    void pushNumbered(int16_t n)
+    {
+        const int16_t acc[3] = {n, static_cast<int16_t>(-n), 4096};
+        const int16_t gyro[3] = {static_cast<int16_t>(n * 2), -1, 0x7FFF};
+        sensor->pushFrame(acc, 1234, gyro);
+    }
+}
+
+void setUp()
+{
+    wire = new TwoWire();
+    sensor = new Mpu6050Emulator();
+    wire->attach(Mpu6050::DEFAULT_ADDRESS, sensor);
+    mpu = new Mpu6050(*wire);
+    TEST_ASSERT_TRUE(mpu->beginFifo(1000));
+}
+
+void tearDown()
+{
+    delete mpu;
+    delete sensor;
+    delete wire;
+}
+
+/// @brief Quadro big-endian na ordem acel., temperatura, giro
+void test_decode_layout()
+{
+    const uint8_t frame[Mpu6050::FRAME_SIZE] = {
+        0x01, 0x02, 0xFF, 0xFE, 0x80, 0x00,  // acc: 258, -2, -32768
+        0x0B, 0xB8,                          // temp: 3000
+        0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF,  // gyro: 32767, 0, -1
+    };
+    ImuSample s;
+    TEST_ASSERT_EQUAL(1, Mpu6050::decode(frame, sizeof(frame), &s, 1));
+    TEST_ASSERT_EQUAL_INT16(258, s.acc[0]);
+    TEST_ASSERT_EQUAL_INT16(-2, s.acc[1]);
+    TEST_ASSERT_EQUAL_INT16(-32768, s.acc[2]);
+    TEST_ASSERT_EQUAL_INT16(3000, s.temp);
+    TEST_ASSERT_EQUAL_INT16(32767, s.gyro[0]);
+    TEST_ASSERT_EQUAL_INT16(0, s.gyro[1]);
+    TEST_ASSERT_EQUAL_INT16(-1, s.gyro[2]);
+}
+
+/// @brief Quadro incompleto é ignorado e @p max limita a saída
+void test_decode_partial_and_max()
+{
+    uint8_t bytes[3 * Mpu6050::FRAME_SIZE + 5] = {};
+    for (size_t i = 0; i < 3; i++)
+        bytes[i * Mpu6050::FRAME_SIZE + 1] = static_cast<uint8_t>(i + 1);
+    ImuSample out[4];
+
+    TEST_ASSERT_EQUAL(3, Mpu6050::decode(bytes, sizeof(bytes), out, 4));
+    TEST_ASSERT_EQUAL_INT16(3, out[2].acc[0]);
+    TEST_ASSERT_EQUAL(2, Mpu6050::decode(bytes, sizeof(bytes), out, 2));
+    TEST_ASSERT_EQUAL(0, Mpu6050::decode(bytes, Mpu6050::FRAME_SIZE - 1, out, 4));
+}
+
+/// @brief Lote contínuo mantém o passo; desvio de mais de um período ressincroniza
+void test_stamp_continuity_and_resync()
+{
+    ImuSample s[4];
+    uint32_t lastUs = 0;
+
+    Mpu6050::stamp(s, 4, 10000, PERIOD_US, lastUs);
+    TEST_ASSERT_EQUAL_UINT32(7000, s[0].timestampUs);
+    TEST_ASSERT_EQUAL_UINT32(10000, lastUs);
+
+    // Âncora 300 µs adiantada: segue a sequência
+    Mpu6050::stamp(s, 2, 12300, PERIOD_US, lastUs);
+    TEST_ASSERT_EQUAL_UINT32(11000, s[0].timestampUs);
+    TEST_ASSERT_EQUAL_UINT32(12000, lastUs);
+
+    // Buraco de vários períodos: recomeça na âncora
+    Mpu6050::stamp(s, 2, 20000, PERIOD_US, lastUs);
+    TEST_ASSERT_EQUAL_UINT32(19000, s[0].timestampUs);
+    TEST_ASSERT_EQUAL_UINT32(20000, lastUs);
+}
+
+/// @brief Rajadas de I2C_BURST_BYTES preservam a ordem dos quadros
+void test_drain_all_in_bursts()
+{
+    const int16_t frames = 20;  // Mais de uma rajada de 120 bytes
+    for (int16_t i = 0; i < frames; i++)
+        pushNumbered(i);
+
+    ImuSample out[32];
+    TEST_ASSERT_EQUAL(frames, mpu->drainFifo(out, 32, 50000));
+    for (int16_t i = 0; i < frames; i++) {
+        TEST_ASSERT_EQUAL_INT16(i, out[i].acc[0]);
+        TEST_ASSERT_EQUAL_INT16(-i, out[i].acc[1]);
+        TEST_ASSERT_EQUAL_INT16(i * 2, out[i].gyro[0]);
+        TEST_ASSERT_EQUAL_INT16(1234, out[i].temp);
+    }
+    TEST_ASSERT_EQUAL_UINT32(50000, out[frames - 1].timestampUs);
+    TEST_ASSERT_EQUAL_UINT32(50000 - (frames - 1) * PERIOD_US, out[0].timestampUs);
+    TEST_ASSERT_EQUAL(0, sensor->fifoBytes());
+}
+
+/// @brief Com o dreno limitado, os quadros lidos são datados pelo que ficou no FIFO
+void test_drain_capped_keeps_timestamps()
+{
+    for (int16_t i = 0; i < 10; i++)
+        pushNumbered(i);
+
+    // O quadro 9 (o mais novo) foi amostrado em 100000 µs
+    ImuSample out[10];
+    TEST_ASSERT_EQUAL(4, mpu->drainFifo(out, 4, 100000));
+    for (int16_t i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_INT16(i, out[i].acc[0]);
+        TEST_ASSERT_EQUAL_UINT32(91000 + i * PERIOD_US, out[i].timestampUs);
+    }
+
+    // O resto sai no dreno seguinte, continuando a sequência
+    pushNumbered(10);
+    TEST_ASSERT_EQUAL(7, mpu->drainFifo(out, 10, 101000));
+    for (int16_t i = 0; i < 7; i++) {
+        TEST_ASSERT_EQUAL_INT16(i + 4, out[i].acc[0]);
+        TEST_ASSERT_EQUAL_UINT32(95000 + i * PERIOD_US, out[i].timestampUs);
+    }
+}
+
+/// @brief Estouro descarta o conteúdo desalinhado e reinicia o FIFO
+void test_overflow_resets_fifo()
+{
+    const size_t frames = Mpu6050Emulator::FIFO_CAPACITY / Mpu6050::FRAME_SIZE + 2;
+    for (size_t i = 0; i < frames; i++)
+        pushNumbered(static_cast<int16_t>(i));
+
+    ImuSample out[Config::Tasks::ACQUISITION_BATCH];
+    TEST_ASSERT_EQUAL(0, mpu->drainFifo(out, Config::Tasks::ACQUISITION_BATCH, 200000));
+    TEST_ASSERT_EQUAL_UINT32(1, mpu->overflows());
+    TEST_ASSERT_EQUAL(0, sensor->fifoBytes());
+
+    pushNumbered(7);
+    TEST_ASSERT_EQUAL(1, mpu->drainFifo(out, Config::Tasks::ACQUISITION_BATCH, 201000));
+    TEST_ASSERT_EQUAL_INT16(7, out[0].acc[0]);
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_decode_layout);
+    RUN_TEST(test_decode_partial_and_max);
+    RUN_TEST(test_stamp_continuity_and_resync);
+    RUN_TEST(test_drain_all_in_bursts);
+    RUN_TEST(test_drain_capped_keeps_timestamps);
+    RUN_TEST(test_overflow_resets_fifo);
+    return UNITY_END();
+}
@@ -0,0 +1,270 @@
+/**
+ * @file test_main.cpp
+ * @brief Decodificação UBX sobre um fluxo como o lido da UART do GPS
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Roda no host: pio test -e native -f test_ubx
+ *
+ * O fluxo reproduz o que os receptores mandam logo após a configuração:
+ * sentenças NMEA ainda não desligadas, quadros UBX de navegação, um ACK
+ * e ruído. É entregue ao decodificador em blocos de tamanhos variados,
+ * como as leituras da UART, de modo que os quadros caem ora inteiros
+ * num bloco, ora partidos entre dois.
+ */
+
+#include <unity.h>
+
+#include <cstring>
+#include <vector>
+
+#include "Ubx.h"
+
+namespace
+{
+    const char NMEA[] = "$GPGGA,123519.00,2330.0000,S,04637.0000,W,1,08,0.9,760.0,M,-5.0,M,,*4B\r\n";
+
+    /// @brief Fluxo de bytes montado quadro a quadro
+    struct Stream {
+        std::vector<uint8_t> bytes;
+
+        void text(const char *s)
+        {
+            bytes.insert(bytes.end(), s, s + strlen(s));
+        }
+
+        void ubx(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t len)
+        {
+            uint8_t frame[UbxParser::MAX_PAYLOAD + UbxParser::FRAME_OVERHEAD];
+            const size_t n = UbxParser::frame(msgClass, msgId, payload, len, frame);
+            bytes.insert(bytes.end(), frame, frame + n);
+        }
+    };
+
+    void put16(uint8_t *p, uint16_t v)
+    {
+        p[0] = static_cast<uint8_t>(v);
+        p[1] = static_cast<uint8_t>(v >> 8);
+    }
+
+    void put32(uint8_t *p, int32_t v)
+    {
+        for (int i = 0; i < 4; i++) p[i] = static_cast<uint8_t>(static_cast<uint32_t>(v) >> (8 * i));
+    }
+
+    /// @brief NAV-PVT de @p len bytes (84 no u-blox 7, 92 no M8)
+    void pvt(uint8_t *p, uint16_t len, uint8_t fixType)
+    {
+        memset(p, 0, len);
+        put32(p, 345600000);          // iTOW
+        put16(p + 4, 2026);
+        p[6] = 10;
+        p[7] = 16;
+        p[8] = 12;
+        p[9] = 35;
+        p[10] = 19;
+        p[11] = 0x07;                 // valid: data, hora e resolvido
+        p[20] = fixType;
+        p[21] = 0x01;                 // gnssFixOK
+        p[23] = 9;                    // numSV
+        put32(p + 24, -466166667);    // lon
+        put32(p + 28, -235000000);    // lat
+        put32(p + 32, 755000);        // height (elipsoide)
+        put32(p + 36, 760250);        // hMSL
+    }
+
+    /// @brief NAV-DOP com HDOP de @p hdop centésimos
+    void dop(Stream &s, uint16_t hdop)
+    {
+        uint8_t p[18] = {};
+        put16(p + 12, hdop);
+        s.ubx(UbxParser::CLASS_NAV, UbxParser::NAV_DOP, p, sizeof(p));
+    }
+
+    /// @brief Entrega o fluxo em blocos de 1 a 61 bytes, como a UART
+    void feedChunked(UbxParser &parser, const std::vector<uint8_t> &bytes)
+    {
+        size_t i = 0, chunk = 1;
+        while (i < bytes.size()) {
+            const size_t n = bytes.size() - i < chunk ? bytes.size() - i : chunk;
+            parser.feed(bytes.data() + i, n);
+            i += n;
+            chunk = (chunk * 7 + 3) % 61 + 1;
+        }
+    }
+
+    void assertFix(const GPSData &fix, uint8_t satellites, float hdop)
+    {
+        TEST_ASSERT_EQUAL_INT(2026, fix.year);
+        TEST_ASSERT_EQUAL_INT(10, fix.month);
+        TEST_ASSERT_EQUAL_INT(16, fix.day);
+        TEST_ASSERT_EQUAL_INT(12, fix.hour);
+        TEST_ASSERT_EQUAL_INT(35, fix.minute);
+        TEST_ASSERT_EQUAL_INT(19, fix.second);
+        TEST_ASSERT_FLOAT_WITHIN(1e-6, -23.5, fix.latitude);
+        TEST_ASSERT_FLOAT_WITHIN(1e-6, -46.6166667, fix.longitude);
+        TEST_ASSERT_FLOAT_WITHIN(1e-3, 760.25, fix.altitude);
+        TEST_ASSERT_EQUAL_INT(satellites, fix.satellites);
+        TEST_ASSERT_FLOAT_WITHIN(1e-4, hdop, fix.hdop);
+    }
+}
+
+void setUp()
+{
+}
+
+void tearDown()
+{
+}
+
+/// @brief NAV-PVT do M8 (92 bytes) no meio de NMEA, em blocos variados
+void test_pvt_m8()
+{
+    Stream s;
+    uint8_t p[92];
+    s.text(NMEA);
+    dop(s, 120);
+    pvt(p, sizeof(p), 3);
+    s.ubx(UbxParser::CLASS_NAV, UbxParser::NAV_PVT, p, sizeof(p));
+    s.text(NMEA);
+
+    UbxParser parser;
+    feedChunked(parser, s.bytes);
+    GPSData fix;
+    TEST_ASSERT_TRUE(parser.takeFix(fix));
+    assertFix(fix, 9, 1.2f);
+    TEST_ASSERT_FALSE(parser.takeFix(fix));
+    TEST_ASSERT_EQUAL_UINT32(2, parser.frames());
+    TEST_ASSERT_EQUAL_UINT32(0, parser.errors());
+}
+
+/// @brief NAV-PVT do u-blox 7 tem 84 bytes e traz os mesmos campos
+void test_pvt_ublox7()
+{
+    Stream s;
+    uint8_t p[84];
+    dop(s, 95);
+    pvt(p, sizeof(p), 3);
+    s.ubx(UbxParser::CLASS_NAV, UbxParser::NAV_PVT, p, sizeof(p));
+
+    UbxParser parser;
+    feedChunked(parser, s.bytes);
+    GPSData fix;
+    TEST_ASSERT_TRUE(parser.takeFix(fix));
+    assertFix(fix, 9, 0.95f);
+}
+
+/// @brief Sem fix (tipo 0 ou 5, só tempo) não publica posição
+void test_pvt_without_position()
+{
+    Stream s;
+    uint8_t p[92];
+    pvt(p, sizeof(p), 0);
+    s.ubx(UbxParser::CLASS_NAV, UbxParser::NAV_PVT, p, sizeof(p));
+    pvt(p, sizeof(p), 5);
+    s.ubx(UbxParser::CLASS_NAV, UbxParser::NAV_PVT, p, sizeof(p));
+
+    UbxParser parser;
+    feedChunked(parser, s.bytes);
+    GPSData fix;
+    TEST_ASSERT_FALSE(parser.takeFix(fix));
+    TEST_ASSERT_EQUAL_UINT32(2, parser.frames());
+}
+
+/// @brief NEO-6: POSLLH + SOL + TIMEUTC da mesma época formam um fix
+void test_neo6_epoch()
+{
+    Stream s;
+    dop(s, 150);
+
+    uint8_t posllh[28] = {};
+    put32(posllh, 345600000);
+    put32(posllh + 4, -466166667);
+    put32(posllh + 8, -235000000);
+    put32(posllh + 16, 760250);
+    s.ubx(UbxParser::CLASS_NAV, UbxParser::NAV_POSLLH, posllh, sizeof(posllh));
+
+    uint8_t sol[52] = {};
+    put32(sol, 345600000);
+    sol[10] = 3;
+    sol[11] = 0x01;
+    sol[47] = 7;
+    s.ubx(UbxParser::CLASS_NAV, UbxParser::NAV_SOL, sol, sizeof(sol));
+
+    uint8_t utc[20] = {};
+    put32(utc, 345600000);
+    put16(utc + 12, 2026);
+    utc[14] = 10;
+    utc[15] = 16;
+    utc[16] = 12;
+    utc[17] = 35;
+    utc[18] = 19;
+
+    UbxParser parser;
+    feedChunked(parser, s.bytes);
+    GPSData fix;
+    TEST_ASSERT_FALSE(parser.takeFix(fix));  // Falta o TIMEUTC da época
+
+    Stream rest;
+    rest.ubx(UbxParser::CLASS_NAV, UbxParser::NAV_TIMEUTC, utc, sizeof(utc));
+    feedChunked(parser, rest.bytes);
+    TEST_ASSERT_TRUE(parser.takeFix(fix));
+    assertFix(fix, 7, 1.5f);
+}
+
+/// @brief Byte corrompido descarta só o quadro afetado; o seguinte passa
+void test_corrupted_frame_resyncs()
+{
+    Stream s;
+    uint8_t p[92];
+    pvt(p, sizeof(p), 3);
+    s.ubx(UbxParser::CLASS_NAV, UbxParser::NAV_PVT, p, sizeof(p));
+    s.bytes[40] ^= 0x10;
+    const uint8_t ack[2] = {UbxParser::CLASS_CFG, UbxParser::CFG_RATE};
+    s.ubx(UbxParser::CLASS_ACK, UbxParser::ACK_ACK, ack, sizeof(ack));
+
+    UbxParser parser;
+    feedChunked(parser, s.bytes);
+    GPSData fix;
+    TEST_ASSERT_FALSE(parser.takeFix(fix));
+    UbxParser::Ack reply;
+    TEST_ASSERT_TRUE(parser.takeAck(reply));
+    TEST_ASSERT_EQUAL_HEX8(UbxParser::CLASS_CFG, reply.msgClass);
+    TEST_ASSERT_EQUAL_HEX8(UbxParser::CFG_RATE, reply.msgId);
+    TEST_ASSERT_TRUE(reply.accepted);
+    TEST_ASSERT_EQUAL_UINT32(1, parser.errors());
+}
+
+/// @brief O mesmo fluxo dá o mesmo resultado inteiro num bloco ou byte a byte
+void test_whole_and_bytewise_agree()
+{
+    Stream s;
+    uint8_t p[84];
+    s.text(NMEA);
+    dop(s, 80);
+    pvt(p, sizeof(p), 3);
+    s.ubx(UbxParser::CLASS_NAV, UbxParser::NAV_PVT, p, sizeof(p));
+
+    UbxParser whole, bytewise;
+    whole.feed(s.bytes.data(), s.bytes.size());
+    for (uint8_t b : s.bytes) bytewise.feed(&b, 1);
+
+    GPSData a, b;
+    TEST_ASSERT_TRUE(whole.takeFix(a));
+    TEST_ASSERT_TRUE(bytewise.takeFix(b));
+    assertFix(a, 9, 0.8f);
+    assertFix(b, 9, 0.8f);
+    TEST_ASSERT_EQUAL_UINT32(whole.frames(), bytewise.frames());
+}
+
+int main()
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_pvt_m8);
+    RUN_TEST(test_pvt_ublox7);
+    RUN_TEST(test_pvt_without_position);
+    RUN_TEST(test_neo6_epoch);
+    RUN_TEST(test_corrupted_frame_resyncs);
+    RUN_TEST(test_whole_and_bytewise_agree);
+    return UNITY_END();
+}
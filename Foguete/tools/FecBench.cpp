@@ -0,0 +1,274 @@
+/**
+ * @file FecBench.cpp
+ * @brief Simulação no host da paridade XOR entre quadros (Fec.h) sob perdas
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Não faz parte do firmware. Compilação e uso, a partir de Foguete/:
+ *
+ *     g++ -std=gnu++11 -O2 -Iinclude tools/FecBench.cpp src/Telemetry.cpp src/Fec.cpp -o fec_bench
+ *     ./fec_bench [perda_%] [rajada_media]
+ *
+ * O canal segue o modelo de Gilbert-Elliott: no estado bom nenhum quadro
+ * se perde, no ruim todos se perdem, e as transições são escolhidas para
+ * dar a perda média e o comprimento médio de rajada pedidos (rajada 1 é
+ * perda de Bernoulli). Sem argumentos, percorre uma grade de cenários.
+ *
+ * Para cada grupo K (0 = sem FEC) imprime a fração de quadros e de
+ * amostras que chegam ao decodificador de fluxo, o custo em bytes da
+ * paridade e o atraso que a espera pela paridade acrescenta à entrega.
+ *
+ * Todo quadro entregue, recebido ou reconstruído pela paridade, é
+ * comparado byte a byte com o que o transmissor enviou com a mesma
+ * sequência; qualquer diferença é impressa e faz o programa sair com
+ * código 1.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "Config.h"
+#include "Fec.h"
+#include "Telemetry.h"
+
+namespace
+{
+    /// @brief Gerador determinístico (LCG)
+    struct Random {
+        uint32_t seed;
+
+        explicit Random(uint32_t s) : seed(s) {}
+
+        double uniform()
+        {
+            seed = seed * 1664525U + 1013904223U;
+            return static_cast<double>(seed >> 8) / 16777216.0;
+        }
+    };
+
+    /// @brief Canal de Gilbert-Elliott com perda total no estado ruim
+    class Channel
+    {
+    public:
+        Channel(double loss, double burst, uint32_t seed)
+            : random_(seed)
+        {
+            leave_ = 1.0 / (burst < 1.0 ? 1.0 : burst);
+            enter_ = loss >= 1.0 ? 1.0 : loss * leave_ / (1.0 - loss);
+        }
+
+        /// @retval true O próximo quadro se perde
+        bool lose()
+        {
+            bad_ = bad_ ? random_.uniform() >= leave_ : random_.uniform() < enter_;
+            return bad_;
+        }
+
+    private:
+        Random random_;
+        double enter_;
+        double leave_;
+        bool bad_ = false;
+    };
+
+    /// @brief Amostras sintéticas com variação suave e ruído, na cadência da telemetria
+    std::vector<SensorData> syntheticSamples(size_t count, uint32_t periodUs)
+    {
+        Random random(4242U);
+        std::vector<SensorData> samples(count);
+        for (size_t i = 0; i < count; i++) {
+            const float t = static_cast<float>(i) * static_cast<float>(periodUs) * 1e-6f;
+            const float noise = static_cast<float>(random.uniform()) - 0.5f;
+            SensorData &s = samples[i];
+            s = SensorData();
+            s.timestampUs = 1000000U + static_cast<uint32_t>(i) * periodUs;
+            s.phase = static_cast<uint8_t>((i / 2000) % 6);
+            s.acelerometro.accX = 0.5f * sinf(t) + 0.04f * noise;
+            s.acelerometro.accY = 0.3f * cosf(0.7f * t) + 0.04f * noise;
+            s.acelerometro.accZ = 9.8f + 2.0f * sinf(0.2f * t) + 0.04f * noise;
+            s.acelerometro.gyroX = 0.2f * sinf(1.3f * t);
+            s.acelerometro.gyroY = 0.01f * noise;
+            s.acelerometro.gyroZ = 1.5f * cosf(0.4f * t);
+            s.acelerometro.temp = 25.0f;
+            s.acelerometro.pitch = 45.0f + 40.0f * sinf(0.05f * t);
+            s.acelerometro.roll = 5.0f * noise;
+            s.altimetro.pressure = 1013.25f - 5.0f * (1.0f - cosf(0.03f * t));
+            s.tensao.voltage_rocket = 7.4f;
+            s.gps.fixAge = 0xFFFFFFFFUL;
+        }
+        return samples;
+    }
+
+    /// @brief Um quadro no ar: dados ou paridade, com o instante de envio
+    struct Sent {
+        std::vector<uint8_t> bytes;
+        uint32_t sentMs;
+    };
+
+    /// @brief Quadros gerados pelo transmissor com FEC em grupos de @p group
+    struct Transmission {
+        std::vector<Sent> frames;
+        size_t dataBytes = 0;
+        size_t parityBytes = 0;
+        size_t dataFrames = 0;
+        size_t samples = 0;
+    };
+
+    /// @brief Reproduz Pipeline::transmit(): um quadro por período, mais a paridade
+    Transmission transmit(const std::vector<SensorData> &samples, size_t perPeriod, uint8_t group)
+    {
+        Transmission out;
+        Telemetry::StreamEncoder encoder(Config::EspNow::KEYFRAME_INTERVAL, group);
+        Telemetry::FecEncoder fec(group);
+        uint8_t frame[Telemetry::MAX_FRAME_BYTES];
+        uint8_t parity[Telemetry::MAX_FRAME_BYTES];
+
+        size_t next = 0;
+        size_t pending = 0;
+        uint32_t nowMs = 0;
+        while (next < samples.size() || pending > 0) {
+            size_t arrived = samples.size() - next < perPeriod ? samples.size() - next : perPeriod;
+            pending += arrived;
+            next += arrived;
+
+            size_t packed = 0;
+            size_t length = encoder.encode(&samples[next - pending], pending, frame, packed);
+            pending -= packed;
+            out.frames.push_back(Sent{std::vector<uint8_t>(frame, frame + length), nowMs});
+            out.dataBytes += length;
+            out.dataFrames++;
+            out.samples += packed;
+
+            size_t parityLength = 0;
+            if (fec.add(frame, length, parity, parityLength)) {
+                out.frames.push_back(Sent{std::vector<uint8_t>(parity, parity + parityLength), nowMs});
+                out.parityBytes += parityLength;
+            }
+            nowMs += Config::Timing::TRANSMISSION_INTERVAL;
+        }
+        return out;
+    }
+
+    /// @brief Estado da recepção compartilhado com o sink do FecDecoder
+    struct Receiver {
+        const std::vector<const Sent *> *original;  ///< Quadro de dados enviado, por sequência
+        Telemetry::StreamDecoder decoder;
+        SensorData out[Telemetry::MAX_FRAME_SAMPLES];
+        std::vector<uint32_t> sentMs;  ///< Instante de envio por sequência
+        uint32_t nowMs = 0;
+        size_t frames = 0;
+        size_t samples = 0;
+        double delaySumMs = 0.0;
+        uint32_t delayMaxMs = 0;
+        size_t mismatches = 0;
+    };
+
+    void deliver(const uint8_t *frame, size_t len, void *context)
+    {
+        Receiver &rx = *static_cast<Receiver *>(context);
+        uint16_t sequence;
+        if (!Telemetry::sequenceOf(frame, len, sequence)) return;
+
+        const Sent *sent = (*rx.original)[sequence];
+        if (sent == nullptr || sent->bytes.size() != len || memcmp(sent->bytes.data(), frame, len) != 0) {
+            rx.mismatches++;
+            return;
+        }
+
+        // Atraso em relação ao instante em que o quadro teria chegado sem FEC
+        uint32_t delay = rx.nowMs - rx.sentMs[sequence];
+        rx.delaySumMs += delay;
+        if (delay > rx.delayMaxMs) rx.delayMaxMs = delay;
+        rx.frames++;
+        rx.samples += rx.decoder.decode(frame, len, rx.out, Telemetry::MAX_FRAME_SAMPLES);
+    }
+
+    /// @brief Resultado de um cenário
+    struct Result {
+        double frames;   ///< Fração de quadros de dados entregues
+        double samples;  ///< Fração de amostras decodificadas
+        double overhead; ///< Bytes de paridade / bytes de dados
+        double delayMeanMs;
+        uint32_t delayMaxMs;
+        uint32_t recovered;
+        size_t mismatches;  ///< Quadros entregues diferentes do original
+    };
+
+    Result simulate(const Transmission &tx, double loss, double burst, uint32_t seed)
+    {
+        Receiver rx;
+        rx.sentMs.assign(65536, 0);
+        std::vector<const Sent *> original(65536, nullptr);
+        rx.original = &original;
+        Telemetry::FecDecoder fec(deliver, &rx);
+        Channel channel(loss, burst, seed);
+
+        for (const Sent &f : tx.frames) {
+            uint16_t sequence;
+            if (Telemetry::sequenceOf(f.bytes.data(), f.bytes.size(), sequence)) {
+                rx.sentMs[sequence] = f.sentMs;
+                original[sequence] = &f;
+            }
+            if (channel.lose()) continue;
+            rx.nowMs = f.sentMs;
+            fec.push(f.bytes.data(), f.bytes.size());
+        }
+        fec.flush();
+
+        Result r;
+        r.frames = static_cast<double>(rx.frames) / static_cast<double>(tx.dataFrames);
+        r.samples = static_cast<double>(rx.samples) / static_cast<double>(tx.samples);
+        r.overhead = static_cast<double>(tx.parityBytes) / static_cast<double>(tx.dataBytes);
+        r.delayMeanMs = rx.frames ? rx.delaySumMs / static_cast<double>(rx.frames) : 0.0;
+        r.delayMaxMs = rx.delayMaxMs;
+        r.recovered = fec.stats().recovered;
+        r.mismatches = rx.mismatches;
+        return r;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const uint32_t periodUs = Config::Timing::TELEMETRY_SAMPLE_INTERVAL * 1000UL;
+    const size_t perPeriod = Config::Timing::TRANSMISSION_INTERVAL / Config::Timing::TELEMETRY_SAMPLE_INTERVAL;
+    // Nem a sequência (16 bits) nem timestampUs (32 bits, µs) dão a volta
+    const std::vector<SensorData> samples = syntheticSamples(perPeriod * 8000U, periodUs);
+
+    std::vector<double> losses = {0.01, 0.05, 0.10, 0.20};
+    std::vector<double> bursts = {1.0, 2.0, 4.0};
+    if (argc > 1) losses = {atof(argv[1]) / 100.0};
+    if (argc > 2) bursts = {atof(argv[2])};
+
+    const uint8_t groups[] = {0, 2, 4, 8};
+    Transmission tx[sizeof(groups)];
+    for (size_t g = 0; g < sizeof(groups); g++)
+        tx[g] = transmit(samples, perPeriod, groups[g]);
+
+    printf("%zu amostras, %zu por quadro de %u ms, keyframe a cada %u quadros\n\n",
+           samples.size(), perPeriod, (unsigned)Config::Timing::TRANSMISSION_INTERVAL,
+           (unsigned)Config::EspNow::KEYFRAME_INTERVAL);
+    printf("%6s %6s %3s %9s %9s %9s %10s %9s %9s\n",
+           "perda", "rajada", "K", "quadros", "amostras", "custo", "recuperad", "atraso", "max");
+    size_t mismatches = 0;
+    for (double loss : losses) {
+        for (double burst : bursts) {
+            for (size_t g = 0; g < sizeof(groups); g++) {
+                Result r = simulate(tx[g], loss, burst, 777U);
+                printf("%5.1f%% %6.1f %3u %8.2f%% %8.2f%% %8.1f%% %10lu %6.0f ms %6lu ms\n",
+                       loss * 100.0, burst, (unsigned)groups[g], r.frames * 100.0, r.samples * 100.0,
+                       r.overhead * 100.0, (unsigned long)r.recovered, r.delayMeanMs,
+                       (unsigned long)r.delayMaxMs);
+                if (r.mismatches > 0) {
+                    printf("       %lu quadros entregues diferem do original\n", (unsigned long)r.mismatches);
+                    mismatches += r.mismatches;
+                }
+            }
+            printf("\n");
+        }
+    }
+    printf("%s\n", mismatches == 0 ? "Quadros entregues identicos aos enviados" : "FALHA: quadros corrompidos");
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,294 @@
+/**
+ * @file FlightTrace.cpp
+ * @brief Reproduz um voo na detecção de fases (FlightState.cpp) no host
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Não faz parte do firmware. Compilação e uso, a partir de Foguete/:
+ *
+ *     pio run -e native_flight -t exec
+ *
+ * ou, sem o PlatformIO:
+ *
+ *     g++ -std=gnu++11 -O2 -Iinclude tools/FlightTrace.cpp src/FlightState.cpp -o flight_trace
+ *     ./flight_trace [flight_log_000001.bin] [-csv]
+ *
+ * Com um arquivo do gravador de voo (Recorder.h), converte cada
+ * FlightRecord com as escalas do cabeçalho, reconstrói a vertical a
+ * partir de pitch e roll e alimenta um FlightDetector novo. Imprime os
+ * eventos detectados ao lado das mudanças de fase gravadas pelo foguete,
+ * o que permite reajustar os limiares de Config::Flight sobre voos reais.
+ * Com -csv, imprime também a altitude e a velocidade estimadas a cada
+ * amostra.
+ *
+ * Sem arquivo, sintetiza no mesmo formato um voo de foguete d'água com
+ * trajetória conhecida (rampa a 600 m, 0,3 s de propulsão, subida
+ * balística, descida de paraquedas) e confere cada evento com a verdade;
+ * sai com código 1 se algum faltar ou sair da tolerância. O pouso tem
+ * tolerância larga: o impacto faz o estimador oscilar por ~1,5 s antes
+ * de a velocidade ficar abaixo de LANDED_SPEED.
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "Config.h"
+#include "FlightState.h"
+#include "Recorder.h"
+
+namespace
+{
+    /// @brief Voo completo: cabeçalho e amostras
+    struct Trace {
+        RecorderHeader header;
+        std::vector<FlightRecord> records;
+    };
+
+    /// @brief Instantes e valores verdadeiros do voo sintético
+    struct Truth {
+        uint32_t launchUs;
+        uint32_t burnoutUs;
+        uint32_t apogeeUs;
+        uint32_t landingUs;
+        float apogeeM;
+    };
+
+    const char *phaseName(FlightPhase phase)
+    {
+        switch (phase) {
+            case FlightPhase::PAD:     return "rampa";
+            case FlightPhase::BOOST:   return "propulsao";
+            case FlightPhase::COAST:   return "subida";
+            case FlightPhase::APOGEE:  return "apogeu";
+            case FlightPhase::DESCENT: return "descida";
+            case FlightPhase::LANDED:  return "pouso";
+            default:                   return "?";
+        }
+    }
+
+    bool load(const char *path, Trace &trace)
+    {
+        FILE *file = fopen(path, "rb");
+        if (file == nullptr) return false;
+        bool ok = fread(&trace.header, sizeof(trace.header), 1, file) == 1 &&
+                  trace.header.magic == RECORDER_MAGIC && trace.header.recordBytes == RECORD_BYTES;
+        FlightRecord record;
+        while (ok && fread(&record, sizeof(record), 1, file) == 1)
+            trace.records.push_back(record);
+        fclose(file);
+        return ok;
+    }
+
+    /// @brief Altitude padrão a partir da pressão, como em Fusion::update()
+    float altitudeOf(uint32_t pressureQ8)
+    {
+        const float hPa = static_cast<float>(pressureQ8) / 25600.0f;
+        return 44330.0f * (1.0f - powf(hPa / Config::Sensors::SEA_LEVEL_PRESSURE, 0.1903f));
+    }
+
+    /// @brief Inverso de altitudeOf(), em Pa Q24.8
+    uint32_t pressureOf(double altitudeM)
+    {
+        const double hPa = Config::Sensors::SEA_LEVEL_PRESSURE * pow(1.0 - altitudeM / 44330.0, 1.0 / 0.1903);
+        return static_cast<uint32_t>(hPa * 25600.0 + 0.5);
+    }
+
+    /**
+     * @brief Voo vertical sintético a 1 kHz
+     *
+     * @details O corpo fica na vertical (pitch e roll zero), então o
+     * acelerômetro mede a força específica só no eixo Z. A primeira
+     * conversão do barômetro chega 50 ms depois da primeira amostra.
+     */
+    Truth synthesize(Trace &trace)
+    {
+        constexpr double G = Config::Sensors::GRAVITY;
+        constexpr double DT = 0.001;
+        constexpr double GROUND_M = 600.0;
+        constexpr double BOOST_ACC = 60.0;  // m/s², 7,1 g medidos: dentro dos ±8 g
+        constexpr double BOOST_S = 0.3;
+        constexpr double CHUTE_SPEED = -5.0;
+        const uint32_t startUs = 5000000U;
+        const uint32_t launchUs = startUs + 2000000U;
+
+        memset(&trace.header, 0, sizeof(trace.header));
+        trace.header.magic = RECORDER_MAGIC;
+        trace.header.recordBytes = RECORD_BYTES;
+        trace.header.sampleRate = 1000;
+        trace.header.accelLsbPerG = Config::Sensors::ACCEL_LSB_PER_G;
+        trace.header.gyroLsbPerDps = Config::Sensors::GYRO_LSB_PER_DPS;
+        trace.header.startUs = startUs;
+
+        Truth truth = {};
+        truth.launchUs = launchUs;
+        double height = 0.0, speed = 0.0;
+        uint32_t noise = 1U;
+        bool flying = false;
+        uint32_t stillSince = 0;
+
+        for (uint32_t i = 0;; i++) {
+            const uint32_t nowUs = startUs + i * 1000U;
+            double acc = 0.0;  // Aceleração verdadeira, sem a gravidade
+            double specific = G;
+
+            if (nowUs >= launchUs && nowUs < launchUs + static_cast<uint32_t>(BOOST_S * 1e6)) {
+                flying = true;
+                acc = BOOST_ACC;
+                specific = G + BOOST_ACC;
+            } else if (flying && speed > CHUTE_SPEED) {
+                acc = -G;  // Balístico até o paraquedas abrir
+                specific = 0.0;
+            } else if (flying && height > 0.0) {
+                acc = 0.0;  // Paraquedas: velocidade constante
+                speed = CHUTE_SPEED;
+                specific = G;
+            } else if (flying) {
+                flying = false;
+                height = speed = 0.0;
+                truth.landingUs = nowUs;
+                stillSince = nowUs;
+            }
+
+            const double previous = speed;
+            height += speed * DT + 0.5 * acc * DT * DT;
+            speed += acc * DT;
+            if (nowUs >= launchUs && truth.burnoutUs == 0 && acc < 0.0) truth.burnoutUs = nowUs;
+            if (previous > 0.0 && speed <= 0.0) {
+                truth.apogeeUs = nowUs;
+                truth.apogeeM = static_cast<float>(height);
+            }
+
+            FlightRecord r;
+            memset(&r, 0, sizeof(r));
+            r.timestampUs = nowUs;
+            r.acc[2] = static_cast<int16_t>(lround(specific / G * Config::Sensors::ACCEL_LSB_PER_G));
+            r.phase = static_cast<uint8_t>(FlightPhase::PAD);
+            if (i % 100 == 50) {
+                // Ruído de ±0,3 m no barômetro
+                noise = noise * 1664525U + 1013904223U;
+                const double baroNoise = (static_cast<double>(noise >> 8) / 16777216.0 - 0.5) * 0.6;
+                r.flags = RECORD_BARO_FRESH;
+                r.pressure = pressureOf(GROUND_M + height + baroNoise);
+            } else {
+                r.pressure = trace.records.empty() ? 0 : trace.records.back().pressure;
+            }
+            trace.records.push_back(r);
+
+            if (stillSince != 0 && nowUs - stillSince > 5000000U) break;
+        }
+        return truth;
+    }
+
+    /// @brief Evento detectado, para a conferência do voo sintético
+    struct Detected {
+        FlightPhase phase;
+        uint32_t timestampUs;
+        float altitude;
+        float speed;
+    };
+
+    /// @brief Alimenta o detector com o voo e imprime os eventos
+    std::vector<Detected> replay(const Trace &trace, bool csv)
+    {
+        const float accScale = Config::Sensors::GRAVITY / trace.header.accelLsbPerG;
+        const float centiDegToRad = 3.14159265f / 18000.0f;
+        FlightDetector detector;
+        std::vector<Detected> detected;
+        uint8_t recordedPhase = static_cast<uint8_t>(FlightPhase::PAD);
+        float lastAltitude = 0.0f;
+        float maxAltitude = 0.0f;
+
+        if (csv) printf("tempo_s,fase,altitude_m,velocidade_ms,baro_m\n");
+        for (const FlightRecord &r : trace.records) {
+            const float acc[3] = {r.acc[0] * accScale, r.acc[1] * accScale, r.acc[2] * accScale};
+            // Inverso de Ahrs::angles(): pitch = atan2(vy, hypot(vx, vz)), roll = atan2(-vx, vz)
+            const float pitch = r.pitch * centiDegToRad, roll = r.roll * centiDegToRad;
+            const float up[3] = {-sinf(roll) * cosf(pitch), sinf(pitch), cosf(roll) * cosf(pitch)};
+            const bool fresh = (r.flags & RECORD_BARO_FRESH) != 0;
+            if (fresh) lastAltitude = altitudeOf(r.pressure);
+
+            FlightEvent event;
+            if (detector.update(r.timestampUs, acc, up, lastAltitude, fresh, event)) {
+                detected.push_back({event.phase, event.timestampUs, event.altitude, event.verticalSpeed});
+                if (!csv) {
+                    printf("%10.3f s  detectado %-9s altitude=%7.2f m velocidade=%7.2f m/s\n",
+                           (event.timestampUs - trace.header.startUs) / 1e6, phaseName(event.phase),
+                           event.altitude, event.verticalSpeed);
+                }
+            }
+            if (r.phase != recordedPhase && !csv) {
+                printf("%10.3f s  gravado   %s\n", (r.timestampUs - trace.header.startUs) / 1e6,
+                       phaseName(static_cast<FlightPhase>(r.phase)));
+            }
+            recordedPhase = r.phase;
+            if (detector.maxAltitude() > maxAltitude) maxAltitude = detector.maxAltitude();
+
+            if (csv) {
+                printf("%.3f,%s,%.3f,%.3f,%.3f\n", (r.timestampUs - trace.header.startUs) / 1e6,
+                       phaseName(detector.phase()), detector.altitude(), detector.verticalSpeed(), lastAltitude);
+            }
+        }
+        if (!csv) printf("altitude maxima estimada: %.2f m\n", maxAltitude);
+        return detected;
+    }
+
+    /// @brief Confere um evento: presente e a no máximo @p toleranceUs da verdade
+    bool check(const std::vector<Detected> &detected, FlightPhase phase, uint32_t truthUs, uint32_t toleranceUs,
+               uint32_t startUs)
+    {
+        for (const Detected &d : detected) {
+            if (d.phase != phase) continue;
+            const int32_t error = static_cast<int32_t>(d.timestampUs - truthUs);
+            const bool ok = static_cast<uint32_t>(error < 0 ? -error : error) <= toleranceUs;
+            printf("%-9s verdade %7.3f s, erro %+7.1f ms (tolerancia %lu ms) %s\n", phaseName(phase),
+                   (truthUs - startUs) / 1e6, error / 1e3, (unsigned long)(toleranceUs / 1000), ok ? "ok" : "FALHA");
+            return ok;
+        }
+        printf("%-9s nao detectado FALHA\n", phaseName(phase));
+        return false;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = nullptr;
+    bool csv = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-csv") == 0) csv = true;
+        else path = argv[i];
+    }
+
+    Trace trace;
+    if (path != nullptr) {
+        if (!load(path, trace)) {
+            fprintf(stderr, "%s: arquivo de voo invalido\n", path);
+            return 1;
+        }
+        replay(trace, csv);
+        return 0;
+    }
+
+    const Truth truth = synthesize(trace);
+    const std::vector<Detected> detected = replay(trace, csv);
+    if (csv) return 0;
+
+    const uint32_t start = trace.header.startUs;
+    bool ok = check(detected, FlightPhase::BOOST, truth.launchUs, 2000, start);
+    ok &= check(detected, FlightPhase::COAST, truth.burnoutUs, 20000, start);
+    ok &= check(detected, FlightPhase::APOGEE, truth.apogeeUs, 300000, start);
+    ok &= check(detected, FlightPhase::LANDED, truth.landingUs, 2000000, start);
+
+    // O apogeu estimado depende da integração desde o primeiro instante da propulsão
+    float apogee = 0.0f;
+    for (const Detected &d : detected) {
+        if (d.phase == FlightPhase::APOGEE) apogee = d.altitude;
+    }
+    const bool apogeeOk = fabsf(apogee - truth.apogeeM) < 1.0f;
+    printf("apogeu    verdade %7.2f m, estimado %7.2f m %s\n", truth.apogeeM, apogee, apogeeOk ? "ok" : "FALHA");
+    ok &= apogeeOk;
+
+    printf("%s\n", ok ? "OK" : "FALHA");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,36 @@
+/**
+ * @file FusionBench.cpp
+ * @brief Micro-benchmark da fusão (FusionBenchmark.cpp) rodando no host
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Não faz parte do firmware. Compilação e uso, a partir de Foguete/:
+ *
+ *     pio run -e native_fusion -t exec
+ *
+ * ou, sem o PlatformIO:
+ *
+ *     g++ -std=gnu++11 -O2 -Iinclude -Itest/hal tools/FusionBench.cpp src/FusionBenchmark.cpp src/Fusion.cpp src/Ahrs.cpp src/FlightState.cpp -o fusion_bench
+ *     ./fusion_bench [rodadas]
+ *
+ * Executa o mesmo Fusion::runBenchmark() do boot (com
+ * Config::Sensors::RUN_FUSION_BENCHMARK), que compara o passo antigo em
+ * double com o passo atual em float. Os "ciclos" vêm da HAL simulada:
+ * tempo do host convertido a 240 MHz. A razão entre os dois caminhos é
+ * o que vale aqui; o número absoluto e o orçamento só se aplicam no
+ * ESP32, onde o double é emulado em software e a diferença é maior.
+ */
+
+#include <Arduino.h>
+
+#include <cstdlib>
+
+#include "Fusion.h"
+
+int main(int argc, char **argv)
+{
+    const int rounds = argc > 1 ? atoi(argv[1]) : 5;
+    for (int i = 0; i < rounds; i++)
+        Fusion::runBenchmark();
+    return 0;
+}
@@ -0,0 +1,257 @@
+/**
+ * @file LogDecode.cpp
+ * @brief Converte em texto a saída binária do registro (Log.h)
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Não faz parte do firmware. Compilação e uso, a partir de Foguete/:
+ *
+ *     g++ -std=gnu++11 -O2 tools/LogDecode.cpp -o log_decode
+ *     ./log_decode [captura.bin] > log.txt
+ *
+ * Sem argumento lê da entrada padrão (por exemplo, a porta serial
+ * configurada em modo cru). Bytes fora de quadros, como as mensagens da
+ * configuração impressas antes de Log::start(), passam sem alteração.
+ *
+ * Cada registro sai como "<tempo em s> <nível> <mensagem>". Os argumentos
+ * são reformatados com o próprio formato enviado pelo MCU, trocando os
+ * modificadores de tamanho pelos do host.
+ */
+
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <string>
+
+namespace
+{
+    /// @brief Mesmo valor de Log::BINARY_SYNC
+    constexpr int SYNC = 0xA5;
+
+    /// @brief Leitura sequencial dos argumentos de um registro
+    class Arguments
+    {
+    public:
+        Arguments(const uint8_t *data, size_t length) : data_(data), length_(length) {}
+
+        bool read(void *out, size_t size)
+        {
+            if (used_ + size > length_) return false;
+            memcpy(out, data_ + used_, size);
+            used_ += size;
+            return true;
+        }
+
+        bool readString(std::string &out)
+        {
+            uint8_t size;
+            if (!read(&size, 1)) return false;
+            if (used_ + size > length_) size = static_cast<uint8_t>(length_ - used_);
+            out.assign(reinterpret_cast<const char *>(data_ + used_), size);
+            used_ += size;
+            return true;
+        }
+
+    private:
+        const uint8_t *data_;
+        size_t length_;
+        size_t used_ = 0;
+    };
+
+    void appendFormatted(std::string &out, const char *spec, ...) __attribute__((format(printf, 2, 3)));
+
+    void appendFormatted(std::string &out, const char *spec, ...)
+    {
+        char buffer[512];
+        va_list args;
+        va_start(args, spec);
+        vsnprintf(buffer, sizeof(buffer), spec, args);
+        va_end(args);
+        out += buffer;
+    }
+
+    /**
+     * @brief Reproduz o printf do MCU a partir dos argumentos empacotados
+     *
+     * @details Espelha packArguments() de Log.cpp: inteiros em 4 bytes
+     * (8 com "ll"), reais em double e strings com byte de tamanho.
+     */
+    std::string format(const std::string &text, Arguments args)
+    {
+        std::string out;
+        const char *p = text.c_str();
+
+        while (*p != '\0') {
+            if (*p != '%') {
+                out += *p++;
+                continue;
+            }
+            if (p[1] == '%') {
+                out += '%';
+                p += 2;
+                continue;
+            }
+
+            // Copia flags, largura e precisão; '*' vira o valor enviado
+            std::string spec = "%";
+            p++;
+            while (*p != '\0' && strchr("-+ #0", *p) != nullptr) spec += *p++;
+            bool complete = true;
+            if (*p == '*') {
+                int32_t width = 0;
+                complete = args.read(&width, sizeof(width));
+                spec += std::to_string(width);
+                p++;
+            }
+            while (*p >= '0' && *p <= '9') spec += *p++;
+            if (*p == '.') {
+                spec += *p++;
+                if (*p == '*') {
+                    int32_t precision = 0;
+                    complete = complete && args.read(&precision, sizeof(precision));
+                    spec += std::to_string(precision);
+                    p++;
+                }
+                while (*p >= '0' && *p <= '9') spec += *p++;
+            }
+
+            int longs = 0;
+            for (; *p != '\0' && strchr("hlLjzt", *p) != nullptr; p++) {
+                if (*p == 'l') longs++;
+            }
+
+            const char conversion = *p;
+            if (conversion == '\0') break;
+            p++;
+
+            switch (conversion) {
+                case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c': {
+                    long long value;
+                    if (longs >= 2) {
+                        int64_t raw;
+                        complete = complete && args.read(&raw, sizeof(raw));
+                        value = raw;
+                    } else {
+                        int32_t raw;
+                        complete = complete && args.read(&raw, sizeof(raw));
+                        // Sem sinal: o MCU tem int de 32 bits
+                        value = (conversion == 'd' || conversion == 'i' || conversion == 'c')
+                                    ? static_cast<long long>(raw)
+                                    : static_cast<long long>(static_cast<uint32_t>(raw));
+                    }
+                    if (!complete) break;
+                    if (conversion == 'c') {
+                        appendFormatted(out, (spec + "c").c_str(), static_cast<int>(value));
+                    } else {
+                        appendFormatted(out, (spec + "ll" + conversion).c_str(), value);
+                    }
+                    break;
+                }
+                case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A': {
+                    double value;
+                    complete = complete && args.read(&value, sizeof(value));
+                    if (complete) appendFormatted(out, (spec + conversion).c_str(), value);
+                    break;
+                }
+                case 's': {
+                    std::string value;
+                    complete = complete && args.readString(value);
+                    if (complete) appendFormatted(out, (spec + 's').c_str(), value.c_str());
+                    break;
+                }
+                case 'p': {
+                    uint32_t value;
+                    complete = complete && args.read(&value, sizeof(value));
+                    if (complete) appendFormatted(out, "0x%08x", value);
+                    break;
+                }
+                default:
+                    complete = false;
+            }
+
+            if (!complete) {
+                // Registro cortado no MCU ou conversão desconhecida
+                out += "<...>";
+                return out;
+            }
+        }
+        return out;
+    }
+
+    char levelTag(uint8_t level)
+    {
+        return level >= 1 && level <= 4 ? "EWID"[level - 1] : '?';
+    }
+
+    bool readBytes(FILE *in, void *out, size_t size)
+    {
+        return fread(out, 1, size, in) == size;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    FILE *in = stdin;
+    if (argc > 1) {
+        in = fopen(argv[1], "rb");
+        if (in == nullptr) {
+            perror(argv[1]);
+            return 1;
+        }
+    }
+
+    std::map<uint32_t, std::string> formats;
+    unsigned long unknown = 0;
+    int c;
+
+    while ((c = fgetc(in)) != EOF) {
+        if (c != SYNC) {
+            putchar(c);
+            continue;
+        }
+
+        const int type = fgetc(in);
+        if (type == 'S') {
+            uint32_t id;
+            uint8_t length;
+            char text[256];
+            if (!readBytes(in, &id, sizeof(id)) || !readBytes(in, &length, 1) ||
+                !readBytes(in, text, length))
+                break;
+            formats[id].assign(text, length);
+        } else if (type == 'R') {
+            uint32_t timestampUs, id;
+            uint8_t level, length;
+            uint8_t data[256];
+            if (!readBytes(in, &timestampUs, sizeof(timestampUs)) || !readBytes(in, &level, 1) ||
+                !readBytes(in, &id, sizeof(id)) || !readBytes(in, &length, 1) ||
+                !readBytes(in, data, length))
+                break;
+
+            printf("%10.6f %c ", timestampUs / 1e6, levelTag(level));
+            auto known = formats.find(id);
+            if (known != formats.end()) {
+                printf("%s\n", format(known->second, Arguments(data, length)).c_str());
+            } else {
+                // Formato perdido (captura iniciada depois do quadro 'S')
+                printf("<formato %08x desconhecido, %u bytes>\n", id, (unsigned)length);
+                unknown++;
+            }
+        } else if (type == 'D') {
+            uint32_t total;
+            if (!readBytes(in, &total, sizeof(total))) break;
+            printf("           W log: %lu mensagens descartadas no total\n", (unsigned long)total);
+        } else {
+            // Não era um quadro: devolve os bytes como texto
+            putchar(c);
+            if (type == EOF) break;
+            putchar(type);
+        }
+    }
+
+    if (unknown > 0) fprintf(stderr, "%lu registros com formato desconhecido\n", unknown);
+    if (in != stdin) fclose(in);
+    return 0;
+}
@@ -0,0 +1,186 @@
+/**
+ * @file PipelineBench.cpp
+ * @brief Pipeline de tarefas (Pipeline.cpp) rodando no host com sensores e rádio simulados
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Não faz parte do firmware. Compilação e uso, a partir de Foguete/:
+ *
+ *     pio run -e native_pipeline -t exec
+ *
+ * ou, sem o PlatformIO:
+ *
+ *     g++ -std=gnu++11 -O2 -pthread -Iinclude -Itest/hal tools/PipelineBench.cpp src/Pipeline.cpp src/Log.cpp -o pipeline_bench
+ *     ./pipeline_bench [segundos]
+ *
+ * Pipeline.cpp e Log.cpp são compilados sem alteração contra a HAL de
+ * test/hal, em que cada tarefa FreeRTOS é uma thread. Os estágios de
+ * main.cpp são trocados por versões sintéticas:
+ *
+ * - aquisição: um FIFO de MPU6050 que enche a IMU_SAMPLE_RATE e é lido
+ *   ao custo de um barramento I2C_CLOCK (9 bits por byte);
+ * - fusão: confere que os timestamps chegam sem buracos;
+ * - transmissão e registro: dormem o tempo de um envio ESP-NOW e de um
+ *   printf a 115200 baud, os dois estágios lentos que motivaram a divisão.
+ *
+ * Ao fim imprime as estatísticas dos estágios e sai com código 1 se
+ * alguma amostra do IMU se perdeu, no FIFO ou em uma fila.
+ */
+
+#include <Arduino.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "Config.h"
+#include "Log.h"
+#include "Pipeline.h"
+
+namespace
+{
+    /// @brief Período do IMU (µs)
+    constexpr uint32_t IMU_PERIOD_US = 1000000UL / Config::Sensors::IMU_SAMPLE_RATE;
+
+    /// @brief Quadros de 14 bytes que cabem no FIFO
+    constexpr uint32_t FIFO_FRAMES = Mpu6050::FIFO_CAPACITY / Mpu6050::FRAME_SIZE;
+
+    /// @brief Tempo de barramento de um quadro do FIFO (µs)
+    constexpr uint32_t FRAME_READ_US = Mpu6050::FRAME_SIZE * 9UL * 1000000UL / Config::Hardware::I2C_CLOCK;
+
+    /// @brief Duração simulada de um envio ESP-NOW (µs)
+    constexpr uint32_t SEND_US = 2000U;
+
+    /// @brief Duração simulada de uma linha de ~100 caracteres a 115200 baud (µs)
+    constexpr uint32_t PRINT_US = 8700U;
+
+    /// @brief Instante da próxima amostra que o FIFO simulado vai gerar (µs)
+    uint32_t nextSampleUs = 0;
+
+    /// @brief Amostras geradas e amostras perdidas por estouro do FIFO
+    uint32_t generated = 0;
+    uint32_t overflowed = 0;
+
+    /// @brief Amostras que a fusão viu e buracos na sequência de timestamps
+    std::atomic<uint32_t> fused(0);
+    std::atomic<uint32_t> gaps(0);
+
+    /// @brief Amostras transmitidas
+    std::atomic<uint32_t> transmitted(0);
+
+    void sleepUs(uint32_t us)
+    {
+        std::this_thread::sleep_for(std::chrono::microseconds(us));
+    }
+}
+
+namespace Pipeline
+{
+    size_t acquire(RawSample *samples, size_t max, uint32_t timestampUs)
+    {
+        if (nextSampleUs == 0) nextSampleUs = timestampUs;
+
+        uint32_t pending = (timestampUs - nextSampleUs) / IMU_PERIOD_US;
+        if (pending > FIFO_FRAMES) {
+            // O sensor descarta os quadros mais antigos quando o FIFO enche
+            overflowed += pending - FIFO_FRAMES;
+            generated += pending - FIFO_FRAMES;
+            nextSampleUs += (pending - FIFO_FRAMES) * IMU_PERIOD_US;
+            pending = FIFO_FRAMES;
+        }
+
+        const size_t count = pending < max ? pending : max;
+        sleepUs(static_cast<uint32_t>(count) * FRAME_READ_US);
+        for (size_t i = 0; i < count; i++) {
+            RawSample &s = samples[i];
+            s = RawSample();
+            s.imu.timestampUs = nextSampleUs;
+            s.timestampUs = nextSampleUs;
+            nextSampleUs += IMU_PERIOD_US;
+        }
+        generated += static_cast<uint32_t>(count);
+        return count;
+    }
+
+    bool fuse(const RawSample &sample, SensorData &out)
+    {
+        static uint32_t previousUs = 0;
+        if (fused.load() > 0 && sample.timestampUs - previousUs != IMU_PERIOD_US) gaps++;
+        previousUs = sample.timestampUs;
+        fused++;
+
+        out = SensorData();
+        out.timestampUs = sample.timestampUs;
+        return true;
+    }
+
+    size_t transmit(const SensorData *, size_t count)
+    {
+        const size_t sent = count < Config::RateControl::MAX_BATCH ? count : Config::RateControl::MAX_BATCH;
+        sleepUs(SEND_US);
+        transmitted += static_cast<uint32_t>(sent);
+        return sent;
+    }
+
+    uint32_t frameInterval()
+    {
+        return Config::RateControl::MIN_INTERVAL;
+    }
+
+    uint32_t sampleInterval()
+    {
+        return Config::Timing::TELEMETRY_SAMPLE_INTERVAL * 1000UL;
+    }
+
+    void log(const SensorData &)
+    {
+        sleepUs(PRINT_US);
+    }
+
+    void report()
+    {
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const int seconds = argc > 1 ? atoi(argv[1]) : 5;
+
+    if (!Log::start() || !Pipeline::start()) {
+        fprintf(stderr, "falha ao criar as tarefas\n");
+        return 1;
+    }
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+
+    const Pipeline::StageStats &acquisition = Pipeline::stats(Pipeline::ACQUISITION);
+    const Pipeline::StageStats &fusion = Pipeline::stats(Pipeline::FUSION);
+    const Pipeline::StageStats &logging = Pipeline::stats(Pipeline::LOGGING);
+    const uint32_t expected = static_cast<uint32_t>(seconds) * Config::Sensors::IMU_SAMPLE_RATE;
+
+    printf("\n%d s, IMU a %u Hz, dreno a cada %lu ms, quadro lido em %lu us\n", seconds,
+           (unsigned)Config::Sensors::IMU_SAMPLE_RATE, (unsigned long)Config::Timing::FIFO_DRAIN_INTERVAL,
+           (unsigned long)FRAME_READ_US);
+    for (uint8_t i = 0; i < Pipeline::STAGE_COUNT; i++) {
+        const Pipeline::StageStats &s = Pipeline::stats(static_cast<Pipeline::Stage>(i));
+        printf("%-12s itens=%lu descartes=%lu medio=%luus max=%luus\n",
+               Pipeline::stageName(static_cast<Pipeline::Stage>(i)), (unsigned long)s.processed,
+               (unsigned long)s.dropped, (unsigned long)(s.processed ? s.totalMicros / s.processed : 0),
+               (unsigned long)s.maxMicros);
+    }
+    printf("amostras: geradas=%lu (~%lu esperadas) fundidas=%lu transmitidas=%lu\n", (unsigned long)generated,
+           (unsigned long)expected, (unsigned long)fused.load(), (unsigned long)transmitted.load());
+    printf("perdas: FIFO=%lu fila bruta=%lu buracos=%lu\n", (unsigned long)overflowed,
+           (unsigned long)acquisition.dropped, (unsigned long)gaps.load());
+    printf("descartes tolerados: transmissao=%lu registro=%lu\n", (unsigned long)fusion.dropped,
+           (unsigned long)logging.dropped);
+
+    // Só a aquisição tem de ser contínua; transmissão e registro podem descartar
+    const bool ok = overflowed == 0 && acquisition.dropped == 0 && gaps.load() == 0 &&
+                    generated >= expected * 9U / 10U;
+    printf("%s\n", ok ? "OK" : "FALHA");
+    fflush(stdout);
+    // As tarefas não terminam: sai sem destruir os objetos estáticos que elas usam
+    _Exit(ok ? 0 : 1);
+}
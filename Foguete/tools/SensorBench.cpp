@@ -0,0 +1,374 @@
+/**
+ * @file SensorBench.cpp
+ * @brief Drivers enxutos (Mpu6050/Bmp280) contra o caminho Adafruit, sobre sensores emulados
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Não faz parte do firmware. Compilação e uso, a partir de Foguete/:
+ *
+ *     pio run -e native_sensors -t exec
+ *
+ * ou, sem o PlatformIO:
+ *
+ *     g++ -std=gnu++11 -O2 -Iinclude -Itest/hal tools/SensorBench.cpp src/Mpu6050.cpp src/Bmp280.cpp -o sensor_bench
+ *     ./sensor_bench [amostras]
+ *
+ * Os dois caminhos conversam com os mesmos MPU6050 e BMP280 emulados por
+ * registrador (test/hal), pelo Wire.h simulado, e leem uma amostra de
+ * cada sensor por ciclo, como o loop() original.
+ *
+ * As bibliotecas da Adafruit não são baixadas no host; o caminho antigo
+ * é reproduzido aqui com a mesma sequência de registradores e a mesma
+ * aritmética delas (Adafruit_MPU6050 2.2: getEvent() com _read() e as
+ * duas leituras de faixa; Adafruit_BMP280 2.6: readPressure() e
+ * readAltitude(), cada uma refazendo readTemperature()).
+ *
+ * Para cada caminho imprime transações e bytes I2C por ciclo, o tempo de
+ * barramento a Config::Hardware::I2C_CLOCK (o custo que domina no ESP32)
+ * e o tempo de CPU no host, e confere que os dois produzem as mesmas
+ * grandezas físicas. Sai com código 1 se divergirem.
+ */
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#include <Bmp280Emulator.h>
+#include <Mpu6050Emulator.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "Bmp280.h"
+#include "Config.h"
+#include "Mpu6050.h"
+
+namespace
+{
+    /// @brief Grandezas físicas de um ciclo, comparadas entre os caminhos
+    struct Reading {
+        float acc[3];   // m/s²
+        float gyro[3];  // rad/s
+        float temp;     // °C (MPU6050)
+        float pressure; // Pa
+        float altitude; // m
+    };
+
+    /**
+     * @brief Caminho antigo: Adafruit_MPU6050 + Adafruit_BMP280
+     *
+     * @details Cada acesso a registrador é um write_then_read do
+     * Adafruit_BusIO: escrita do endereço sem STOP seguida da leitura.
+     */
+    class AdafruitPath
+    {
+    public:
+        /// @brief sensors_event_t (Adafruit_Sensor.h), 36 bytes zerados a cada evento
+        struct Event {
+            int32_t version;
+            int32_t sensor_id;
+            int32_t type;
+            int32_t reserved0;
+            int32_t timestamp;
+            float data[4];
+        };
+
+        AdafruitPath(TwoWire &wire) : wire_(wire) {}
+
+        void read(Reading &out)
+        {
+            Event a, g, t;
+            getEvent(&a, &g, &t);
+            for (int i = 0; i < 3; i++) {
+                out.acc[i] = a.data[i];
+                out.gyro[i] = g.data[i];
+            }
+            out.temp = t.data[0];
+            out.pressure = readPressure();
+            out.altitude = readAltitude(Config::Sensors::SEA_LEVEL_PRESSURE);
+        }
+
+    private:
+        static constexpr uint8_t MPU = Mpu6050::DEFAULT_ADDRESS;
+        static constexpr uint8_t BMP = 0x76;
+
+        void readRegisters(uint8_t address, uint8_t reg, uint8_t *buffer, size_t len)
+        {
+            wire_.beginTransmission(address);
+            wire_.write(reg);
+            wire_.endTransmission(false);
+            wire_.requestFrom(address, len, true);
+            wire_.readBytes(buffer, len);
+        }
+
+        /// @brief Adafruit_BusIO_RegisterBits::read() de 2 bits em [4:3]
+        uint8_t readRange(uint8_t reg)
+        {
+            uint8_t value = 0;
+            readRegisters(MPU, reg, &value, 1);
+            return (value >> 3) & 0x03;
+        }
+
+        /// @brief Adafruit_MPU6050::getEvent(): _read() e os três eventos
+        void getEvent(Event *accel, Event *gyro, Event *temp)
+        {
+            uint8_t buffer[14];
+            readRegisters(MPU, 0x3B, buffer, 14);
+            const int16_t rawAccX = static_cast<int16_t>(buffer[0] << 8 | buffer[1]);
+            const int16_t rawAccY = static_cast<int16_t>(buffer[2] << 8 | buffer[3]);
+            const int16_t rawAccZ = static_cast<int16_t>(buffer[4] << 8 | buffer[5]);
+            const int16_t rawTemp = static_cast<int16_t>(buffer[6] << 8 | buffer[7]);
+            const int16_t rawGyroX = static_cast<int16_t>(buffer[8] << 8 | buffer[9]);
+            const int16_t rawGyroY = static_cast<int16_t>(buffer[10] << 8 | buffer[11]);
+            const int16_t rawGyroZ = static_cast<int16_t>(buffer[12] << 8 | buffer[13]);
+
+            const float temperature = (rawTemp / 340.0) + 36.53;
+
+            float accelScale = 1;
+            switch (readRange(0x1C)) {
+                case 3: accelScale = 2048; break;
+                case 2: accelScale = 4096; break;
+                case 1: accelScale = 8192; break;
+                default: accelScale = 16384; break;
+            }
+            const float accX = static_cast<float>(rawAccX) / accelScale;
+            const float accY = static_cast<float>(rawAccY) / accelScale;
+            const float accZ = static_cast<float>(rawAccZ) / accelScale;
+
+            float gyroScale = 1;
+            switch (readRange(0x1B)) {
+                case 0: gyroScale = 131; break;
+                case 1: gyroScale = 65.5; break;
+                case 2: gyroScale = 32.8; break;
+                default: gyroScale = 16.4; break;
+            }
+            const float gyroX = static_cast<float>(rawGyroX) / gyroScale;
+            const float gyroY = static_cast<float>(rawGyroY) / gyroScale;
+            const float gyroZ = static_cast<float>(rawGyroZ) / gyroScale;
+
+            const int32_t timestamp = static_cast<int32_t>(millis());
+            constexpr float SENSORS_GRAVITY_STANDARD = 9.80665F;
+            constexpr float SENSORS_DPS_TO_RADS = 0.017453293F;
+
+            memset(accel, 0, sizeof(Event));
+            accel->version = sizeof(Event);
+            accel->type = 1;
+            accel->timestamp = timestamp;
+            accel->data[0] = accX * SENSORS_GRAVITY_STANDARD;
+            accel->data[1] = accY * SENSORS_GRAVITY_STANDARD;
+            accel->data[2] = accZ * SENSORS_GRAVITY_STANDARD;
+
+            memset(gyro, 0, sizeof(Event));
+            gyro->version = sizeof(Event);
+            gyro->type = 4;
+            gyro->timestamp = timestamp;
+            gyro->data[0] = gyroX * SENSORS_DPS_TO_RADS;
+            gyro->data[1] = gyroY * SENSORS_DPS_TO_RADS;
+            gyro->data[2] = gyroZ * SENSORS_DPS_TO_RADS;
+
+            memset(temp, 0, sizeof(Event));
+            temp->version = sizeof(Event);
+            temp->type = 13;
+            temp->timestamp = timestamp;
+            temp->data[0] = temperature;
+        }
+
+        /// @brief Adafruit_BMP280::read24()
+        int32_t read24(uint8_t reg)
+        {
+            uint8_t buffer[3];
+            readRegisters(BMP, reg, buffer, 3);
+            return static_cast<int32_t>(buffer[0]) << 16 | buffer[1] << 8 | buffer[2];
+        }
+
+        /// @brief A calibração é lida uma vez, no begin() da biblioteca
+        void loadCalibration()
+        {
+            if (calibrated_) return;
+            uint8_t raw[24];
+            readRegisters(BMP, 0x88, raw, 24);
+            calib_.t1 = static_cast<uint16_t>(raw[0] | raw[1] << 8);
+            calib_.t2 = static_cast<int16_t>(raw[2] | raw[3] << 8);
+            calib_.t3 = static_cast<int16_t>(raw[4] | raw[5] << 8);
+            calib_.p1 = static_cast<uint16_t>(raw[6] | raw[7] << 8);
+            calib_.p2 = static_cast<int16_t>(raw[8] | raw[9] << 8);
+            calib_.p3 = static_cast<int16_t>(raw[10] | raw[11] << 8);
+            calib_.p4 = static_cast<int16_t>(raw[12] | raw[13] << 8);
+            calib_.p5 = static_cast<int16_t>(raw[14] | raw[15] << 8);
+            calib_.p6 = static_cast<int16_t>(raw[16] | raw[17] << 8);
+            calib_.p7 = static_cast<int16_t>(raw[18] | raw[19] << 8);
+            calib_.p8 = static_cast<int16_t>(raw[20] | raw[21] << 8);
+            calib_.p9 = static_cast<int16_t>(raw[22] | raw[23] << 8);
+            calibrated_ = true;
+        }
+
+        float readTemperature()
+        {
+            loadCalibration();
+            int32_t adcT = read24(0xFA) >> 4;
+            int32_t var1 = ((((adcT >> 3) - ((int32_t)calib_.t1 << 1))) * ((int32_t)calib_.t2)) >> 11;
+            int32_t var2 = (((((adcT >> 4) - ((int32_t)calib_.t1)) * ((adcT >> 4) - ((int32_t)calib_.t1))) >> 12) *
+                            ((int32_t)calib_.t3)) >> 14;
+            tFine_ = var1 + var2;
+            float t = (tFine_ * 5 + 128) >> 8;
+            return t / 100;
+        }
+
+        float readPressure()
+        {
+            readTemperature();  // Precisa de t_fine
+
+            int32_t adcP = read24(0xF7) >> 4;
+            int64_t var1 = ((int64_t)tFine_) - 128000;
+            int64_t var2 = var1 * var1 * (int64_t)calib_.p6;
+            var2 = var2 + ((var1 * (int64_t)calib_.p5) << 17);
+            var2 = var2 + (((int64_t)calib_.p4) << 35);
+            var1 = ((var1 * var1 * (int64_t)calib_.p3) >> 8) + ((var1 * (int64_t)calib_.p2) << 12);
+            var1 = (((((int64_t)1) << 47) + var1)) * ((int64_t)calib_.p1) >> 33;
+            if (var1 == 0) return 0;
+
+            int64_t p = 1048576 - adcP;
+            p = (((p << 31) - var2) * 3125) / var1;
+            var1 = (((int64_t)calib_.p9) * (p >> 13) * (p >> 13)) >> 25;
+            var2 = (((int64_t)calib_.p8) * p) >> 19;
+            p = ((p + var1 + var2) >> 8) + (((int64_t)calib_.p7) << 4);
+            return (float)p / 256;
+        }
+
+        float readAltitude(float seaLevelhPa)
+        {
+            float pressure = readPressure();
+            pressure /= 100;
+            return 44330 * (1.0 - pow(pressure / seaLevelhPa, 0.1903));
+        }
+
+        TwoWire &wire_;
+        Bmp280::Calibration calib_ = {};
+        bool calibrated_ = false;
+        int32_t tFine_ = 0;
+    };
+
+    /// @brief Caminho novo: rajadas inteiras e conversão como em Fusion::toSi()/update()
+    void readThin(Mpu6050 &mpu, Bmp280 &bmp, Reading &out)
+    {
+        using namespace Config::Sensors;
+        ImuSample imu;
+        BaroSample baro;
+        mpu.readSample(imu);
+        bmp.read(baro);
+
+        constexpr float accScale = GRAVITY / ACCEL_LSB_PER_G;
+        constexpr float gyroScale = 0.017453292519943295f / GYRO_LSB_PER_DPS;
+        for (int axis = 0; axis < 3; axis++) {
+            out.acc[axis] = static_cast<float>(imu.acc[axis]) * accScale;
+            out.gyro[axis] = static_cast<float>(imu.gyro[axis]) * gyroScale;
+        }
+        out.temp = static_cast<float>(imu.temp) * (1.0f / 340.0f) + 36.53f;
+        out.pressure = static_cast<float>(baro.pressure) * (1.0f / 256.0f);
+        out.altitude = 44330.0f * (1.0f - powf(out.pressure * 0.01f / SEA_LEVEL_PRESSURE, 0.1903f));
+    }
+
+    /// @brief Nova conversão nos dois sensores, para nenhum caminho ler valores repetidos
+    void advance(Mpu6050Emulator &mpu, Bmp280Emulator &bmp, uint32_t i)
+    {
+        const int16_t acc[3] = {static_cast<int16_t>(i % 8192 - 4096), 321, 4096};
+        const int16_t gyro[3] = {static_cast<int16_t>(i % 2000), -655, 7};
+        mpu.pushFrame(acc, static_cast<int16_t>(i % 500), gyro);
+        bmp.setRaw(Bmp280Emulator::EXAMPLE_ADC_T + static_cast<int32_t>(i % 64),
+                   Bmp280Emulator::EXAMPLE_ADC_P + static_cast<int32_t>(i % 4096));
+    }
+
+    /// @brief Maior diferença relativa entre duas leituras
+    float maxError(const Reading &a, const Reading &b)
+    {
+        const float *x = reinterpret_cast<const float *>(&a);
+        const float *y = reinterpret_cast<const float *>(&b);
+        float worst = 0.0f;
+        for (size_t i = 0; i < sizeof(Reading) / sizeof(float); i++) {
+            const float scale = fabsf(x[i]) > 1.0f ? fabsf(x[i]) : 1.0f;
+            const float error = fabsf(x[i] - y[i]) / scale;
+            if (error > worst) worst = error;
+        }
+        return worst;
+    }
+
+    struct Result {
+        double transactions;
+        double bytes;
+        double busUs;
+        double cpuNs;
+    };
+
+    void print(const char *name, const Result &r)
+    {
+        printf("%-9s transacoes=%5.1f bytes=%5.1f barramento=%7.1f us cpu=%7.1f ns\n", name, r.transactions,
+               r.bytes, r.busUs, r.cpuNs);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const uint32_t cycles = argc > 1 ? static_cast<uint32_t>(atol(argv[1])) : 200000U;
+
+    TwoWire wire;
+    Mpu6050Emulator mpuChip;
+    Bmp280Emulator bmpChip;
+    wire.attach(Mpu6050::DEFAULT_ADDRESS, &mpuChip);
+    wire.attach(0x76, &bmpChip);
+    wire.setClock(Config::Hardware::I2C_CLOCK);
+
+    Mpu6050 mpu(wire);
+    Bmp280 bmp(wire);
+    AdafruitPath adafruit(wire);
+    if (!mpu.begin() || !bmp.begin(0x76, Config::Timing::SENSOR_READ_INTERVAL)) {
+        fprintf(stderr, "sensores emulados nao responderam\n");
+        return 1;
+    }
+
+    // Correção: os dois caminhos leem o mesmo estado dos sensores
+    float worst = 0.0f;
+    for (uint32_t i = 0; i < 5000; i++) {
+        advance(mpuChip, bmpChip, i * 7919U);
+        Reading a, b;
+        adafruit.read(a);
+        readThin(mpu, bmp, b);
+        const float error = maxError(a, b);
+        if (error > worst) worst = error;
+    }
+
+    Result results[2];
+    volatile float sink = 0.0f;
+    for (int path = 0; path < 2; path++) {
+        wire.resetCounters();
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < cycles; i++) {
+            advance(mpuChip, bmpChip, i);
+            Reading r;
+            if (path == 0) adafruit.read(r);
+            else readThin(mpu, bmp, r);
+            sink = sink + r.altitude;
+        }
+        const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+        Result &r = results[path];
+        r.transactions = static_cast<double>(wire.transactions()) / cycles;
+        r.bytes = static_cast<double>(wire.bytes()) / cycles;
+        r.busUs = static_cast<double>(wire.busMicros()) / cycles;
+        r.cpuNs = ns / cycles;
+    }
+
+    printf("%lu ciclos (MPU6050 + BMP280), I2C a %lu Hz\n", (unsigned long)cycles,
+           (unsigned long)Config::Hardware::I2C_CLOCK);
+    print("Adafruit", results[0]);
+    print("enxuto", results[1]);
+    printf("ganho: barramento %.1fx, cpu no host %.1fx\n", results[0].busUs / results[1].busUs,
+           results[0].cpuNs / results[1].cpuNs);
+    printf("maior diferenca relativa entre os caminhos: %.2e\n", worst);
+
+    // float32 arredonda pressão (~1e5 Pa) em ~0,008 Pa e a altitude em poucos mm
+    const bool ok = worst < 1e-4f;
+    printf("%s\n", ok ? "OK" : "FALHA");
+    return ok ? 0 : 1;
+}
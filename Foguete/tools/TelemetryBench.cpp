@@ -0,0 +1,293 @@
+/**
+ * @file TelemetryBench.cpp
+ * @brief Benchmark no host dos formatos de telemetria (lote v3 e fluxo v4)
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Não faz parte do firmware. Compilação e uso, a partir de Foguete/:
+ *
+ *     g++ -std=gnu++11 -O2 -Iinclude tools/TelemetryBench.cpp src/Telemetry.cpp -o telemetry_bench
+ *     ./telemetry_bench [voo.csv]
+ *
+ * Sem argumento, usa um voo sintético de foguete d'água (rampa,
+ * propulsão, subida, descida de paraquedas e pouso) com ruído de sensor.
+ * O CSV tem uma amostra por linha, sem cabeçalho:
+ *
+ *     timestamp_us,accX,accY,accZ,gyroX,gyroY,gyroZ,temp,pitch,roll,pressao_hPa,fase
+ *
+ * Para cada formato imprime bytes por amostra e, para o fluxo, o tempo
+ * de codificação e decodificação por amostra. Também confere que o fluxo
+ * reproduz exatamente os valores quantizados do lote e mede quantas
+ * amostras se perdem quando um quadro em N não chega.
+ */
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "Config.h"
+#include "Telemetry.h"
+
+namespace
+{
+    using Clock = std::chrono::steady_clock;
+
+    /// @brief Gerador determinístico (LCG) com ruído aproximadamente gaussiano
+    struct Noise {
+        uint32_t seed = 12345U;
+
+        float uniform()
+        {
+            seed = seed * 1664525U + 1013904223U;
+            return static_cast<float>(seed >> 8) / 16777216.0f;
+        }
+
+        float gaussian(float sigma)
+        {
+            float sum = 0.0f;
+            for (int i = 0; i < 12; i++) sum += uniform();
+            return (sum - 6.0f) * sigma;
+        }
+    };
+
+    /// @brief Voo sintético amostrado a cada @p periodUs
+    std::vector<SensorData> syntheticFlight(uint32_t periodUs)
+    {
+        const float g = Config::Sensors::GRAVITY;
+        const float dt = static_cast<float>(periodUs) * 1e-6f;
+        Noise noise;
+        std::vector<SensorData> flight;
+
+        float t = 0.0f;
+        float height = 0.0f;
+        float speed = 0.0f;
+        float pitch = 88.0f;
+        uint8_t phase = 0;
+
+        while (t < 30.0f) {
+            float thrust = 0.0f;
+            if (t >= 5.0f && t < 5.3f) {
+                thrust = 12.0f * g;
+                phase = 1;
+            } else if (t >= 5.3f && phase == 1) {
+                phase = 2;
+            }
+
+            float drag = phase >= 4 ? -speed * 2.0f : -0.02f * speed * fabsf(speed);
+            float acc = t < 5.0f ? 0.0f : thrust - g + drag;
+            if (phase == 5) acc = 0.0f;
+            speed += acc * dt;
+            height += speed * dt;
+            if (phase == 2 && speed < 0.0f) phase = 3;
+            else if (phase == 3) phase = 4;
+            if (phase == 4 && height <= 0.0f) {
+                height = 0.0f;
+                speed = 0.0f;
+                phase = 5;
+            }
+            if (phase >= 2) pitch -= 4.0f * dt;
+
+            SensorData s = {};
+            s.timestampUs = 1000000U + static_cast<uint32_t>(flight.size()) * periodUs;
+            s.phase = phase;
+            // O acelerômetro mede a força específica: em queda livre, ~0
+            float specific = phase == 2 || phase == 3 ? drag : acc + g;
+            s.acelerometro.accX = noise.gaussian(0.04f);
+            s.acelerometro.accY = noise.gaussian(0.04f);
+            s.acelerometro.accZ = specific + noise.gaussian(0.04f);
+            s.acelerometro.gyroX = noise.gaussian(0.002f) + (phase == 4 ? 0.3f * sinf(t) : 0.0f);
+            s.acelerometro.gyroY = noise.gaussian(0.002f);
+            s.acelerometro.gyroZ = noise.gaussian(0.002f) + (phase >= 1 && phase <= 3 ? 2.0f : 0.0f);
+            s.acelerometro.temp = 25.0f + noise.gaussian(0.02f);
+            s.acelerometro.pitch = pitch;
+            s.acelerometro.roll = noise.gaussian(0.05f);
+            s.altimetro.pressure = 1013.25f * powf(1.0f - height / 44330.0f, 5.255f) + noise.gaussian(0.02f);
+            s.tensao.voltage_rocket = 7.4f;
+            s.gps.fixAge = 0xFFFFFFFFUL;
+            flight.push_back(s);
+            t += dt;
+        }
+        return flight;
+    }
+
+    /// @brief Lê um voo gravado no formato descrito no cabeçalho
+    std::vector<SensorData> loadFlight(const char *path)
+    {
+        std::vector<SensorData> flight;
+        FILE *file = fopen(path, "r");
+        if (file == nullptr) return flight;
+
+        char line[512];
+        while (fgets(line, sizeof(line), file) != nullptr) {
+            SensorData s = {};
+            unsigned long timestampUs;
+            unsigned phase;
+            AcelerometerData &imu = s.acelerometro;
+            int fields = sscanf(line, "%lu,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%u",
+                                &timestampUs, &imu.accX, &imu.accY, &imu.accZ,
+                                &imu.gyroX, &imu.gyroY, &imu.gyroZ, &imu.temp,
+                                &imu.pitch, &imu.roll, &s.altimetro.pressure, &phase);
+            if (fields != 12) continue;
+            s.timestampUs = static_cast<uint32_t>(timestampUs);
+            s.phase = static_cast<uint8_t>(phase);
+            s.gps.fixAge = 0xFFFFFFFFUL;
+            flight.push_back(s);
+        }
+        fclose(file);
+        return flight;
+    }
+
+    /**
+     * @brief Compara os campos rápidos quantizados de duas amostras
+     *
+     * @details Os campos lentos vêm da amostra mais nova de cada quadro
+     * e por isso não são comparados.
+     */
+    bool sameQuantized(const SensorData &decoded, const SensorData &original)
+    {
+        SensorData a = decoded;
+        SensorData b = original;
+        a.acelerometro.temp = b.acelerometro.temp;
+        a.tensao = b.tensao;
+        a.gps = b.gps;
+
+        Telemetry::PacketV2 pa;
+        Telemetry::PacketV2 pb;
+        Telemetry::encode(a, pa);
+        Telemetry::encode(b, pb);
+        return memcmp(&pa, &pb, sizeof(pa)) == 0;
+    }
+
+    /// @brief Quadros de um formato, na cadência do transmissor
+    struct Frames {
+        std::vector<std::vector<uint8_t>> frames;
+        size_t bytes = 0;
+        size_t sent = 0;  ///< Amostras que chegaram a algum quadro
+        double encodeNs = 0.0;
+    };
+
+    /**
+     * @brief Simula a tarefa de transmissão: a cada período, as amostras
+     * acumuladas (mais as que sobraram do quadro anterior) vão para um quadro
+     */
+    template <typename Encode>
+    Frames transmit(const std::vector<SensorData> &flight, size_t perPeriod, Encode encode)
+    {
+        Frames out;
+        size_t next = 0;
+        size_t pending = 0;
+        uint8_t frame[Telemetry::MAX_FRAME_BYTES];
+
+        while (next < flight.size() || pending > 0) {
+            size_t arrived = flight.size() - next < perPeriod ? flight.size() - next : perPeriod;
+            pending += arrived;
+            next += arrived;
+
+            size_t packed = 0;
+            Clock::time_point start = Clock::now();
+            size_t length = encode(&flight[next - pending], pending, frame, packed);
+            out.encodeNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+            out.frames.push_back(std::vector<uint8_t>(frame, frame + length));
+            out.bytes += length;
+            out.sent += packed;
+            pending -= packed;
+        }
+        return out;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const uint32_t periodUs = Config::Timing::TELEMETRY_SAMPLE_INTERVAL * 1000UL;
+    const size_t perPeriod = Config::Timing::TRANSMISSION_INTERVAL / Config::Timing::TELEMETRY_SAMPLE_INTERVAL;
+
+    std::vector<SensorData> flight = argc > 1 ? loadFlight(argv[1]) : syntheticFlight(periodUs);
+    if (flight.empty()) {
+        fprintf(stderr, "Nenhuma amostra em %s\n", argc > 1 ? argv[1] : "(sintetico)");
+        return 1;
+    }
+    const double samples = static_cast<double>(flight.size());
+    printf("Voo: %zu amostras (%s), %zu por periodo de transmissao\n\n",
+           flight.size(), argc > 1 ? argv[1] : "sintetico", perPeriod);
+
+    // Lote v3: as amostras mais antigas que não couberem são descartadas
+    size_t batchSent = 0;
+    Frames batch = transmit(flight, perPeriod,
+        [&batchSent](const SensorData *s, size_t n, uint8_t *f, size_t &packed) {
+            size_t length = Telemetry::encodeBatch(s, n, f, packed);
+            batchSent += packed;
+            packed = n;
+            return length;
+        });
+    batch.sent = batchSent;
+
+    // Fluxo v4: quantas repetições forem necessárias para medir o tempo
+    const int rounds = 20;
+    Frames stream;
+    for (int i = 0; i < rounds; i++) {
+        Telemetry::StreamEncoder encoder(Config::EspNow::KEYFRAME_INTERVAL);
+        Frames run = transmit(flight, perPeriod,
+            [&encoder](const SensorData *s, size_t n, uint8_t *f, size_t &packed) {
+                return encoder.encode(s, n, f, packed);
+            });
+        run.encodeNs += stream.encodeNs;
+        stream = run;
+    }
+
+    std::vector<SensorData> decoded;
+    SensorData out[Telemetry::MAX_FRAME_SAMPLES];
+    double decodeNs = 0.0;
+    for (int i = 0; i < rounds; i++) {
+        Telemetry::StreamDecoder decoder;
+        decoded.clear();
+        Clock::time_point start = Clock::now();
+        for (const std::vector<uint8_t> &f : stream.frames) {
+            size_t n = decoder.decode(f.data(), f.size(), out, Telemetry::MAX_FRAME_SAMPLES);
+            decoded.insert(decoded.end(), out, out + n);
+        }
+        decodeNs += std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+    }
+
+    size_t mismatches = decoded.size() == flight.size() ? 0 : flight.size();
+    for (size_t i = 0; mismatches == 0 && i < decoded.size(); i++) {
+        if (!sameQuantized(decoded[i], flight[i])) mismatches++;
+    }
+
+    printf("%-22s %10s %10s %14s\n", "formato", "amostras", "bytes", "bytes/amostra");
+    printf("%-22s %10zu %10zu %14.2f\n", "SensorData (struct)", flight.size(),
+           flight.size() * sizeof(SensorData), static_cast<double>(sizeof(SensorData)));
+    printf("%-22s %10zu %10zu %14.2f\n", "avulso v2", flight.size(),
+           flight.size() * sizeof(Telemetry::PacketV2), static_cast<double>(sizeof(Telemetry::PacketV2)));
+    printf("%-22s %10zu %10zu %14.2f  (%zu quadros)\n", "lote v3", batch.sent, batch.bytes,
+           static_cast<double>(batch.bytes) / static_cast<double>(batch.sent), batch.frames.size());
+    printf("%-22s %10zu %10zu %14.2f  (%zu quadros, keyframe a cada %u)\n", "fluxo v4", stream.sent,
+           stream.bytes, static_cast<double>(stream.bytes) / static_cast<double>(stream.sent),
+           stream.frames.size(), (unsigned)Config::EspNow::KEYFRAME_INTERVAL);
+    printf("\nfluxo v4: codifica %.1f ns/amostra, decodifica %.1f ns/amostra\n",
+           stream.encodeNs / (samples * rounds), decodeNs / (samples * rounds));
+    printf("fluxo v4: %s (%zu divergencias)\n",
+           mismatches == 0 ? "identico ao quantizado" : "DIVERGE", mismatches);
+
+    // Perda de um quadro em N: o restante do fluxo só volta no keyframe
+    const size_t lossEvery[] = {50, 20, 10};
+    for (size_t every : lossEvery) {
+        Telemetry::StreamDecoder decoder;
+        size_t received = 0;
+        size_t sent = 0;
+        for (size_t i = 0; i < stream.frames.size(); i++) {
+            const std::vector<uint8_t> &f = stream.frames[i];
+            size_t count = f[4];  // StreamHeader::count
+            sent += count;
+            if (i % every == every - 1) continue;
+            received += decoder.decode(f.data(), f.size(), out, Telemetry::MAX_FRAME_SAMPLES);
+        }
+        printf("perda de 1 quadro em %2zu: %5.1f%% das amostras recebidas (%lu quadros sem sincronismo)\n",
+               every, 100.0 * static_cast<double>(received) / static_cast<double>(sent),
+               (unsigned long)decoder.skipped());
+    }
+    return mismatches == 0 ? 0 : 2;
+}
@@ -0,0 +1,281 @@
+/**
+ * @file TransferBench.cpp
+ * @brief Simulação no host da transferência do arquivo de voo (Transfer.h)
+ * @version 1.0
+ * @date Outubro/2026
+ *
+ * Não faz parte do firmware. Compilação e uso, a partir de Foguete/:
+ *
+ *     g++ -std=gnu++11 -O2 -Iinclude tools/TransferBench.cpp src/Transfer.cpp -o transfer_bench
+ *     ./transfer_bench [perda_%] [rajada_media] [tamanho_kB]
+ *
+ * Foguete e Base dividem um único canal de 1 Mbit/s (taxa padrão do
+ * ESP-NOW): cada mensagem ocupa o ar por um tempo proporcional ao
+ * tamanho, e o rádio do foguete aceita no máximo
+ * Config::Download::MAX_IN_FLIGHT mensagens de cada vez, como no
+ * firmware. As perdas seguem o modelo de Gilbert-Elliott (ver
+ * FecBench.cpp), sorteadas separadamente em cada sentido.
+ *
+ * Para cada janela imprime a vazão útil em kB/s, a fração de pedaços
+ * reenviados e se o arquivo chegou íntegro. Sem argumentos, percorre
+ * uma grade de cenários. A janela 1 é o pare-e-espere de referência e
+ * paga também o ACK atrasado (Transfer::ACK_DELAY_US) a cada pedaço.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <vector>
+
+#include "Config.h"
+#include "Transfer.h"
+
+namespace
+{
+    /// @brief Passo da simulação (µs)
+    constexpr uint32_t STEP_US = 50U;
+
+    /// @brief Tempo de ar fixo por mensagem: preâmbulo, cabeçalhos e intervalo (µs)
+    constexpr uint32_t AIR_OVERHEAD_US = 560U;
+
+    /// @brief Tempo de ar por byte a 1 Mbit/s (µs)
+    constexpr uint32_t AIR_US_PER_BYTE = 8U;
+
+    /// @brief Base sem resposta: ver Config::Download da Base
+    constexpr uint32_t BASE_TIMEOUT_US = 200000UL;
+    constexpr uint32_t BASE_IDLE_US = 5000000UL;
+
+    /// @brief Limite da simulação (µs)
+    constexpr uint32_t MAX_TIME_US = 600000000UL;
+
+    /// @brief Gerador determinístico (LCG)
+    struct Random {
+        uint32_t seed;
+
+        explicit Random(uint32_t s) : seed(s) {}
+
+        double uniform()
+        {
+            seed = seed * 1664525U + 1013904223U;
+            return static_cast<double>(seed >> 8) / 16777216.0;
+        }
+    };
+
+    /// @brief Canal de Gilbert-Elliott com perda total no estado ruim
+    class Channel
+    {
+    public:
+        Channel(double loss, double burst, uint32_t seed)
+            : random_(seed)
+        {
+            leave_ = 1.0 / (burst < 1.0 ? 1.0 : burst);
+            enter_ = loss >= 1.0 ? 1.0 : loss * leave_ / (1.0 - loss);
+        }
+
+        /// @retval true A próxima mensagem se perde
+        bool lose()
+        {
+            bad_ = bad_ ? random_.uniform() >= leave_ : random_.uniform() < enter_;
+            return bad_;
+        }
+
+    private:
+        Random random_;
+        double enter_;
+        double leave_;
+        bool bad_ = false;
+    };
+
+    typedef std::vector<uint8_t> Message;
+
+    /// @brief Um lado do enlace: fila do rádio e perdas no sentido de envio
+    struct Node {
+        std::deque<Message> queue;
+        size_t limit;
+        Channel channel;
+
+        Node(size_t l, double loss, double burst, uint32_t seed) : limit(l), channel(loss, burst, seed) {}
+    };
+
+    bool enqueue(const uint8_t *message, size_t len, void *context)
+    {
+        Node &node = *static_cast<Node *>(context);
+        if (node.queue.size() >= node.limit) return false;  // ESP_ERR_ESPNOW_NO_MEM
+        node.queue.push_back(Message(message, message + len));
+        return true;
+    }
+
+    /// @brief Contexto do foguete: o rádio e o arquivo
+    struct Rocket {
+        Node node;
+        const std::vector<uint8_t> *file;
+
+        Rocket(double loss, double burst) : node(Config::Download::MAX_IN_FLIGHT, loss, burst, 1234U) {}
+    };
+
+    bool rocketSend(const uint8_t *message, size_t len, void *context)
+    {
+        return enqueue(message, len, &static_cast<Rocket *>(context)->node);
+    }
+
+    size_t rocketRead(uint32_t offset, uint8_t *out, size_t len, void *context)
+    {
+        const std::vector<uint8_t> &file = *static_cast<Rocket *>(context)->file;
+        if (offset >= file.size()) return 0;
+        if (len > file.size() - offset) len = file.size() - offset;
+        memcpy(out, file.data() + offset, len);
+        return len;
+    }
+
+    /// @brief Contexto da Base: o rádio e o arquivo reconstruído
+    struct Base {
+        Node node;
+        std::vector<uint8_t> file;
+
+        Base(double loss, double burst) : node(16U, loss, burst, 5678U) {}
+    };
+
+    bool baseSend(const uint8_t *message, size_t len, void *context)
+    {
+        return enqueue(message, len, &static_cast<Base *>(context)->node);
+    }
+
+    bool baseOpen(const char *, uint32_t size, void *context)
+    {
+        Base &base = *static_cast<Base *>(context);
+        base.file.clear();
+        base.file.reserve(size);
+        return true;
+    }
+
+    bool baseWrite(const uint8_t *data, size_t len, void *context)
+    {
+        std::vector<uint8_t> &file = static_cast<Base *>(context)->file;
+        file.insert(file.end(), data, data + len);
+        return true;
+    }
+
+    /// @brief Resultado de um cenário
+    struct Result {
+        bool complete;
+        bool intact;
+        double seconds;
+        double kBps;
+        double retransmitted;  ///< Reenvios / pedaços do arquivo
+        uint32_t timeouts;
+        uint32_t acks;
+    };
+
+    Result simulate(const std::vector<uint8_t> &file, size_t window, double loss, double burst)
+    {
+        Rocket rocket(loss, burst);
+        rocket.file = &file;
+        Base base(loss, burst);
+
+        Transfer::Sender sender(rocketSend, rocketRead, &rocket, window,
+                                Config::Download::RETRY_TIMEOUT * 1000UL,
+                                Config::Download::IDLE_TIMEOUT * 1000UL);
+        Transfer::Receiver receiver(baseSend, baseOpen, baseWrite, &base, BASE_TIMEOUT_US, BASE_IDLE_US);
+
+        // Mensagem no ar: quem envia e quando termina
+        Node *airFrom = nullptr;
+        Message air;
+        uint32_t airEndUs = 0;
+        bool turn = false;  // Alterna o acesso quando os dois têm o que enviar
+
+        uint32_t nowUs = 0;
+        receiver.request(nowUs);
+
+        for (; nowUs < MAX_TIME_US; nowUs += STEP_US) {
+            if (airFrom != nullptr && nowUs >= airEndUs) {
+                const bool lost = airFrom->channel.lose();
+                if (!lost) {
+                    if (airFrom == &rocket.node) {
+                        receiver.receive(air.data(), air.size(), nowUs);
+                    } else {
+                        uint8_t session;
+                        if (Transfer::parseRequest(air.data(), air.size(), session)) {
+                            sender.begin(session, Transfer::OK, static_cast<uint32_t>(file.size()),
+                                         "/flight_log_000001.bin", nowUs);
+                        } else {
+                            sender.receive(air.data(), air.size(), nowUs);
+                        }
+                    }
+                }
+                airFrom = nullptr;
+            }
+
+            sender.poll(nowUs, rocket.node.limit - rocket.node.queue.size());
+            receiver.poll(nowUs);
+
+            const Transfer::Receiver::State state = receiver.state();
+            if (state == Transfer::Receiver::DONE || state == Transfer::Receiver::FAILED) break;
+
+            if (airFrom == nullptr) {
+                Node *next = nullptr;
+                if (!rocket.node.queue.empty() && !base.node.queue.empty()) {
+                    next = turn ? &rocket.node : &base.node;
+                    turn = !turn;
+                } else if (!rocket.node.queue.empty()) {
+                    next = &rocket.node;
+                } else if (!base.node.queue.empty()) {
+                    next = &base.node;
+                }
+                if (next != nullptr) {
+                    air = next->queue.front();
+                    next->queue.pop_front();
+                    airFrom = next;
+                    airEndUs = nowUs + AIR_OVERHEAD_US + AIR_US_PER_BYTE * static_cast<uint32_t>(air.size());
+                }
+            }
+        }
+
+        Result r;
+        r.complete = receiver.state() == Transfer::Receiver::DONE;
+        r.intact = r.complete && base.file == file;
+        r.seconds = nowUs / 1e6;
+        r.kBps = r.seconds > 0 ? receiver.written() / 1024.0 / r.seconds : 0.0;
+        r.retransmitted = static_cast<double>(sender.stats().retransmitted) /
+                          static_cast<double>(Transfer::chunkCount(static_cast<uint32_t>(file.size())));
+        r.timeouts = sender.stats().timeouts;
+        r.acks = receiver.stats().acks;
+        return r;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<double> losses = {0.0, 0.01, 0.05, 0.10, 0.20};
+    std::vector<double> bursts = {1.0, 4.0};
+    size_t kilobytes = 256U;
+    if (argc > 1) losses = {atof(argv[1]) / 100.0};
+    if (argc > 2) bursts = {atof(argv[2])};
+    if (argc > 3) kilobytes = static_cast<size_t>(atoi(argv[3]));
+
+    // Conteúdo qualquer, mas diferente em cada posição, para detectar trocas
+    std::vector<uint8_t> file(kilobytes * 1024U + 100U);
+    Random random(99U);
+    for (uint8_t &byte : file) byte = static_cast<uint8_t>(random.uniform() * 256.0);
+
+    const size_t windows[] = {1, 8, 32};
+
+    printf("arquivo de %zu bytes, %lu pedacos de %zu bytes, %zu envios no radio\n\n", file.size(),
+           (unsigned long)Transfer::chunkCount(static_cast<uint32_t>(file.size())), Transfer::CHUNK_BYTES,
+           Config::Download::MAX_IN_FLIGHT);
+    printf("%6s %6s %6s %9s %8s %9s %8s %6s %8s\n",
+           "perda", "rajada", "janela", "vazao", "tempo", "reenvios", "timeouts", "acks", "arquivo");
+    for (double loss : losses) {
+        for (double burst : bursts) {
+            for (size_t window : windows) {
+                Result r = simulate(file, window, loss, burst);
+                printf("%5.1f%% %6.1f %6zu %5.1f kB/s %6.1f s %8.1f%% %8lu %6lu %8s\n",
+                       loss * 100.0, burst, window, r.kBps, r.seconds, r.retransmitted * 100.0,
+                       (unsigned long)r.timeouts, (unsigned long)r.acks,
+                       r.intact ? "ok" : r.complete ? "CORROMPIDO" : "INCOMPLETO");
+            }
+            printf("\n");
+        }
+    }
+    return 0;
+}